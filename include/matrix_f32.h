@@ -7,6 +7,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <stdint.h>
 
 typedef enum {
 	SwapOptNull = 0,
@@ -16,6 +17,9 @@ typedef enum {
 
 typedef enum { OwnerShipNull = 0, OwnerShipSelf = 1, OwnerShipOuter = 2 } AddrOwnerShip;
 
+// order of the entries in the buffer, entry (i, j) of an m x n matrix is at i * n + j or at j * m + i
+typedef enum { MatrixLayoutRowMajor = 0, MatrixLayoutColMajor = 1 } MatrixLayout;
+
 typedef struct MatrixDim {
 	size_t m_row;
 	size_t m_col;
@@ -23,11 +27,13 @@ typedef struct MatrixDim {
 
 typedef enum {
 	MatrixStatusOK = 0,
-	MatrixStatusErrDimMismatch = 0b00001,
-	MatrixStatusErrOutOfBound = 0b00010,
-	MatrixStatusErrNullPtr = 0b00100,
-	MatrixStatusErrSingular = 0b01000,
-	MatrixStatusErrUnknownOpt = 0b10000
+	MatrixStatusErrDimMismatch = 0b000001,
+	MatrixStatusErrOutOfBound = 0b000010,
+	MatrixStatusErrNullPtr = 0b000100,
+	MatrixStatusErrSingular = 0b001000,
+	MatrixStatusErrUnknownOpt = 0b010000,
+	MatrixStatusErrIO = 0b100000,
+	MatrixStatusErrLayout = 0b1000000
 } MatrixStatus;
 
 #ifdef __cplusplus
@@ -44,6 +50,9 @@ typedef struct MatrixF32 *MatrixF32Ptr;
  *
  * @param  t_dim Column and row of the desired matrix
  * @return			 MatrixF32Ptr
+ *
+ * @note 	 Invalid dimension is reported through THROW (util/runtime_error.h), NULL is returned if the error context of
+ * 				 the calling thread does not abort
  */
 MatrixF32Ptr matrixf32Create(MatrixDimType t_dim);
 
@@ -54,9 +63,47 @@ MatrixF32Ptr matrixf32Create(MatrixDimType t_dim);
  * @param  t_val        Floating point buffer
  * @param  t_buffer_len Length of the buffer, the length of buffer should be equal to column * row
  * @return              MatrixF32Ptr
+ *
+ * @note 	 Same as matrixf32Create, NULL is returned on invalid input if the error context does not abort
  */
 MatrixF32Ptr matrixf32CreateContainer(MatrixDimType t_dim, float *t_val, int t_buffer_len);
 
+/**
+ * @brief  This function does the same thing as matrixf32Create with the entries stored in the given layout.
+ * 				 matrixf32Create is the same as MatrixLayoutRowMajor
+ *
+ * @param  t_dim    Column and row of the desired matrix
+ * @param  t_layout MatrixLayoutRowMajor or MatrixLayoutColMajor
+ * @return          MatrixF32Ptr, an unknown layout is reported through THROW as MatrixStatusErrUnknownOpt
+ */
+MatrixF32Ptr matrixf32CreateWithLayout(MatrixDimType t_dim, MatrixLayout t_layout);
+
+/**
+ * @brief  This function wraps a buffer stored in the given layout like matrixf32CreateContainer does, so column-major
+ * 				 data from Fortran or LAPACK style code is used without a transposing copy
+ *
+ * @param  t_dim        Column and row of the desired matrix
+ * @param  t_val        Floating point buffer
+ * @param  t_buffer_len Length of the buffer, at least column * row
+ * @param  t_layout     Order of the entries in t_val
+ * @return              MatrixF32Ptr, see matrixf32CreateWithLayout
+ */
+MatrixF32Ptr matrixf32CreateContainerWithLayout(MatrixDimType t_dim, float *t_val, int t_buffer_len,
+												MatrixLayout t_layout);
+
+/**
+ * @brief  This function returns the layout of the buffer of the matrix
+ *
+ * @param  t_dest Matrix to get the layout
+ * @return        MatrixLayout, MatrixLayoutRowMajor if the input is invalid and the error context does not abort
+ *
+ * @note   Every function of this header accepts operands of either layout, mixing layouts in one call costs a
+ * 				 transposing pass over the operands that differ from the result. Functions of the other headers
+ * 				 index the buffer row by row and return MatrixStatusErrLayout for column-major matrices that are
+ * 				 not vectors
+ */
+MatrixLayout matrixf32GetLayout(MatrixF32Ptr t_dest);
+
 /**
  * @brief  This function destroy MatrixF32 instance
  *
@@ -95,7 +142,8 @@ AddrOwnerShip matrixf32GetOwnership(MatrixF32Ptr t_dest);
  * @param  t_dest Matrix to get value
  * @param  t_dim  Column and row
  *
- * @return        The value at given row and column of the matrix passed to this function
+ * @return        The value at given row and column of the matrix passed to this function, 0 if the input is invalid
+ * 								and the error context does not abort
  */
 float matrixf32GetValueAt(MatrixF32Ptr t_dest, MatrixDimType t_dim);
 
@@ -105,7 +153,9 @@ float matrixf32GetValueAt(MatrixF32Ptr t_dest, MatrixDimType t_dim);
  * @param  t_dest Matrix to get the pointer to the buffer
  * @return        The pointer to the buffer
  *
- * @note 	 It is not encouraged to use this function, it will be removed in the future
+ * @note 	 It is not encouraged to use this function, it will be removed in the future. The version of the matrix is
+ * 				 bumped as the caller may write through the pointer. The entries are ordered as given by
+ * 				 matrixf32GetLayout
  */
 float *matrixf32GetBuffer(MatrixF32Ptr t_dest);	 // @TODO: remove this
 
@@ -246,6 +296,44 @@ MatrixStatus matrixf32BackwardSubstitution(const MatrixF32Ptr t_result, const Ma
  */
 MatrixStatus matrixf32Inverse(const MatrixF32Ptr t_result, const MatrixF32Ptr t_source);
 
+/**
+ * @brief  This function returns the version of the matrix, bumped by every function writing to it
+ *
+ * @param  t_dest Matrix to get the version
+ * @return        The version, 0 for a new matrix and if the input is invalid and the error context does not abort
+ *
+ * @note   Writes through matrixf32GetBuffer are only seen at the time the pointer is taken. The same holds for the
+ * 				 buffer given to matrixf32CreateContainer: writes made to it directly do not bump the version
+ */
+uint32_t matrixf32GetVersion(MatrixF32Ptr t_dest);
+
+/**
+ * @brief  This function attaches a factorization cache to a square matrix or releases it. matrixf32Solve and
+ * 				 matrixf32Inverse then reuse the LU decomposition and the inverse of the matrix while its version is
+ * 				 unchanged and factorize again lazily otherwise
+ *
+ * @param  t_dest   The matrix to cache the factorization of
+ * @param  t_enable true to attach the cache, false to release it
+ * @return          MatrixStatus
+ *
+ * @note   The buffers of the cache are allocated by the first solve or inverse, the LU decomposition and the
+ * 				 inverse take n x n each
+ * @note   The cache can not see writes that bypass the library, e.g. to the buffer of a matrixf32CreateContainer
+ * 				 matrix or through a pointer kept from matrixf32GetBuffer. Call matrixf32GetBuffer again after such
+ * 				 writes to bump the version, otherwise stale factors are returned
+ */
+MatrixStatus matrixf32SetFactorCache(MatrixF32Ptr t_dest, bool t_enable);
+
+/**
+ * @brief  This function solves A * X = B with the LU decomposition of A
+ *
+ * @param  t_result The buffer to store X, n x k. Must not be the same as t_column
+ * @param  t_mat_a  A, n x n
+ * @param  t_column B, n x k
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32Solve(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_a, const MatrixF32Ptr t_column);
+
 #ifdef __cplusplus
 }
 #endif
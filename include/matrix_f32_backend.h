@@ -0,0 +1,77 @@
+/**
+ * @Date:   2026-10-20T09:14:26+08:00
+ * @Last modified time: 2026-10-20T09:14:26+08:00
+ */
+#ifndef MATRIX_F32_BACKEND_H_
+#define MATRIX_F32_BACKEND_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// environment variable read on first use unless matrixf32SetBackend was called, e.g. MATRIX_F32_BACKEND=native
+#define MATRIX_F32_BACKEND_ENV "MATRIX_F32_BACKEND"
+
+// sets of compute kernels the GEMM, LU factorization and triangular solves of every module are dispatched to
+typedef enum {
+	MatrixBackendReference = 0,	 // scalar kernels, the default
+	MatrixBackendNative,		 // register-blocked GEMM, LU and substitutions in blocks
+	MatrixBackendCblas,			 // CBLAS sgemm / strsm and LAPACKE sgetrf, only with MATRIX_F32_ENABLE_CBLAS
+	MatrixBackendCount
+} MatrixBackend;
+
+/**
+ * @brief  This function tells whether t_backend is compiled in
+ */
+bool matrixf32BackendAvailable(MatrixBackend t_backend);
+
+/**
+ * @brief  This function returns the name of t_backend as accepted by matrixf32SetBackendByName, or NULL if
+ * 				 t_backend is out of range
+ */
+const char *matrixf32BackendName(MatrixBackend t_backend);
+
+/**
+ * @brief  This function selects the backend of the whole process
+ *
+ * @note   Switch while no computation is running, a call in progress may run its phases on different backends. A
+ * 				 factorization computed by one backend can be used by the solves of any other.
+ *
+ * @return MatrixStatus, MatrixStatusErrUnknownOpt if t_backend is out of range or not compiled in
+ */
+MatrixStatus matrixf32SetBackend(MatrixBackend t_backend);
+
+/**
+ * @brief  This function does the same thing as matrixf32SetBackend, by name ("reference", "native" or "cblas")
+ *
+ * @return MatrixStatus, MatrixStatusErrUnknownOpt if the name is unknown or the backend not compiled in
+ */
+MatrixStatus matrixf32SetBackendByName(const char *t_name);
+
+/**
+ * @brief  This function returns the selected backend. Until one is set, the first call of this or any computing
+ * 				 function selects the backend named by the MATRIX_F32_BACKEND environment variable, and the reference
+ * 				 backend if it is unset, unknown or not compiled in
+ */
+MatrixBackend matrixf32GetBackend(void);
+
+/**
+ * @brief  This function cross-checks t_backend against the reference backend. Both multiply two random n x n
+ * 				 matrices, then factorize the first and solve for the second, t_max_error is the largest difference
+ * 				 of either result relative to the largest entry of the reference result. The selection is unchanged.
+ *
+ * @param  t_backend   Backend to check
+ * @param  t_n         Dimension of the random matrices, work memory of 7n^2 floats is allocated
+ * @param  t_max_error Relative difference, about n * eps for a correct backend
+ * @return             MatrixStatus, MatrixStatusErrUnknownOpt if the backend is not available and
+ * 										 MatrixStatusErrSingular if one of the factorizations fails
+ */
+MatrixStatus matrixf32BackendSelfTest(MatrixBackend t_backend, size_t t_n, float *t_max_error);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_BACKEND_H_
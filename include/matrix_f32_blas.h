@@ -0,0 +1,90 @@
+/**
+ * @Date:   2026-10-20T11:37:02+08:00
+ * @Last modified time: 2026-10-20T11:37:02+08:00
+ */
+#ifndef MATRIX_F32_BLAS_H_
+#define MATRIX_F32_BLAS_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *	Level 1 and 2 operations on vectors, i.e. n x 1 or 1 x n matrices, whose length is their number of entries.
+ *	The kernels use SSE on x86 and NEON on ARM cores that have it, and several independent accumulators otherwise.
+ *	Dot products and norms are therefore summed in a different order than a sequential loop would.
+ */
+
+/**
+ * @brief  This function computes t_result = x^T * y
+ *
+ * @param  t_result Dot product
+ * @param  t_x      Vector
+ * @param  t_y      Vector of the same length
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32Dot(float *t_result, const MatrixF32Ptr t_x, const MatrixF32Ptr t_y);
+
+/**
+ * @brief  This function computes the euclidean norm of t_x, rescaling if the sum of squares overflows or underflows
+ *
+ * @param  t_result ||x||
+ * @param  t_x      Vector
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32Nrm2(float *t_result, const MatrixF32Ptr t_x);
+
+/**
+ * @brief  This function computes y = alpha * x + y without a temporary
+ *
+ * @param  t_y     Vector, updated in place
+ * @param  t_alpha Scale of t_x
+ * @param  t_x     Vector of the same length, may be t_y
+ * @return         MatrixStatus
+ */
+MatrixStatus matrixf32Axpy(const MatrixF32Ptr t_y, float t_alpha, const MatrixF32Ptr t_x);
+
+/**
+ * @brief  This function computes y = alpha * A * x + beta * y. t_y is not read if t_beta is 0
+ *
+ * @param  t_y     Vector of length m, must not overlap t_x or t_mat_a
+ * @param  t_alpha Scale of the product
+ * @param  t_mat_a m x n, in either layout
+ * @param  t_x     Vector of length n
+ * @param  t_beta  Scale of t_y
+ * @return         MatrixStatus
+ */
+MatrixStatus matrixf32Gemv(const MatrixF32Ptr t_y, float t_alpha, const MatrixF32Ptr t_mat_a, const MatrixF32Ptr t_x,
+						   float t_beta);
+
+/**
+ * @brief  This function computes y = alpha * A^T * x + beta * y without transposing A. t_y is not read if t_beta is 0
+ *
+ * @param  t_y     Vector of length n, must not overlap t_x or t_mat_a
+ * @param  t_alpha Scale of the product
+ * @param  t_mat_a m x n, in either layout
+ * @param  t_x     Vector of length m
+ * @param  t_beta  Scale of t_y
+ * @return         MatrixStatus
+ */
+MatrixStatus matrixf32GemvTransposed(const MatrixF32Ptr t_y, float t_alpha, const MatrixF32Ptr t_mat_a,
+									 const MatrixF32Ptr t_x, float t_beta);
+
+/**
+ * @brief  This function computes the rank-1 update A = alpha * x * y^T + A without forming the outer product
+ *
+ * @param  t_mat_a m x n, in either layout, must not overlap t_x or t_y
+ * @param  t_alpha Scale of the outer product
+ * @param  t_x     Vector of length m
+ * @param  t_y     Vector of length n
+ * @return         MatrixStatus
+ */
+MatrixStatus matrixf32Ger(const MatrixF32Ptr t_mat_a, float t_alpha, const MatrixF32Ptr t_x, const MatrixF32Ptr t_y);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_BLAS_H_
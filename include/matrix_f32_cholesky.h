@@ -0,0 +1,57 @@
+/**
+ * @Date:   2026-10-19T19:02:16+08:00
+ * @Last modified time: 2026-10-19T19:02:16+08:00
+ */
+#ifndef MATRIX_F32_CHOLESKY_H_
+#define MATRIX_F32_CHOLESKY_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief  This function does Cholesky decomposition A = L * L^T of a symmetric positive definite matrix
+ *
+ * @param  t_result The buffer to store L, the strictly upper triangle is set to 0. May be the same as t_source
+ * @param  t_source The source matrix, only the lower triangle is read
+ * @return          MatrixStatus, MatrixStatusErrSingular if the matrix is not positive definite
+ */
+MatrixStatus matrixf32Cholesky(const MatrixF32Ptr t_result, const MatrixF32Ptr t_source);
+
+/**
+ * @brief  This function solves A * X = B with the Cholesky factor of A, i.e. L * L^T * X = B
+ *
+ * @param  t_result The buffer to store X, n x k. May be the same as t_column
+ * @param  t_lower  The Cholesky factor L, n x n
+ * @param  t_column B, n x k
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32CholeskySolve(const MatrixF32Ptr t_result, const MatrixF32Ptr t_lower,
+									const MatrixF32Ptr t_column);
+
+/**
+ * @brief  This function updates the Cholesky factor of A to the one of A + x * x^T in O(n^2)
+ *
+ * @param  t_lower  The Cholesky factor L, updated in place
+ * @param  t_vector x, n x 1, used as workspace and overwritten
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32CholeskyUpdate(const MatrixF32Ptr t_lower, const MatrixF32Ptr t_vector);
+
+/**
+ * @brief  This function updates the Cholesky factor of A to the one of A - x * x^T in O(n^2)
+ *
+ * @param  t_lower  The Cholesky factor L, updated in place
+ * @param  t_vector x, n x 1, used as workspace and overwritten
+ * @return          MatrixStatus, MatrixStatusErrSingular if A - x * x^T is not positive definite, t_lower is then
+ * 									partially updated
+ */
+MatrixStatus matrixf32CholeskyDowndate(const MatrixF32Ptr t_lower, const MatrixF32Ptr t_vector);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_CHOLESKY_H_
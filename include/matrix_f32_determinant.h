@@ -0,0 +1,74 @@
+/**
+ * @Date:   2026-10-20T19:26:48+08:00
+ * @Last modified time: 2026-10-20T19:26:48+08:00
+ */
+#ifndef MATRIX_F32_DETERMINANT_H_
+#define MATRIX_F32_DETERMINANT_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *	Quantities derived from the factors of matrixf32InPlaceLU or matrixf32OutPlaceLU, P * A = L * U, in either
+ *	layout. Nothing is refactorized and the inverse is never formed. A zero on the diagonal of U, as left by a
+ *	factorization that returned MatrixStatusErrSingular, gives a determinant and a reciprocal condition number of 0.
+ */
+
+/**
+ * @brief  This function computes det(A) = sign(P) * u_11 * ... * u_nn, without overflowing in the intermediate
+ * 				 products
+ *
+ * @param  t_result      det(A), +-inf if it is out of the float range
+ * @param  t_lu          n x n LU factors
+ * @param  t_permutation n x 1 row permutation of the factorization
+ * @return               MatrixStatus, MatrixStatusErrOutOfBound if the permutation holds an invalid row
+ */
+MatrixStatus matrixf32LUDeterminant(float *t_result, const MatrixF32Ptr t_lu, const MatrixF32Ptr t_permutation);
+
+/**
+ * @brief  This function computes log|det(A)| and the sign of det(A), which stay accurate where det(A) itself
+ * 				 overflows or underflows
+ *
+ * @param  t_result      log|det(A)|, -inf if A is singular
+ * @param  t_sign        1, -1 or 0 if A is singular, may be NULL
+ * @param  t_lu          n x n LU factors
+ * @param  t_permutation n x 1 row permutation of the factorization
+ * @return               MatrixStatus, see matrixf32LUDeterminant
+ */
+MatrixStatus matrixf32LULogDeterminant(float *t_result, float *t_sign, const MatrixF32Ptr t_lu,
+									   const MatrixF32Ptr t_permutation);
+
+/**
+ * @brief  This function returns the number of floats of workspace matrixf32LURcond needs for an n x n matrix
+ *
+ * @param  t_n Dimension n of the matrix
+ * @return     Number of floats
+ */
+size_t matrixf32LURcondWorkspaceLen(size_t t_n);
+
+/**
+ * @brief  This function estimates the reciprocal condition number 1 / (||A||_1 * ||A^-1||_1) in O(n^2). ||A^-1||_1
+ * 				 is estimated by Hager's method with Higham's refinements, from at most five pairs of solves with
+ * 				 A and A^T through the factors, and is a lower bound that is rarely more than 3 times too small.
+ * 				 Values near FLT_EPSILON or below mean A is singular to working precision
+ *
+ * @param  t_result        Estimate of the reciprocal condition number, 0 if A is singular
+ * @param  t_lu            n x n LU factors
+ * @param  t_permutation   n x 1 row permutation of the factorization
+ * @param  t_norm_a        ||A||_1 of the matrix before factorization, see matrixf32Norm with MatrixNormOne
+ * @param  t_workspace     Caller workspace, no memory is allocated
+ * @param  t_workspace_len Length of t_workspace in floats, see matrixf32LURcondWorkspaceLen
+ * @return                 MatrixStatus, MatrixStatusErrOutOfBound if the workspace is too small or the
+ * 												 permutation holds an invalid row
+ */
+MatrixStatus matrixf32LURcond(float *t_result, const MatrixF32Ptr t_lu, const MatrixF32Ptr t_permutation,
+							  float t_norm_a, float *t_workspace, size_t t_workspace_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_DETERMINANT_H_
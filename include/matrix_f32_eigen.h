@@ -0,0 +1,46 @@
+/**
+ * @Date:   2026-10-19T23:41:52+08:00
+ * @Last modified time: 2026-10-19T23:41:52+08:00
+ */
+#ifndef MATRIX_F32_EIGEN_H_
+#define MATRIX_F32_EIGEN_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief  This function returns the number of floats of workspace matrixf32SymEigen needs
+ *
+ * @param  t_n       Dimension of the symmetric matrix
+ * @param  t_vectors Whether eigenvectors are computed
+ * @return           Number of floats, 0 if t_n is 0
+ */
+size_t matrixf32SymEigenWorkspaceLen(size_t t_n, bool t_vectors);
+
+/**
+ * @brief  This function computes the k largest eigenvalues and optionally their eigenvectors of a symmetric matrix.
+ * 				 The matrix is reduced to tridiagonal form by Householder reflections, blocked by
+ * 				 MATRIX_F32_EIGEN_BLOCK columns so that most of the update runs in the GEMM kernel, then the
+ * 				 tridiagonal matrix is diagonalized by the implicit QL algorithm with Wilkinson shifts
+ *
+ * @param  t_values        k x 1, receives the k largest eigenvalues in descending order, 1 <= k <= n
+ * @param  t_vectors       n x k, column j receives the unit eigenvector of eigenvalue j with its largest
+ * 												 magnitude component positive. NULL for eigenvalues only, which
+ * 												 costs O(n^2) after the reduction instead of O(n^3)
+ * @param  t_source        n x n, only the lower triangle is read
+ * @param  t_workspace     Caller workspace, no memory is allocated
+ * @param  t_workspace_len Length of t_workspace in floats, see matrixf32SymEigenWorkspaceLen
+ * @return                 MatrixStatus, MatrixStatusErrOutOfBound if the workspace is too small,
+ * 												 MatrixStatusErrSingular if the QL iteration does not converge
+ */
+MatrixStatus matrixf32SymEigen(const MatrixF32Ptr t_values, const MatrixF32Ptr t_vectors, const MatrixF32Ptr t_source,
+							   float *t_workspace, size_t t_workspace_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_EIGEN_H_
@@ -0,0 +1,100 @@
+/**
+ * @Date:   2026-10-20T17:05:13+08:00
+ * @Last modified time: 2026-10-20T17:05:13+08:00
+ */
+#ifndef MATRIX_F32_ELEMENTWISE_H_
+#define MATRIX_F32_ELEMENTWISE_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *	Elementwise operations beyond matrixf32Add, matrixf32Subtract and matrixf32Scale. Each makes a single pass over
+ *	the result, the operands may be in either layout and the result may be one of them. The arithmetic and the
+ *	built-in functions use SSE2 on x86 and NEON on AArch64, and plain loops otherwise.
+ */
+
+typedef enum { MatrixZipAdd = 0, MatrixZipSubtract, MatrixZipMultiply, MatrixZipDivide } MatrixZipOp;
+
+typedef enum {
+	MatrixMapIdentity = 0,
+	MatrixMapAbs,
+	MatrixMapSqrt,  // NaN for negative entries
+	MatrixMapExp,	// within 1 ulp of exp in double, 0 below about -103.97 and +inf above about 88.72
+	MatrixMapClamp,
+} MatrixMapFunc;
+
+typedef struct MatrixMap {
+	MatrixMapFunc m_func;
+	float m_lo;	 // bounds of MatrixMapClamp, ignored otherwise
+	float m_hi;
+} MatrixMapType;
+
+/**
+ * @brief  This function multiplies two matrices entry by entry, likewise matrixf32HadamardDivide divides them
+ *
+ * @param  t_result The buffer to store the result
+ * @param  t_mat_b  Left operand
+ * @param  t_mat_c  Right operand, divisor of matrixf32HadamardDivide
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32HadamardProduct(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b,
+									  const MatrixF32Ptr t_mat_c);
+MatrixStatus matrixf32HadamardDivide(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b,
+									 const MatrixF32Ptr t_mat_c);
+
+/**
+ * @brief  This function computes result(i, j) = b(i, j) op row(j), repeating the vector for every row
+ *
+ * @param  t_result The buffer to store the result
+ * @param  t_mat_b  m x n matrix
+ * @param  t_op     Operation, MatrixStatusErrUnknownOpt if out of range
+ * @param  t_row    Vector of length n, must not overlap t_result
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32BroadcastRow(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b, MatrixZipOp t_op,
+								   const MatrixF32Ptr t_row);
+
+/**
+ * @brief  This function computes result(i, j) = b(i, j) op col(i), repeating the vector for every column
+ *
+ * @param  t_result The buffer to store the result
+ * @param  t_mat_b  m x n matrix
+ * @param  t_op     Operation, MatrixStatusErrUnknownOpt if out of range
+ * @param  t_col    Vector of length m, must not overlap t_result
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32BroadcastCol(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b, MatrixZipOp t_op,
+								   const MatrixF32Ptr t_col);
+
+/**
+ * @brief  This function applies a built-in function to every entry, result(i, j) = f(b(i, j))
+ *
+ * @param  t_result The buffer to store the result
+ * @param  t_mat_b  Matrix
+ * @param  t_map    Function, MatrixStatusErrUnknownOpt if out of range or if clamp bounds are not ordered
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32Map(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b, MatrixMapType t_map);
+
+/**
+ * @brief  This function computes result(i, j) = f(b(i, j) op c(i, j)) without writing the intermediate
+ *
+ * @param  t_result The buffer to store the result
+ * @param  t_mat_b  Left operand
+ * @param  t_op     Operation, MatrixStatusErrUnknownOpt if out of range
+ * @param  t_mat_c  Right operand
+ * @param  t_map    Function applied to the result of t_op, MatrixMapIdentity for none
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32Zip(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b, MatrixZipOp t_op,
+						  const MatrixF32Ptr t_mat_c, MatrixMapType t_map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_ELEMENTWISE_H_
@@ -0,0 +1,92 @@
+/**
+ * @Date:   2026-10-19T15:10:12+08:00
+ * @Last modified time: 2026-10-19T15:10:12+08:00
+ */
+#ifndef MATRIX_F32_FILE_H_
+#define MATRIX_F32_FILE_H_
+
+#include "matrix_f32.h"
+
+#include <stdint.h>
+
+#define MATRIX_F32_FILE_VERSION 1
+#define MATRIX_F32_FILE_ALIGNMENT 64
+
+/**
+ *	On-disk header, all fields are little endian. The payload is row * stride floats starting at m_payloadOffset,
+ *	which is a multiple of m_alignment. The header occupies exactly one alignment unit.
+ */
+typedef struct MatrixF32FileHeader {
+	char m_magic[4];  // "MF32"
+	uint16_t m_version;
+	uint16_t m_headerSize;
+	uint32_t m_flags;  // reserved, 0
+	uint32_t m_alignment;
+
+	uint64_t m_row;
+	uint64_t m_col;
+	uint64_t m_stride;	// floats between two consecutive rows
+	uint64_t m_payloadOffset;
+
+	uint64_t m_checksum;  // Fletcher-64 of the payload
+	uint64_t m_reserved;
+} MatrixF32FileHeaderType;
+
+/**
+ *	A matrix backed by the pages of a memory mapped file
+ */
+typedef struct MatrixF32FileMap {
+	MatrixF32Ptr m_matrix;
+
+	void *m_addr;
+	size_t m_length;
+} MatrixF32FileMapType;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief  This function writes the matrix to a file in the binary matrix format
+ *
+ * @param  t_path   Path of the file
+ * @param  t_source The matrix to be written
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32FileWrite(const char *t_path, const MatrixF32Ptr t_source);
+
+/**
+ * @brief  This function reads a binary matrix file into an existing matrix, it does not need mmap
+ *
+ * @param  t_path The file to read
+ * @param  t_dest The buffer to store the matrix, the dimension must match the file
+ * @return        MatrixStatus, MatrixStatusErrIO if the file is not a valid matrix file or the checksum does not match
+ */
+MatrixStatus matrixf32FileRead(const char *t_path, const MatrixF32Ptr t_dest);
+
+/**
+ * @brief  This function maps a binary matrix file and wraps the payload with an OwnerShipOuter matrix, no element is
+ * 				 copied and pages are only read once they are touched
+ *
+ * @param  t_path   The file to map
+ * @param  t_verify Whether to verify the checksum, this touches every page of the payload
+ * @param  t_map    The mapping, t_map->m_matrix can be used like any other matrix until matrixf32FileUnmap
+ * @return          MatrixStatus, MatrixStatusErrIO if mmap is not available on the platform
+ *
+ * @note   The mapping is copy-on-write, modifying the matrix does not change the file
+ */
+MatrixStatus matrixf32FileMap(const char *t_path, bool t_verify, MatrixF32FileMapType *t_map);
+
+/**
+ * @brief  This function destroys the matrix of the mapping and unmaps the file
+ *
+ * @param  t_map The mapping
+ * @return       MatrixStatus
+ */
+MatrixStatus matrixf32FileUnmap(MatrixF32FileMapType *t_map);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_FILE_H_
@@ -0,0 +1,164 @@
+/**
+ * @Date:   2026-10-19T21:58:14+08:00
+ * @Last modified time: 2026-10-19T21:58:14+08:00
+ */
+#ifndef MATRIX_F32_FIXED_H_
+#define MATRIX_F32_FIXED_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *	Defines the pointers to the fixed-point matrices for targets without a FPU. Entries are fractions in [-1, 1), Q15
+ *	entries are int16_t scaled by 2^15 and Q31 entries int32_t scaled by 2^31, stored row-major. Results that do not
+ *	fit saturate to the nearest representable value instead of wrapping around.
+ */
+typedef struct MatrixQ15 *MatrixQ15Ptr;
+typedef struct MatrixQ31 *MatrixQ31Ptr;
+
+/**
+ * @brief  This function creates a Q15 matrix with all entries 0
+ *
+ * @param  t_dim Column and row of the desired matrix
+ * @return       MatrixQ15Ptr, NULL on invalid dimension or if the allocation fails
+ */
+MatrixQ15Ptr matrixq15Create(MatrixDimType t_dim);
+
+/**
+ * @brief  This function destroys the Q15 matrix
+ */
+MatrixStatus matrixq15Destroy(MatrixQ15Ptr *t_dest);
+
+/**
+ * @brief  This function returns the buffer of the Q15 matrix, NULL on invalid input
+ */
+int16_t *matrixq15GetBuffer(MatrixQ15Ptr t_dest);
+
+/**
+ * @brief  This function converts a float matrix to Q15, rounding to nearest and saturating
+ *
+ * @param  t_result The Q15 matrix, same dimension as t_source
+ * @param  t_source The float matrix
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixq15FromF32(const MatrixQ15Ptr t_result, const MatrixF32Ptr t_source);
+
+/**
+ * @brief  This function converts a Q15 matrix to float, exactly
+ */
+MatrixStatus matrixq15ToF32(const MatrixF32Ptr t_result, const MatrixQ15Ptr t_source);
+
+/**
+ * @brief  This function does t_result = t_mat_b + t_mat_c, saturating
+ */
+MatrixStatus matrixq15Add(const MatrixQ15Ptr t_result, const MatrixQ15Ptr t_mat_b, const MatrixQ15Ptr t_mat_c);
+
+/**
+ * @brief  This function does t_result = t_mat_b - t_mat_c, saturating
+ */
+MatrixStatus matrixq15Subtract(const MatrixQ15Ptr t_result, const MatrixQ15Ptr t_mat_b, const MatrixQ15Ptr t_mat_c);
+
+/**
+ * @brief  This function does t_result = t_val * t_mat_b, rounding to nearest and saturating
+ */
+MatrixStatus matrixq15Scale(const MatrixQ15Ptr t_result, int16_t t_val, const MatrixQ15Ptr t_mat_b);
+
+/**
+ * @brief  This function does t_result = t_mat_b * t_mat_c. The products are accumulated exactly in 64 bits, only
+ * 				 the final sum is rounded and saturated
+ *
+ * @note   t_result must not be t_mat_b or t_mat_c
+ */
+MatrixStatus matrixq15Multiplication(const MatrixQ15Ptr t_result, const MatrixQ15Ptr t_mat_b,
+									 const MatrixQ15Ptr t_mat_c);
+
+/**
+ * @brief  This function solves t_mat_a * t_result = t_column by LU with partial pivoting, see matrixq31Solve
+ *
+ * @param  t_result n x k solution
+ * @param  t_mat_a  n x n matrix
+ * @param  t_column n x k right hand sides
+ * @return          MatrixStatus, MatrixStatusErrSingular if a pivot is 0, MatrixStatusErrNullPtr if the allocation
+ * 									fails
+ */
+MatrixStatus matrixq15Solve(const MatrixQ15Ptr t_result, const MatrixQ15Ptr t_mat_a, const MatrixQ15Ptr t_column);
+
+/**
+ * @brief  This function creates a Q31 matrix with all entries 0
+ *
+ * @param  t_dim Column and row of the desired matrix
+ * @return       MatrixQ31Ptr, NULL on invalid dimension or if the allocation fails
+ */
+MatrixQ31Ptr matrixq31Create(MatrixDimType t_dim);
+
+/**
+ * @brief  This function destroys the Q31 matrix
+ */
+MatrixStatus matrixq31Destroy(MatrixQ31Ptr *t_dest);
+
+/**
+ * @brief  This function returns the buffer of the Q31 matrix, NULL on invalid input
+ */
+int32_t *matrixq31GetBuffer(MatrixQ31Ptr t_dest);
+
+/**
+ * @brief  This function converts a float matrix to Q31, rounding to nearest and saturating
+ */
+MatrixStatus matrixq31FromF32(const MatrixQ31Ptr t_result, const MatrixF32Ptr t_source);
+
+/**
+ * @brief  This function converts a Q31 matrix to float, rounding to the float precision
+ */
+MatrixStatus matrixq31ToF32(const MatrixF32Ptr t_result, const MatrixQ31Ptr t_source);
+
+/**
+ * @brief  This function does t_result = t_mat_b + t_mat_c, saturating
+ */
+MatrixStatus matrixq31Add(const MatrixQ31Ptr t_result, const MatrixQ31Ptr t_mat_b, const MatrixQ31Ptr t_mat_c);
+
+/**
+ * @brief  This function does t_result = t_mat_b - t_mat_c, saturating
+ */
+MatrixStatus matrixq31Subtract(const MatrixQ31Ptr t_result, const MatrixQ31Ptr t_mat_b, const MatrixQ31Ptr t_mat_c);
+
+/**
+ * @brief  This function does t_result = t_val * t_mat_b, rounding to nearest and saturating
+ */
+MatrixStatus matrixq31Scale(const MatrixQ31Ptr t_result, int32_t t_val, const MatrixQ31Ptr t_mat_b);
+
+/**
+ * @brief  This function does t_result = t_mat_b * t_mat_c. The 62 bit products are accumulated in 64 bits after
+ * 				 dropping 15 fraction bits. Each product is then at most 2^47 in magnitude, so a sum of up to 65535
+ * 				 full scale products cannot overflow
+ *
+ * @return MatrixStatus, MatrixStatusErrOutOfBound if t_mat_b has more than 65535 columns
+ *
+ * @note   t_result must not be t_mat_b or t_mat_c
+ */
+MatrixStatus matrixq31Multiplication(const MatrixQ31Ptr t_result, const MatrixQ31Ptr t_mat_b,
+									 const MatrixQ31Ptr t_mat_c);
+
+/**
+ * @brief  This function solves t_mat_a * t_result = t_column by LU with partial pivoting. The elimination works on
+ * 				 64 bit values with 31 fraction bits, so intermediate results may grow well beyond [-1, 1) without
+ * 				 losing precision. The solution saturates to [-1, 1), a saturated entry is used as is for the rows
+ * 				 above it
+ *
+ * @param  t_result n x k solution
+ * @param  t_mat_a  n x n matrix
+ * @param  t_column n x k right hand sides
+ * @return          MatrixStatus, MatrixStatusErrSingular if a pivot is 0, MatrixStatusErrNullPtr if the allocation
+ * 									fails
+ *
+ * @note   The working copies take (n + k) * n * 8 bytes of heap for the duration of the call
+ */
+MatrixStatus matrixq31Solve(const MatrixQ31Ptr t_result, const MatrixQ31Ptr t_mat_a, const MatrixQ31Ptr t_column);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_FIXED_H_
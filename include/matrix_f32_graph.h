@@ -0,0 +1,107 @@
+/**
+ * @Date:   2026-10-19T20:31:07+08:00
+ * @Last modified time: 2026-10-19T20:31:07+08:00
+ */
+#ifndef MATRIX_F32_GRAPH_H_
+#define MATRIX_F32_GRAPH_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *	Defines the pointer to a recorded operation graph. Operations are recorded with the matrixf32Graph* functions
+ *	instead of being executed, compiled once and replayed as often as needed. The graph keeps the matrix handles, new
+ *	inputs are written into the input matrices between two replays.
+ */
+typedef struct MatrixF32Graph *MatrixF32GraphPtr;
+
+/**
+ * @brief  This function creates an empty graph
+ *
+ * @return MatrixF32GraphPtr, NULL if the allocation fails
+ */
+MatrixF32GraphPtr matrixf32GraphCreate(void);
+
+/**
+ * @brief  This function destroys the graph, the recorded matrices are not destroyed
+ */
+MatrixStatus matrixf32GraphDestroy(MatrixF32GraphPtr *t_graph);
+
+/**
+ * @brief  This function records matrixf32Add, the arguments are checked as the eager call does
+ */
+MatrixStatus matrixf32GraphAdd(MatrixF32GraphPtr t_graph, const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b,
+							   const MatrixF32Ptr t_mat_c);
+
+/**
+ * @brief  This function records matrixf32Subtract, the arguments are checked as the eager call does
+ */
+MatrixStatus matrixf32GraphSubtract(MatrixF32GraphPtr t_graph, const MatrixF32Ptr t_result,
+									const MatrixF32Ptr t_mat_b, const MatrixF32Ptr t_mat_c);
+
+/**
+ * @brief  This function records matrixf32Scale, the arguments are checked as the eager call does
+ */
+MatrixStatus matrixf32GraphScale(MatrixF32GraphPtr t_graph, const MatrixF32Ptr t_result, float t_val,
+								 const MatrixF32Ptr t_mat_b);
+
+/**
+ * @brief  This function records matrixf32Multiplication, the arguments are checked as the eager call does
+ */
+MatrixStatus matrixf32GraphMultiplication(MatrixF32GraphPtr t_graph, const MatrixF32Ptr t_result,
+										  const MatrixF32Ptr t_mat_b, const MatrixF32Ptr t_mat_c);
+
+/**
+ * @brief  This function records matrixf32Copy, the arguments are checked as the eager call does
+ */
+MatrixStatus matrixf32GraphCopy(MatrixF32GraphPtr t_graph, const MatrixF32Ptr t_result, const MatrixF32Ptr t_source);
+
+/**
+ * @brief  This function declares a matrix as temporary, its content is not needed after a replay. Results only
+ * 				 written to temporaries and never read are removed, intermediate results are kept in registers of the
+ * 				 fused kernels and not written back
+ *
+ * @param  t_graph The graph
+ * @param  t_mat   The temporary matrix, its content is undefined after a replay
+ * @return         MatrixStatus
+ */
+MatrixStatus matrixf32GraphSetTemporary(MatrixF32GraphPtr t_graph, const MatrixF32Ptr t_mat);
+
+/**
+ * @brief  This function optimizes the recorded operations into steps, each making one pass over memory
+ * 				 - a multiplication by a temporary scaled matrix takes the scale as its alpha
+ * 				 - operations whose results are never read are removed
+ * 				 - a chain of elementwise operations of the same dimension is fused into one kernel working on
+ * 					 blocks of MATRIX_F32_GRAPH_BLOCK floats
+ * 				 - a chain following a multiplication runs as its epilogue on each panel of
+ * 					 MATRIX_F32_GRAPH_PANEL rows while the panel is still in cache
+ *
+ * @param  t_graph The graph
+ * @return         MatrixStatus, MatrixStatusErrNullPtr if the allocation fails
+ *
+ * @note   Recording after compiling drops the compiled steps, matrixf32GraphReplay compiles again
+ */
+MatrixStatus matrixf32GraphCompile(MatrixF32GraphPtr t_graph);
+
+/**
+ * @brief  This function runs the compiled steps, compiling first if needed. The results are the same as the
+ * 				 recorded calls run eagerly, rounding aside
+ *
+ * @param  t_graph The graph, all recorded matrices must still exist
+ * @return         MatrixStatus
+ */
+MatrixStatus matrixf32GraphReplay(MatrixF32GraphPtr t_graph);
+
+/**
+ * @brief  This function returns the number of compiled steps, 0 if the graph is not compiled
+ */
+size_t matrixf32GraphGetStepNumber(MatrixF32GraphPtr t_graph);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_GRAPH_H_
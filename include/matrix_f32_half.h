@@ -0,0 +1,92 @@
+/**
+ * @Date:   2026-10-19T22:31:45+08:00
+ * @Last modified time: 2026-10-19T22:31:45+08:00
+ */
+#ifndef MATRIX_F32_HALF_H_
+#define MATRIX_F32_HALF_H_
+
+#include "matrix_f32.h"
+
+typedef enum {
+	MatrixHalfFp16 = 0,	 // IEEE 754 binary16, 11 bit significand, |x| up to 65504
+	MatrixHalfBf16		 // upper half of a float, 8 bit significand, same range as float
+} MatrixHalfFormat;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *	Defines the pointer to a matrix stored with 16 bits per entry, for read-mostly data such as lookup tables and
+ *	model weights. Computations convert the entries to float on the fly and produce float results, so memory
+ *	footprint and traffic of the half matrix are halved while the arithmetic stays in float.
+ *
+ *	The conversions use the F16C instructions when compiled with -mf16c and the __fp16 type on ARM targets defining
+ *	__ARM_FP16_FORMAT_IEEE, a portable implementation otherwise. bf16 only needs integer operations.
+ */
+typedef struct MatrixHalf *MatrixHalfPtr;
+
+/**
+ * @brief  This function creates a half matrix with all entries 0
+ *
+ * @param  t_dim    Column and row of the desired matrix
+ * @param  t_format Storage format of the entries
+ * @return          MatrixHalfPtr, NULL on invalid input or if the allocation fails
+ */
+MatrixHalfPtr matrixhalfCreate(MatrixDimType t_dim, MatrixHalfFormat t_format);
+
+/**
+ * @brief  This function destroys the half matrix
+ */
+MatrixStatus matrixhalfDestroy(MatrixHalfPtr *t_dest);
+
+/**
+ * @brief  This function returns the storage format, MatrixHalfFp16 on invalid input
+ */
+MatrixHalfFormat matrixhalfGetFormat(MatrixHalfPtr t_dest);
+
+/**
+ * @brief  This function returns the raw 16 bit entries, row-major, NULL on invalid input
+ */
+uint16_t *matrixhalfGetBuffer(MatrixHalfPtr t_dest);
+
+/**
+ * @brief  This function converts a float matrix to the half format, rounding to nearest even. Values beyond the fp16
+ * 				 range become infinite, NaN stays NaN
+ *
+ * @param  t_result The half matrix, same dimension as t_source
+ * @param  t_source The float matrix
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixhalfFromF32(const MatrixHalfPtr t_result, const MatrixF32Ptr t_source);
+
+/**
+ * @brief  This function converts a half matrix to float, exactly
+ */
+MatrixStatus matrixhalfToF32(const MatrixF32Ptr t_result, const MatrixHalfPtr t_source);
+
+/**
+ * @brief  This function does t_result = t_mat_b + t_mat_c with t_mat_b stored in half precision
+ */
+MatrixStatus matrixhalfAdd(const MatrixF32Ptr t_result, const MatrixHalfPtr t_mat_b, const MatrixF32Ptr t_mat_c);
+
+/**
+ * @brief  This function does t_result = t_val * t_mat_b with t_mat_b stored in half precision
+ */
+MatrixStatus matrixhalfScale(const MatrixF32Ptr t_result, float t_val, const MatrixHalfPtr t_mat_b);
+
+/**
+ * @brief  This function does t_result = t_mat_b * t_mat_c with t_mat_b stored in half precision. t_mat_b is
+ * 				 converted in tiles of MATRIX_F32_HALF_TILE_ROWS x MATRIX_F32_HALF_TILE_K entries on the stack, each
+ * 				 tile is multiplied by the float GEMM kernel while it is in cache
+ *
+ * @note   t_result must not be t_mat_c
+ */
+MatrixStatus matrixhalfMultiplication(const MatrixF32Ptr t_result, const MatrixHalfPtr t_mat_b,
+									  const MatrixF32Ptr t_mat_c);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_HALF_H_
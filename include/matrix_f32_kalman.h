@@ -0,0 +1,84 @@
+/**
+ * @Date:   2026-10-19T19:48:51+08:00
+ * @Last modified time: 2026-10-19T19:48:51+08:00
+ */
+#ifndef MATRIX_F32_KALMAN_H_
+#define MATRIX_F32_KALMAN_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *	Defines the pointer to a Kalman filter with state size n and measurement size m. All workspace is allocated by
+ *	matrixf32KalmanCreate, predict and update do not allocate.
+ */
+typedef struct MatrixF32Kalman *MatrixF32KalmanPtr;
+
+/**
+ * @brief  This function creates a Kalman filter, the state starts at 0 and the covariance at identity
+ *
+ * @param  t_n State size
+ * @param  t_m Measurement size
+ * @return     MatrixF32KalmanPtr, NULL on invalid input or if the allocation fails
+ */
+MatrixF32KalmanPtr matrixf32KalmanCreate(size_t t_n, size_t t_m);
+
+/**
+ * @brief  This function destroys the Kalman filter
+ */
+MatrixStatus matrixf32KalmanDestroy(MatrixF32KalmanPtr *t_kalman);
+
+/**
+ * @brief  This function returns the state x, n x 1, owned by the filter and may be written to initialize it
+ */
+MatrixF32Ptr matrixf32KalmanGetState(MatrixF32KalmanPtr t_kalman);
+
+/**
+ * @brief  This function returns the covariance P, n x n, owned by the filter and may be written to initialize it
+ */
+MatrixF32Ptr matrixf32KalmanGetCovariance(MatrixF32KalmanPtr t_kalman);
+
+/**
+ * @brief  This function selects the covariance update, P = (I - KH) P (I - KH)^T + K R K^T (Joseph form) keeps P
+ * 				 positive definite with a suboptimal or rounded gain, P = P - K H P is cheaper. Off by default
+ */
+MatrixStatus matrixf32KalmanSetJoseph(MatrixF32KalmanPtr t_kalman, bool t_joseph);
+
+/**
+ * @brief  This function does the prediction step, x = F x (or the given state) and P = F P F^T + Q
+ *
+ * @param  t_kalman    The filter
+ * @param  t_jacobian  F, n x n
+ * @param  t_noise     Q, n x n
+ * @param  t_state     Optional, f(x) of an extended filter, n x 1. x = F x is used if NULL
+ * @return             MatrixStatus
+ *
+ * @note   Only the upper triangle of F P F^T is computed, P stays exactly symmetric
+ */
+MatrixStatus matrixf32KalmanPredict(MatrixF32KalmanPtr t_kalman, const MatrixF32Ptr t_jacobian,
+									const MatrixF32Ptr t_noise, const MatrixF32Ptr t_state);
+
+/**
+ * @brief  This function does the measurement update, the gain K = P H^T S^-1 is computed from the Cholesky
+ * 				 factor of S = H P H^T + R without forming S^-1
+ *
+ * @param  t_kalman      The filter
+ * @param  t_measurement z, m x 1
+ * @param  t_jacobian    H, m x n
+ * @param  t_noise       R, m x m
+ * @param  t_predicted   Optional, h(x) of an extended filter, m x 1. H x is used if NULL
+ * @return               MatrixStatus, MatrixStatusErrSingular if S is not positive definite, the filter is then
+ * 											 unchanged
+ */
+MatrixStatus matrixf32KalmanUpdate(MatrixF32KalmanPtr t_kalman, const MatrixF32Ptr t_measurement,
+								   const MatrixF32Ptr t_jacobian, const MatrixF32Ptr t_noise,
+								   const MatrixF32Ptr t_predicted);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_KALMAN_H_
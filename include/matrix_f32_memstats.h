@@ -0,0 +1,64 @@
+/**
+ * @Date:   2026-10-19T13:20:31+08:00
+ * @Last modified time: 2026-10-19T13:20:31+08:00
+ */
+#ifndef MATRIX_F32_MEMSTATS_H_
+#define MATRIX_F32_MEMSTATS_H_
+
+#include "matrix_f32_stats.h"
+
+typedef struct MatrixF32MemStats {
+	size_t m_liveMatrices;
+	size_t m_liveBytes;
+	size_t m_peakBytes;
+
+	uint32_t m_allocCount[MatrixF32OpCount];  // number of matrices allocated by each entry point
+	uint64_t m_allocBytes[MatrixF32OpCount];  // bytes allocated by each entry point, header included
+} MatrixF32MemStatsType;
+
+typedef struct MatrixF32LeakInfo {
+	MatrixF32Ptr m_matrix;
+	MatrixDimType m_dim;
+	size_t m_bytes;
+
+	MatrixF32Op m_createdBy;
+	uint32_t m_allocId;	 // allocation sequence number, increases monotonically
+} MatrixF32LeakInfoType;
+
+typedef void (*MatrixF32LeakCallback)(const MatrixF32LeakInfoType *t_leak, void *t_context);
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief  This function copies the memory counters
+ *
+ * @param  t_snapshot The buffer to store the counters
+ * @return            MatrixStatus
+ *
+ * @note   Counters are only recorded if the library is built with MATRIX_F32_ENABLE_MEM_STATS, otherwise the
+ * 				 snapshot is all zero. Bytes include the matrix header, buffers given to matrixf32CreateContainer are not
+ * 				 counted.
+ */
+MatrixStatus matrixf32MemStatsSnapshot(MatrixF32MemStatsType *t_snapshot);
+
+/**
+ * @brief  This function clears the per entry point counters and sets the peak to the current live bytes
+ */
+void matrixf32MemStatsReset(void);
+
+/**
+ * @brief  This function reports every matrix that has not been passed to matrixf32Destroy yet, oldest first
+ *
+ * @param  t_callback Called once per live matrix, it must not create or destroy matrices
+ * @param  t_context  Passed to t_callback as is
+ * @return            Number of live matrices
+ */
+size_t matrixf32MemReportLeaks(MatrixF32LeakCallback t_callback, void *t_context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_MEMSTATS_H_
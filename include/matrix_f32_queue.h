@@ -0,0 +1,155 @@
+/**
+ * @Date:   2026-10-19T21:12:40+08:00
+ * @Last modified time: 2026-10-19T21:12:40+08:00
+ */
+#ifndef MATRIX_F32_QUEUE_H_
+#define MATRIX_F32_QUEUE_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *	Defines the pointer to a command queue executed by worker threads (POSIX hosts). Elsewhere operations run on the
+ *	submitting thread and their futures are complete when the submit function returns.
+ *
+ *	Matrices passed to an operation must not be accessed until its future is complete, not even by another
+ *	operation that only reads them: an input may have its factor cache filled. The counters of
+ *	MATRIX_F32_ENABLE_STATS are not synchronized, memory telemetry and tracing are.
+ */
+typedef struct MatrixF32Queue *MatrixF32QueuePtr;
+
+/**
+ *	Defines the pointer to the completion handle of a submitted operation, released with matrixf32FutureRelease
+ */
+typedef struct MatrixF32Future *MatrixF32FuturePtr;
+
+/**
+ * @brief  This function creates a queue and starts its worker threads
+ *
+ * @param  t_workers Number of worker threads, at least 1
+ * @return           MatrixF32QueuePtr, NULL on invalid input or if the allocation fails
+ */
+MatrixF32QueuePtr matrixf32QueueCreate(size_t t_workers);
+
+/**
+ * @brief  This function waits for all submitted operations and destroys the queue
+ *
+ * @note   All futures of the queue must be released before
+ */
+MatrixStatus matrixf32QueueDestroy(MatrixF32QueuePtr *t_queue);
+
+/**
+ * @brief  This function waits until all submitted operations are complete
+ */
+MatrixStatus matrixf32QueueFinish(MatrixF32QueuePtr t_queue);
+
+/**
+ * @brief  This function submits a custom operation
+ *
+ * @param  t_queue     The queue
+ * @param  t_function  The operation, its return value becomes the status of the future
+ * @param  t_argument  Passed to t_function
+ * @param  t_deps      Futures of the same queue to complete first, may be NULL if t_dep_count is 0
+ * @param  t_dep_count Number of futures in t_deps
+ * @return             MatrixF32FuturePtr, NULL on invalid input or if the allocation fails
+ *
+ * @note   If a dependency fails the operation is not run and its future completes with the status of the dependency
+ */
+MatrixF32FuturePtr matrixf32QueueSubmit(MatrixF32QueuePtr t_queue, MatrixStatus (*t_function)(void *),
+										void *t_argument, const MatrixF32FuturePtr *t_deps, size_t t_dep_count);
+
+/**
+ * @brief  This function submits matrixf32Add, see matrixf32QueueSubmit for the queue arguments
+ */
+MatrixF32FuturePtr matrixf32QueueAdd(MatrixF32QueuePtr t_queue, const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b,
+									 const MatrixF32Ptr t_mat_c, const MatrixF32FuturePtr *t_deps, size_t t_dep_count);
+
+/**
+ * @brief  This function submits matrixf32Subtract, see matrixf32QueueSubmit for the queue arguments
+ */
+MatrixF32FuturePtr matrixf32QueueSubtract(MatrixF32QueuePtr t_queue, const MatrixF32Ptr t_result,
+										  const MatrixF32Ptr t_mat_b, const MatrixF32Ptr t_mat_c,
+										  const MatrixF32FuturePtr *t_deps, size_t t_dep_count);
+
+/**
+ * @brief  This function submits matrixf32Multiplication, see matrixf32QueueSubmit for the queue arguments
+ */
+MatrixF32FuturePtr matrixf32QueueMultiplication(MatrixF32QueuePtr t_queue, const MatrixF32Ptr t_result,
+												const MatrixF32Ptr t_mat_b, const MatrixF32Ptr t_mat_c,
+												const MatrixF32FuturePtr *t_deps, size_t t_dep_count);
+
+/**
+ * @brief  This function submits matrixf32Inverse, see matrixf32QueueSubmit for the queue arguments
+ */
+MatrixF32FuturePtr matrixf32QueueInverse(MatrixF32QueuePtr t_queue, const MatrixF32Ptr t_result,
+										 const MatrixF32Ptr t_source, const MatrixF32FuturePtr *t_deps,
+										 size_t t_dep_count);
+
+/**
+ * @brief  This function submits matrixf32Solve, see matrixf32QueueSubmit for the queue arguments
+ */
+MatrixF32FuturePtr matrixf32QueueSolve(MatrixF32QueuePtr t_queue, const MatrixF32Ptr t_result,
+									   const MatrixF32Ptr t_mat_a, const MatrixF32Ptr t_column,
+									   const MatrixF32FuturePtr *t_deps, size_t t_dep_count);
+
+/**
+ * @brief  This function returns whether the operation is complete, false on invalid input
+ */
+bool matrixf32FutureIsReady(MatrixF32FuturePtr t_future);
+
+/**
+ * @brief  This function blocks until the operation is complete
+ *
+ * @return MatrixStatus of the operation
+ */
+MatrixStatus matrixf32FutureWait(MatrixF32FuturePtr t_future);
+
+/**
+ * @brief  This function registers a callback run once the operation is complete, on the worker thread completing it
+ * 				 or right away on the calling thread if it already is
+ *
+ * @param  t_future   The future
+ * @param  t_callback Receives t_context and the status of the operation
+ * @param  t_context  Passed to t_callback
+ * @return            MatrixStatus, MatrixStatusErrUnknownOpt if a callback is already registered
+ */
+MatrixStatus matrixf32FutureThen(MatrixF32FuturePtr t_future, void (*t_callback)(void *, MatrixStatus),
+								 void *t_context);
+
+/**
+ * @brief  This function releases the handle, the operation still runs if it is not complete
+ */
+MatrixStatus matrixf32FutureRelease(MatrixF32FuturePtr *t_future);
+
+#ifdef __cplusplus
+}
+#endif
+
+#if defined(__cplusplus) && defined(__cpp_impl_coroutine)
+#include <coroutine>
+
+/**
+ *	co_await matrixf32Await(future) suspends the coroutine until the future is complete and yields its MatrixStatus.
+ *	The coroutine resumes on the worker thread completing the future. The future is not released.
+ */
+struct MatrixF32FutureAwaiter {
+	MatrixF32FuturePtr m_future;
+
+	bool await_ready() const noexcept { return matrixf32FutureIsReady(m_future); }
+
+	bool await_suspend(std::coroutine_handle<> t_handle) const noexcept {
+		auto resume = [](void *t_context, MatrixStatus) { std::coroutine_handle<>::from_address(t_context).resume(); };
+
+		return matrixf32FutureThen(m_future, resume, t_handle.address()) == MatrixStatusOK;
+	}
+
+	MatrixStatus await_resume() const noexcept { return matrixf32FutureWait(m_future); }
+};
+
+inline MatrixF32FutureAwaiter matrixf32Await(MatrixF32FuturePtr t_future) { return MatrixF32FutureAwaiter{t_future}; }
+#endif
+
+#endif	// MATRIX_F32_QUEUE_H_
@@ -0,0 +1,81 @@
+/**
+ * @Date:   2026-10-20T14:52:40+08:00
+ * @Last modified time: 2026-10-20T14:52:40+08:00
+ */
+#ifndef MATRIX_F32_REDUCE_H_
+#define MATRIX_F32_REDUCE_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *	Reductions over the raw buffer of a matrix in either layout. Sums are taken over fixed blocks of
+ *	MATRIX_F32_REDUCE_BLOCK entries with independent (SSE or NEON) accumulators, and the block sums are added
+ *	pairwise, so the error grows with log n instead of n. The blocks and the order in which they are combined only
+ *	depend on the dimensions: with -DENABLE_OPENMP=ON large matrices are reduced in parallel and the results are
+ *	bitwise identical for any number of threads. NaN entries propagate to the norms and sums they enter.
+ */
+
+typedef enum {
+	MatrixNormFrobenius = 0,  // square root of the sum of squares, rescaled if it overflows or underflows
+	MatrixNormOne,			  // largest absolute column sum
+	MatrixNormInf,			  // largest absolute row sum
+	MatrixNormMax,			  // largest absolute entry
+} MatrixNormType;
+
+/**
+ * @brief  This function computes a norm of t_mat
+ *
+ * @param  t_result Norm
+ * @param  t_mat    Matrix
+ * @param  t_type   Which norm, MatrixStatusErrUnknownOpt if out of range
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32Norm(float *t_result, const MatrixF32Ptr t_mat, MatrixNormType t_type);
+
+/**
+ * @brief  This function computes the sum of all entries of t_mat
+ *
+ * @param  t_result Sum
+ * @param  t_mat    Matrix
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32Sum(float *t_result, const MatrixF32Ptr t_mat);
+
+/**
+ * @brief  This function computes the sum of the diagonal of t_mat
+ *
+ * @param  t_result Trace
+ * @param  t_mat    Square matrix
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32Trace(float *t_result, const MatrixF32Ptr t_mat);
+
+/**
+ * @brief  This function computes the sum of every row of t_mat, likewise matrixf32ColSums of every column
+ *
+ * @param  t_result Vector of length m (n for matrixf32ColSums), must not overlap t_mat
+ * @param  t_mat    m x n matrix
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32RowSums(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat);
+MatrixStatus matrixf32ColSums(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat);
+
+/**
+ * @brief  This function finds the largest entry of t_mat, or the one of largest magnitude
+ *
+ * @param  t_index    Row and column of the entry, the first in row-major order on ties and the first NaN if any
+ * @param  t_mat      Matrix
+ * @param  t_absolute Compare magnitudes instead of values
+ * @return            MatrixStatus
+ */
+MatrixStatus matrixf32ArgMax(MatrixDimType *t_index, const MatrixF32Ptr t_mat, bool t_absolute);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_REDUCE_H_
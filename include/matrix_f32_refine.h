@@ -0,0 +1,53 @@
+/**
+ * @Date:   2026-10-19T23:04:26+08:00
+ * @Last modified time: 2026-10-19T23:04:26+08:00
+ */
+#ifndef MATRIX_F32_REFINE_H_
+#define MATRIX_F32_REFINE_H_
+
+#include "matrix_f32.h"
+
+/**
+ *	Outcome of matrixf32SolveRefined
+ */
+typedef struct MatrixF32RefineReport {
+	size_t m_iterations;	  // refinement steps on the float factorization
+	double m_backwardError;	  // largest ||b - A x|| / (||A|| ||x|| + ||b||) of the columns, infinity norm, in double
+	bool m_converged;		  // the residual is at the rounding level of double
+	bool m_fallback;		  // refinement stalled and the system was factorized again in double
+} MatrixF32RefineReport;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief  This function solves A * X = B with mixed-precision iterative refinement. A is factorized once in float
+ * 				 with the LU elimination of the native backend, then the residual B - A * X is accumulated in double
+ * 				 and the correction solved with the float factors until the residual reaches the rounding level of
+ * 				 double. Each step costs O(n^2) against the O(n^3) of the factorization.
+ *
+ * 				 If a pivot of the float factors is at most n * FLT_EPSILON * ||A||, if the corrections stop
+ * 				 shrinking, typically because A is too ill-conditioned for a float factorization, or after
+ * 				 MATRIX_F32_REFINE_MAX_ITERATIONS steps, A is factorized again in double precision and solved with
+ * 				 it. Neither test depends on the scale of A.
+ *
+ * @param  t_result   X rounded to float, n x k. Must not be the same as t_column
+ * @param  t_mat_a    A, n x n
+ * @param  t_column   B, n x k
+ * @param  t_solution Buffer of n x k doubles receiving X in double precision, row-major, may be NULL
+ * @param  t_report   Receives the outcome, may be NULL
+ * @return            MatrixStatus, MatrixStatusErrSingular if the double factorization meets a zero pivot,
+ * 										MatrixStatusErrNullPtr if the allocation fails
+ *
+ * @note   The workspace is allocated for the call, n x n floats for the factors and n x k doubles and floats for
+ * 				 the iterates, plus n x n doubles on fallback
+ */
+MatrixStatus matrixf32SolveRefined(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_a,
+								   const MatrixF32Ptr t_column, double *t_solution, MatrixF32RefineReport *t_report);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_REFINE_H_
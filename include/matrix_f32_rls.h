@@ -0,0 +1,90 @@
+/**
+ * @Date:   2026-10-19T19:02:16+08:00
+ * @Last modified time: 2026-10-19T19:02:16+08:00
+ */
+#ifndef MATRIX_F32_RLS_H_
+#define MATRIX_F32_RLS_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief  This function updates an inverse in place to the inverse of a rank-1 modified matrix in O(n^2)
+ * 				 (Sherman-Morrison), i.e. A^-1 becomes (A + u * v^T)^-1
+ *
+ * @param  t_inverse A^-1, n x n
+ * @param  t_u       u, n x 1
+ * @param  t_v       v, n x 1
+ * @param  t_work    Workspace of at least 2 * n entries
+ * @return           MatrixStatus, MatrixStatusErrSingular if A + u * v^T is singular, t_inverse is then unchanged
+ */
+MatrixStatus matrixf32ShermanMorrison(const MatrixF32Ptr t_inverse, const MatrixF32Ptr t_u, const MatrixF32Ptr t_v,
+									  const MatrixF32Ptr t_work);
+
+/**
+ * @brief  This function updates an inverse in place to the inverse of a rank-k modified matrix in O(k * n^2)
+ * 				 (Woodbury), i.e. A^-1 becomes (A + U * V^T)^-1
+ *
+ * @param  t_inverse A^-1, n x n
+ * @param  t_u       U, n x k
+ * @param  t_v       V, n x k
+ * @param  t_work    Workspace of at least 2 * n entries
+ * @return           MatrixStatus, MatrixStatusErrSingular if one of the intermediate rank-1 updates is singular, the
+ * 									 columns before it have been applied
+ *
+ * @note   The update is applied one column pair at a time, which needs no k x k inverse
+ */
+MatrixStatus matrixf32Woodbury(const MatrixF32Ptr t_inverse, const MatrixF32Ptr t_u, const MatrixF32Ptr t_v,
+							   const MatrixF32Ptr t_work);
+
+/**
+ *	Defines the pointer to a recursive least squares estimator of y = phi^T * theta
+ */
+typedef struct MatrixF32Rls *MatrixF32RlsPtr;
+
+/**
+ * @brief  This function creates a recursive least squares estimator, theta starts at 0 and P at delta * I
+ *
+ * @param  t_n          Number of parameters
+ * @param  t_forgetting Forgetting factor lambda in (0, 1], 1 weights all samples equally
+ * @param  t_delta      Initial covariance, large for an uninformed start
+ * @return              MatrixF32RlsPtr, NULL on invalid input or if the allocation fails
+ */
+MatrixF32RlsPtr matrixf32RlsCreate(size_t t_n, float t_forgetting, float t_delta);
+
+/**
+ * @brief  This function destroys the estimator
+ */
+MatrixStatus matrixf32RlsDestroy(MatrixF32RlsPtr *t_rls);
+
+/**
+ * @brief  This function adds one measurement in O(n^2) without allocation, P is updated with matrixf32ShermanMorrison
+ *
+ * @param  t_rls         The estimator
+ * @param  t_regressor   phi, n x 1
+ * @param  t_measurement y
+ * @param  t_error       Optional, the a priori error y - phi^T * theta
+ * @return               MatrixStatus, MatrixStatusErrSingular if the update of P is singular, the estimator is then
+ * 											 unchanged
+ */
+MatrixStatus matrixf32RlsUpdate(MatrixF32RlsPtr t_rls, const MatrixF32Ptr t_regressor, float t_measurement,
+								float *t_error);
+
+/**
+ * @brief  This function returns the parameter estimate theta, n x 1, owned by the estimator
+ */
+MatrixF32Ptr matrixf32RlsGetParameter(MatrixF32RlsPtr t_rls);
+
+/**
+ * @brief  This function returns the covariance P, n x n, owned by the estimator
+ */
+MatrixF32Ptr matrixf32RlsGetCovariance(MatrixF32RlsPtr t_rls);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_RLS_H_
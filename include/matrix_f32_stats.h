@@ -0,0 +1,94 @@
+/**
+ * @Date:   2026-10-19T09:30:02+08:00
+ * @Last modified time: 2026-10-19T09:30:02+08:00
+ */
+#ifndef MATRIX_F32_STATS_H_
+#define MATRIX_F32_STATS_H_
+
+#include "matrix_f32.h"
+
+#include <stdint.h>
+
+/**
+ *	Public entry points that are recorded by the instrumentation layer
+ */
+typedef enum {
+	MatrixF32OpCreate = 0,
+	MatrixF32OpCreateContainer,
+	MatrixF32OpDestroy,
+	MatrixF32OpGetColNumber,
+	MatrixF32OpGetRowNumber,
+	MatrixF32OpGetOwnership,
+	MatrixF32OpGetValueAt,
+	MatrixF32OpGetBuffer,
+	MatrixF32OpSetValueAt,
+	MatrixF32OpSetAllEntriesTo,
+	MatrixF32OpTwoMatEqual,
+	MatrixF32OpAdd,
+	MatrixF32OpScale,
+	MatrixF32OpSubtract,
+	MatrixF32OpMultiplication,
+	MatrixF32OpCopy,
+	MatrixF32OpSwap,
+	MatrixF32OpInPlaceLU,
+	MatrixF32OpOutPlaceLU,
+	MatrixF32OpForwardSubstitution,
+	MatrixF32OpBackwardSubstitution,
+	MatrixF32OpInverse,
+	MatrixF32OpGetVersion,
+	MatrixF32OpSetFactorCache,
+	MatrixF32OpSolve,
+	MatrixF32OpGetLayout,
+	MatrixF32OpCount
+} MatrixF32Op;
+
+typedef struct MatrixF32OpStats {
+	uint32_t m_callCount;
+
+	uint64_t m_totalCycles;
+	uint64_t m_minCycles;
+	uint64_t m_maxCycles;
+
+	uint64_t m_flops;
+	uint64_t m_bytes;
+} MatrixF32OpStatsType;
+
+typedef struct MatrixF32Stats {
+	MatrixF32OpStatsType m_op[MatrixF32OpCount];
+} MatrixF32StatsType;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief  This function returns the name of the public entry point
+ *
+ * @param  t_op The entry point
+ * @return      Name of the entry point, "Unknown" if t_op is out of range
+ */
+const char *matrixf32OpName(MatrixF32Op t_op);
+
+/**
+ * @brief  This function copies the counters recorded so far
+ *
+ * @param  t_snapshot The buffer to store the counters
+ * @return            MatrixStatus
+ *
+ * @note   Counters are only recorded if the library is built with MATRIX_F32_ENABLE_STATS, otherwise the snapshot is
+ * 				 all zero. Only calls that complete successfully are recorded. Cycles are DWT CYCCNT ticks on Cortex-M,
+ * 				 TSC ticks on x86 and nanoseconds elsewhere. Counters are not synchronized, take the snapshot while no
+ * 				 other thread is calling into the library.
+ */
+MatrixStatus matrixf32StatsSnapshot(MatrixF32StatsType *t_snapshot);
+
+/**
+ * @brief  This function clears all the counters
+ */
+void matrixf32StatsReset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_STATS_H_
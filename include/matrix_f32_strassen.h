@@ -0,0 +1,54 @@
+/**
+ * @Date:   2026-10-20T01:02:47+08:00
+ * @Last modified time: 2026-10-20T01:02:47+08:00
+ */
+#ifndef MATRIX_F32_STRASSEN_H_
+#define MATRIX_F32_STRASSEN_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// dimension at or below which the recursion falls back to the blocked kernel, used when a cutoff of 0 is given
+#ifndef MATRIX_F32_STRASSEN_CUTOFF
+#define MATRIX_F32_STRASSEN_CUTOFF 256
+#endif
+
+/**
+ * @brief  This function returns the number of floats of workspace matrixf32StrassenMultiplication needs
+ *
+ * @param  t_n      Dimension of the square operands
+ * @param  t_cutoff Recursion cutoff, 0 for MATRIX_F32_STRASSEN_CUTOFF
+ * @return          Number of floats, about 2n^2 / 3 and 0 if t_n is at or below the cutoff
+ */
+size_t matrixf32StrassenWorkspaceLen(size_t t_n, size_t t_cutoff);
+
+/**
+ * @brief  This function computes t_dest = t_mat_b * t_mat_c for square matrices with the Strassen-Winograd
+ * 				 recursion, 7 half-size products and 15 additions per level, O(n^2.81) instead of O(n^3). Halves of
+ * 				 odd dimension peel off the last row and column and fix them up with the blocked kernel, which also
+ * 				 computes every product of dimension at most t_cutoff.
+ *
+ * @note   The result is not bitwise equal to matrixf32Multiplication and its error bound grows faster with n, as
+ * 				 about (n / cutoff)^log2(18) * cutoff^2 * eps * max|B| * max|C| instead of n * eps * max|B| * max|C|.
+ * 				 It is therefore only used when called explicitly. t_dest must not overlap the operands.
+ *
+ * @param  t_dest          n x n result
+ * @param  t_mat_b         n x n
+ * @param  t_mat_c         n x n
+ * @param  t_cutoff        Recursion cutoff, 0 for MATRIX_F32_STRASSEN_CUTOFF
+ * @param  t_workspace     Caller workspace, no memory is allocated. May be NULL if the length required is 0
+ * @param  t_workspace_len Length of t_workspace in floats, see matrixf32StrassenWorkspaceLen
+ * @return                 MatrixStatus, MatrixStatusErrOutOfBound if the workspace is too small
+ */
+MatrixStatus matrixf32StrassenMultiplication(const MatrixF32Ptr t_dest, const MatrixF32Ptr t_mat_b,
+											 const MatrixF32Ptr t_mat_c, size_t t_cutoff, float *t_workspace,
+											 size_t t_workspace_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_STRASSEN_H_
@@ -0,0 +1,74 @@
+/**
+ * @Date:   2026-10-19T17:30:05+08:00
+ * @Last modified time: 2026-10-19T17:30:05+08:00
+ */
+#ifndef MATRIX_F32_STREAM_H_
+#define MATRIX_F32_STREAM_H_
+
+#include "matrix_f32.h"
+
+typedef enum {
+	MatrixF32StreamCSV = 0,	 // one row per line, comma separated
+	MatrixF32StreamRaw,		 // little endian float rows back to back, no header
+} MatrixF32StreamFormat;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *	Defines the pointer to a row reader over a CSV or raw float file
+ */
+typedef struct MatrixF32Stream *MatrixF32StreamPtr;
+
+/**
+ * @brief  This function opens a file for row by row ingestion
+ *
+ * @param  t_path   Path of the file
+ * @param  t_format MatrixF32StreamCSV or MatrixF32StreamRaw
+ * @param  t_col    Number of values per row, 0 lets a CSV stream take it from the first row
+ * @return          MatrixF32StreamPtr, NULL if the file can not be opened or t_col is unknown
+ *
+ * @note   Empty lines and lines starting with '#' are skipped in CSV. A first line that does not start with a digit,
+ * 				 a sign or '.' is taken as a header and skipped as well. A line must fit into MATRIX_F32_STREAM_CHUNK bytes.
+ */
+MatrixF32StreamPtr matrixf32StreamOpen(const char *t_path, MatrixF32StreamFormat t_format, size_t t_col);
+
+/**
+ * @brief  This function closes the file and destroys the stream
+ */
+MatrixStatus matrixf32StreamClose(MatrixF32StreamPtr *t_stream);
+
+/**
+ * @brief  This function returns the number of values per row
+ */
+size_t matrixf32StreamGetColNumber(MatrixF32StreamPtr t_stream);
+
+/**
+ * @brief  This function parses the next rows of the stream straight into the buffer of an existing matrix
+ *
+ * @param  t_stream    The stream
+ * @param  t_dest      The matrix to fill, the column number must match the stream
+ * @param  t_first_row The first row of t_dest to fill, rows t_first_row ... row - 1 are filled
+ * @param  t_rows_read Optional, number of rows filled, fewer than requested at the end of the stream
+ * @return             MatrixStatus, MatrixStatusErrIO on a read error or a malformed row
+ */
+MatrixStatus matrixf32StreamRead(MatrixF32StreamPtr t_stream, const MatrixF32Ptr t_dest, size_t t_first_row,
+								 size_t *t_rows_read);
+
+/**
+ * @brief  This function reads the rest of the stream into a new matrix that grows as rows are appended
+ *
+ * @param  t_stream The stream
+ * @param  t_dest   The new matrix, the caller destroys it. NULL on failure
+ * @return          MatrixStatus, MatrixStatusErrDimMismatch if no row is left
+ *
+ * @note   The row capacity is doubled whenever it is exhausted, the buffer may be up to twice the size of the matrix
+ */
+MatrixStatus matrixf32StreamReadAll(MatrixF32StreamPtr t_stream, MatrixF32Ptr *t_dest);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_STREAM_H_
@@ -0,0 +1,78 @@
+/**
+ * @Date:   2026-10-20T00:18:33+08:00
+ * @Last modified time: 2026-10-20T00:18:33+08:00
+ */
+#ifndef MATRIX_F32_SVD_H_
+#define MATRIX_F32_SVD_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief  This function returns the number of floats of workspace the functions of this header need for an m x n
+ * 				 matrix
+ *
+ * @param  t_row Row number m of the matrix
+ * @param  t_col Column number n of the matrix
+ * @return       Number of floats, 0 if a dimension is 0
+ */
+size_t matrixf32SvdWorkspaceLen(size_t t_row, size_t t_col);
+
+/**
+ * @brief  This function computes the thin singular value decomposition A = U * S * V^T by one-sided Jacobi
+ * 				 rotations, r = min(m, n). Matrices with m >= 2n are first reduced to their n x n triangular factor
+ * 				 by a Householder QR decomposition, so the rotations work on n instead of m entries.
+ *
+ * 				 The columns are kept contiguous and rotated in round-robin order, each round rotating r / 2
+ * 				 disjoint pairs. With OpenMP (ENABLE_OPENMP) the pairs of a round run in parallel.
+ *
+ * @param  t_u             m x r left singular vectors, may be NULL. Columns of zero singular values are 0
+ * @param  t_s             r x 1 singular values in descending order
+ * @param  t_v             n x r right singular vectors, may be NULL
+ * @param  t_source        A, m x n
+ * @param  t_workspace     Caller workspace, no memory is allocated
+ * @param  t_workspace_len Length of t_workspace in floats, see matrixf32SvdWorkspaceLen
+ * @return                 MatrixStatus, MatrixStatusErrOutOfBound if the workspace is too small,
+ * 												 MatrixStatusErrSingular if the rotations do not converge
+ */
+MatrixStatus matrixf32Svd(const MatrixF32Ptr t_u, const MatrixF32Ptr t_s, const MatrixF32Ptr t_v,
+						  const MatrixF32Ptr t_source, float *t_workspace, size_t t_workspace_len);
+
+/**
+ * @brief  This function computes the pseudo-inverse V * S^+ * U^T. Singular values up to t_tolerance times the
+ * 				 largest one are treated as 0, so it is defined for rank-deficient and non-square matrices
+ *
+ * @param  t_result        n x m pseudo-inverse
+ * @param  t_source        A, m x n
+ * @param  t_tolerance     Relative truncation threshold, max(m, n) * FLT_EPSILON if not positive
+ * @param  t_workspace     Caller workspace, see matrixf32SvdWorkspaceLen
+ * @param  t_workspace_len Length of t_workspace in floats
+ * @return                 MatrixStatus, see matrixf32Svd
+ */
+MatrixStatus matrixf32PseudoInverse(const MatrixF32Ptr t_result, const MatrixF32Ptr t_source, float t_tolerance,
+									float *t_workspace, size_t t_workspace_len);
+
+/**
+ * @brief  This function computes the minimum norm least squares solution X of A * X = B, i.e. X = A^+ * B, without
+ * 				 forming the pseudo-inverse
+ *
+ * @param  t_result        X, n x k
+ * @param  t_mat_a         A, m x n
+ * @param  t_column        B, m x k
+ * @param  t_tolerance     Relative truncation threshold, see matrixf32PseudoInverse
+ * @param  t_workspace     Caller workspace, see matrixf32SvdWorkspaceLen
+ * @param  t_workspace_len Length of t_workspace in floats
+ * @return                 MatrixStatus, see matrixf32Svd
+ */
+MatrixStatus matrixf32LeastSquares(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_a,
+								   const MatrixF32Ptr t_column, float t_tolerance, float *t_workspace,
+								   size_t t_workspace_len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_SVD_H_
@@ -0,0 +1,106 @@
+/**
+ * @Date:   2026-10-19T16:45:37+08:00
+ * @Last modified time: 2026-10-19T16:45:37+08:00
+ */
+#ifndef MATRIX_F32_TILED_H_
+#define MATRIX_F32_TILED_H_
+
+#include "matrix_f32.h"
+
+#include <stdint.h>
+
+typedef struct MatrixF32TiledIO {
+	uint64_t m_bytesRead;
+	uint64_t m_bytesWritten;
+} MatrixF32TiledIOType;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *	Defines the pointer to a matrix that lives in a binary matrix file (see matrix_f32_file.h) and is accessed through
+ *	a cache of square tiles
+ */
+typedef struct MatrixF32Tiled *MatrixF32TiledPtr;
+
+/**
+ * @brief  This function suggests a tile size for the given memory budget, such that the three tiles a multiplication
+ * 				 works on fit into it
+ *
+ * @param  t_memory_bytes Memory budget for the tile caches
+ * @return                Tile size, a multiple of 16 and at least 16
+ */
+size_t matrixf32TiledSuggestTileSize(size_t t_memory_bytes);
+
+/**
+ * @brief  This function creates a new zero filled binary matrix file and opens it for tiled access
+ *
+ * @param  t_path        Path of the file, an existing file is overwritten
+ * @param  t_dim         Column and row of the matrix
+ * @param  t_tile        Tile size, a tile is t_tile x t_tile floats
+ * @param  t_cache_tiles Number of tiles cached in memory, at least 2
+ * @return               MatrixF32TiledPtr, NULL on failure
+ */
+MatrixF32TiledPtr matrixf32TiledCreate(const char *t_path, MatrixDimType t_dim, size_t t_tile, size_t t_cache_tiles);
+
+/**
+ * @brief  This function opens an existing binary matrix file for tiled access, the file is modified in place
+ *
+ * @param  t_path        Path of the file
+ * @param  t_tile        Tile size, a tile is t_tile x t_tile floats
+ * @param  t_cache_tiles Number of tiles cached in memory, at least 2
+ * @return               MatrixF32TiledPtr, NULL on failure
+ */
+MatrixF32TiledPtr matrixf32TiledOpen(const char *t_path, size_t t_tile, size_t t_cache_tiles);
+
+/**
+ * @brief  This function writes back the cached tiles, updates the checksum of the file if it was modified and closes it
+ *
+ * @param  t_tiled The tiled matrix to be closed
+ * @return         MatrixStatus
+ */
+MatrixStatus matrixf32TiledClose(MatrixF32TiledPtr *t_tiled);
+
+/**
+ * @brief  This function returns the dimension of the tiled matrix
+ */
+MatrixDimType matrixf32TiledGetDim(MatrixF32TiledPtr t_tiled);
+
+/**
+ * @brief  This function returns the number of bytes read from and written to the file so far
+ */
+MatrixF32TiledIOType matrixf32TiledGetIO(MatrixF32TiledPtr t_tiled);
+
+/**
+ * @brief  This function multiplicates two tiled matrix and store to the other tiled matrix, tile by tile
+ *
+ * @param  t_result The tiled matrix to store the result, must not be one of the operands
+ * @param  t_mat_b  Multiplicand B
+ * @param  t_mat_c  Multiplier C
+ * @return          MatrixStatus, MatrixStatusErrUnknownOpt when t_result is one of the operands
+ *
+ * @note   All three must have the same tile size T, each needs one cache slot. The file traffic is about
+ * 				 2 * m * n * k / T floats, compared to m * n * k for a row by column loop.
+ */
+MatrixStatus matrixf32TiledMultiplication(const MatrixF32TiledPtr t_result, const MatrixF32TiledPtr t_mat_b,
+										  const MatrixF32TiledPtr t_mat_c);
+
+/**
+ * @brief  This function does LU decomposition with partial pivoting in place, block column by block column
+ * 				 (left-looking). The result takes the same form as matrixf32InPlaceLU
+ *
+ * @param  t_dest_and_source The tiled matrix to be decomposed, must be square
+ * @param  t_permutation     In-core column vector, row i of the result is row t_permutation[i] of the source
+ * @return                   MatrixStatus
+ *
+ * @note   One block column (row x T floats) is held in memory besides the tile cache. The file traffic is about
+ * 				 n^3 / (3T) floats.
+ */
+MatrixStatus matrixf32TiledLU(const MatrixF32TiledPtr t_dest_and_source, const MatrixF32Ptr t_permutation);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_TILED_H_
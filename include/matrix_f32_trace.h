@@ -0,0 +1,37 @@
+/**
+ * @Date:   2026-10-19T11:05:48+08:00
+ * @Last modified time: 2026-10-19T11:05:48+08:00
+ */
+#ifndef MATRIX_F32_TRACE_H_
+#define MATRIX_F32_TRACE_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief  This function writes the recorded spans of all threads to a Chrome trace JSON file, the file can be opened
+ * 				 with chrome://tracing or ui.perfetto.dev
+ *
+ * @param  t_path Path of the JSON file
+ * @return        MatrixStatus, MatrixStatusErrIO if the file can not be written
+ *
+ * @note   Spans are only recorded if the library is built with MATRIX_F32_ENABLE_TRACE. Each thread records into its
+ * 				 own ring buffer of MATRIX_F32_TRACE_CAPACITY spans, the oldest spans are overwritten when it is full. Spans
+ * 				 that are being overwritten while flushing may be torn, flush while the library is idle for an exact
+ * 				 trace.
+ */
+MatrixStatus matrixf32TraceFlush(const char *t_path);
+
+/**
+ * @brief  This function discards the spans recorded so far
+ */
+void matrixf32TraceReset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_TRACE_H_
@@ -0,0 +1,109 @@
+/**
+ * @Date:   2026-10-19T18:20:44+08:00
+ * @Last modified time: 2026-10-19T18:20:44+08:00
+ */
+#ifndef MATRIX_F32_WINDOW_H_
+#define MATRIX_F32_WINDOW_H_
+
+#include "matrix_f32.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ *	Defines the pointer to a sliding window over the last N rows of a stream. The rows are stored in a ring buffer,
+ *	logical row 0 is the oldest one. A row never wraps, so the window is at most two contiguous row ranges.
+ */
+typedef struct MatrixF32Window *MatrixF32WindowPtr;
+
+/**
+ * @brief  This function creates an empty window
+ *
+ * @param  t_capacity Number of rows kept, the oldest row is dropped once it is full
+ * @param  t_col      Number of values per row
+ * @return            MatrixF32WindowPtr, NULL if the dimension is invalid or the allocation fails
+ */
+MatrixF32WindowPtr matrixf32WindowCreate(size_t t_capacity, size_t t_col);
+
+/**
+ * @brief  This function destroys the window
+ */
+MatrixStatus matrixf32WindowDestroy(MatrixF32WindowPtr *t_window);
+
+/**
+ * @brief  This function returns the number of rows currently in the window, at most the capacity
+ */
+size_t matrixf32WindowGetRowNumber(MatrixF32WindowPtr t_window);
+
+/**
+ * @brief  This function returns the number of values per row
+ */
+size_t matrixf32WindowGetColNumber(MatrixF32WindowPtr t_window);
+
+/**
+ * @brief  This function appends a row, dropping the oldest row if the window is full. Only the new row is copied.
+ *
+ * @param  t_window The window
+ * @param  t_row    Column number values
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32WindowPush(MatrixF32WindowPtr t_window, const float *t_row);
+
+/**
+ * @brief  This function removes all rows
+ */
+MatrixStatus matrixf32WindowClear(MatrixF32WindowPtr t_window);
+
+/**
+ * @brief  This function returns the values of a row
+ *
+ * @param  t_window The window
+ * @param  t_row    Logical row, 0 is the oldest
+ * @return          Pointer to column number values, valid until the row is dropped. NULL if t_row is out of bound
+ */
+const float *matrixf32WindowGetRow(MatrixF32WindowPtr t_window, size_t t_row);
+
+/**
+ * @brief  This function copies the rows into a matrix in logical order
+ *
+ * @param  t_result The matrix to store the rows, row number x column number
+ * @param  t_window The window
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32WindowCopyTo(const MatrixF32Ptr t_result, MatrixF32WindowPtr t_window);
+
+/**
+ * @brief  This function multiplicates the window with a matrix, the result rows are in logical order
+ *
+ * @param  t_result The buffer to store the result, row number of the window x column of t_mat_c
+ * @param  t_window Multiplicand, must not be empty
+ * @param  t_mat_c  Multiplier
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32WindowMultiplication(const MatrixF32Ptr t_result, MatrixF32WindowPtr t_window,
+										   const MatrixF32Ptr t_mat_c);
+
+/**
+ * @brief  This function computes the mean of every column
+ *
+ * @param  t_result The buffer to store the mean, 1 x column number
+ * @param  t_window The window, must not be empty
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32WindowMean(const MatrixF32Ptr t_result, MatrixF32WindowPtr t_window);
+
+/**
+ * @brief  This function computes the sample covariance of the columns, normalized by row number - 1
+ *
+ * @param  t_result The buffer to store the covariance, column number x column number
+ * @param  t_window The window, must hold at least two rows
+ * @return          MatrixStatus
+ */
+MatrixStatus matrixf32WindowCovariance(const MatrixF32Ptr t_result, MatrixF32WindowPtr t_window);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif	// MATRIX_F32_WINDOW_H_
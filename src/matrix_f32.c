@@ -6,20 +6,13 @@
 #include "util/runtime_error.h"
 
 #include "include/matrix_f32.h"
+#include "src/matrix_f32_instrument.h"
+#include "src/matrix_f32_private.h"
 
 #include <math.h>
 #include <stdarg.h>
-#include <stdlib.h>
 #include <string.h>
 
-struct MatrixF32 {
-	size_t m_row;
-	size_t m_col;
-
-	float *m_val;
-	AddrOwnerShip m_addrOwnerShip;
-};
-
 // private function
 static inline bool m_matrixf32HaveNullPtr(int t_argc, ...) {
 	va_list list;
@@ -94,120 +87,312 @@ static inline bool m_matrixf32InitWithInvalidDimension(MatrixDimType t_dim) {
 
 static inline size_t m_matrixf32TotalSize(const MatrixF32Ptr t_target) { return t_target->m_row * t_target->m_col; }
 
-MatrixF32Ptr matrixf32Create(MatrixDimType t_dim) {
-	MatrixF32Ptr mat_ptr = malloc(sizeof(struct MatrixF32));
+static inline size_t m_matrixf32Offset(const MatrixF32Ptr t_target, size_t t_row, size_t t_col) {
+	return t_row * m_matrixf32RowStride(t_target) + t_col * m_matrixf32ColStride(t_target);
+}
+
+// whether the matrices of the same dimension store every entry at the same position of their buffers
+static inline bool m_matrixf32SameStorage(int t_argc, ...) {
+	va_list list;
+	va_start(list, t_argc);
+
+	MatrixF32Ptr to_compare = va_arg(list, MatrixF32Ptr);
+	bool same = true;
+
+	for (int i = 1; i < t_argc && !m_matrixf32IsVector(to_compare); ++i) {
+		MatrixF32Ptr be_compared = va_arg(list, MatrixF32Ptr);
+
+		if (be_compared->m_layout != to_compare->m_layout) same = false;
+	}
+
+	va_end(list);
+
+	return same;
+}
+
+#ifdef MATRIX_F32_ENABLE_STATS
+// sum of (k divisions + 2k^2 multiply-subtract) for k = 1 ... n - 1
+static inline uint64_t m_matrixf32LUFlops(uint64_t t_n) {
+	return t_n * (t_n - 1) / 2 + (t_n - 1) * t_n * (2 * t_n - 1) / 3;
+}
+#endif
+
+// copies the entries of t_source to t_dest of the same dimension, transposing the buffer if the layouts differ
+static void m_matrixf32CopyEntries(const MatrixF32Ptr t_dest, const MatrixF32Ptr t_source) {
+	if (m_matrixf32SameStorage(2, t_dest, t_source)) {
+		memcpy(t_dest->m_val, t_source->m_val, m_matrixf32TotalSize(t_source) * sizeof(float));
+
+		return;
+	}
+
+	for (size_t i = 0; i < t_source->m_row; ++i) {
+		for (size_t j = 0; j < t_source->m_col; ++j) {
+			t_dest->m_val[m_matrixf32Offset(t_dest, i, j)] = t_source->m_val[m_matrixf32Offset(t_source, i, j)];
+		}
+	}
+}
+
+// t_source itself if its buffer is already ordered as t_layout, otherwise a copy in t_layout the caller destroys
+static MatrixF32Ptr m_matrixf32InLayout(const MatrixF32Ptr t_source, MatrixLayout t_layout, MatrixF32Op t_op) {
+	if (t_source->m_layout == t_layout || m_matrixf32IsVector(t_source)) return t_source;
+
+	MatrixF32Ptr copy = m_matrixf32CreateFor((MatrixDimType){t_source->m_row, t_source->m_col}, t_op);
+
+	if (copy != 0 && copy->m_val == 0) matrixf32Destroy(&copy);
+	if (copy == 0) return 0;
+
+	copy->m_layout = t_layout;
+	m_matrixf32CopyEntries(copy, t_source);
+
+	return copy;
+}
+
+MatrixF32Ptr m_matrixf32CreateFor(MatrixDimType t_dim, MatrixF32Op t_op) {
+	MatrixF32Ptr mat_ptr = MATRIX_F32_MALLOC(sizeof(struct MatrixF32));
 
 	if (mat_ptr != 0) {
 		if (m_matrixf32InitWithInvalidDimension(t_dim)) {
 			THROW("Matrix Error: Invalid dimension", MatrixStatusErrDimMismatch);
+			MATRIX_F32_FREE(mat_ptr);
+
+			return 0;
 		}
 
 		mat_ptr->m_row = t_dim.m_row;
 		mat_ptr->m_col = t_dim.m_col;
 
 		mat_ptr->m_addrOwnerShip = OwnerShipSelf;
+		mat_ptr->m_layout = MatrixLayoutRowMajor;
+		mat_ptr->m_version = 0;
+		mat_ptr->m_cache = 0;
 		size_t buff_size = mat_ptr->m_row * mat_ptr->m_col * sizeof(float);
-		void *block = malloc(buff_size);
+		void *block = MATRIX_F32_MALLOC(buff_size);
 		mat_ptr->m_val = (float *)block;
 
 		if (block != 0) {
 			memset(mat_ptr->m_val, 0, buff_size);
+			MATRIX_F32_MEM_TRACK(mat_ptr, t_op, sizeof(struct MatrixF32) + buff_size);
+		} else {
+			MATRIX_F32_MEM_TRACK(mat_ptr, t_op, sizeof(struct MatrixF32));
 		}
 	}
 
 	return mat_ptr;
 }
 
-MatrixF32Ptr matrixf32CreateContainer(MatrixDimType t_dim, float *t_val, int t_buffer_len) {
-	MatrixF32Ptr mat_ptr = malloc(sizeof(struct MatrixF32));
+MatrixF32Ptr matrixf32Create(MatrixDimType t_dim) { return matrixf32CreateWithLayout(t_dim, MatrixLayoutRowMajor); }
 
-	if (mat_ptr != 0) {
-		if ((int)(t_dim.m_row * t_dim.m_col) > t_buffer_len) {
-			THROW("Matrix Error: Out of bound", MatrixStatusErrOutOfBound);
-		}
+MatrixF32Ptr matrixf32CreateWithLayout(MatrixDimType t_dim, MatrixLayout t_layout) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpCreate);
 
-		if (m_matrixf32InitWithInvalidDimension(t_dim)) {
-			THROW("Matrix Error: Invalid dimension", MatrixStatusErrDimMismatch);
-		}
+	if (t_layout != MatrixLayoutRowMajor && t_layout != MatrixLayoutColMajor) {
+		THROW("Matrix Error: Unknown layout", MatrixStatusErrUnknownOpt);
+
+		return 0;
+	}
+
+	MatrixF32Ptr mat_ptr = m_matrixf32CreateFor(t_dim, MatrixF32OpCreate);
+	if (mat_ptr != 0) mat_ptr->m_layout = t_layout;
+
+	MATRIX_F32_PROBE_END(MatrixF32OpCreate, 0, t_dim.m_row * t_dim.m_col * sizeof(float));
+
+	return mat_ptr;
+}
+
+MatrixF32Ptr m_matrixf32CreateContainerFor(MatrixDimType t_dim, float *t_val, MatrixF32Op t_op) {
+	MatrixF32Ptr mat_ptr = MATRIX_F32_MALLOC(sizeof(struct MatrixF32));
 
+	if (mat_ptr != 0) {
 		mat_ptr->m_row = t_dim.m_row;
 		mat_ptr->m_col = t_dim.m_col;
 
 		mat_ptr->m_addrOwnerShip = OwnerShipOuter;
+		mat_ptr->m_layout = MatrixLayoutRowMajor;
 		mat_ptr->m_val = t_val;
+		mat_ptr->m_version = 0;
+		mat_ptr->m_cache = 0;
+
+		MATRIX_F32_MEM_TRACK(mat_ptr, t_op, sizeof(struct MatrixF32));
 	}
 
 	return mat_ptr;
 }
 
+MatrixF32Ptr matrixf32CreateContainer(MatrixDimType t_dim, float *t_val, int t_buffer_len) {
+	return matrixf32CreateContainerWithLayout(t_dim, t_val, t_buffer_len, MatrixLayoutRowMajor);
+}
+
+MatrixF32Ptr matrixf32CreateContainerWithLayout(MatrixDimType t_dim, float *t_val, int t_buffer_len,
+												MatrixLayout t_layout) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpCreateContainer);
+
+	if (t_layout != MatrixLayoutRowMajor && t_layout != MatrixLayoutColMajor) {
+		THROW("Matrix Error: Unknown layout", MatrixStatusErrUnknownOpt);
+
+		return 0;
+	}
+
+	if ((int)(t_dim.m_row * t_dim.m_col) > t_buffer_len) {
+		THROW("Matrix Error: Out of bound", MatrixStatusErrOutOfBound);
+
+		return 0;
+	}
+
+	if (m_matrixf32InitWithInvalidDimension(t_dim)) {
+		THROW("Matrix Error: Invalid dimension", MatrixStatusErrDimMismatch);
+
+		return 0;
+	}
+
+	MatrixF32Ptr mat_ptr = m_matrixf32CreateContainerFor(t_dim, t_val, MatrixF32OpCreateContainer);
+	if (mat_ptr != 0) mat_ptr->m_layout = t_layout;
+
+	MATRIX_F32_PROBE_END(MatrixF32OpCreateContainer, 0, 0);
+
+	return mat_ptr;
+}
+
+static void m_matrixf32FactorCacheFree(struct MatrixF32FactorCache **t_cache) {
+	if (*t_cache == 0) return;
+
+	matrixf32Destroy(&(*t_cache)->m_lu);
+	matrixf32Destroy(&(*t_cache)->m_permutation);
+	matrixf32Destroy(&(*t_cache)->m_inverse);
+
+	MATRIX_F32_FREE(*t_cache);
+	*t_cache = 0;
+}
+
 MatrixStatus matrixf32Destroy(MatrixF32Ptr *t_dest) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpDestroy);
+
 	if (t_dest == NULL) {
 		return MatrixStatusErrNullPtr;
 	}
 
 	// repeatedly destroy will not effect the result
 	// @TODO this may cause issue
-	if ((*t_dest) != NULL && (*t_dest)->m_addrOwnerShip == OwnerShipSelf) {
-		free((*t_dest)->m_val);
+	if ((*t_dest) != NULL) {
+		MATRIX_F32_MEM_UNTRACK(*t_dest);
+		m_matrixf32FactorCacheFree(&(*t_dest)->m_cache);
+
+		if ((*t_dest)->m_addrOwnerShip == OwnerShipSelf) {
+			MATRIX_F32_FREE((*t_dest)->m_val);
+		}
 	}
 
-	free(*t_dest);
+	MATRIX_F32_FREE(*t_dest);
 	*t_dest = 0;
 
+	MATRIX_F32_PROBE_END(MatrixF32OpDestroy, 0, 0);
+
 	return MatrixStatusOK;
 }
 
 size_t matrixf32GetColNumber(MatrixF32Ptr t_dest) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpGetColNumber);
+
 	if (t_dest == 0) {
 		THROW("Matrix Error: Null pointer", MatrixStatusErrNullPtr);
+
+		return 0;
 	}
 
+	MATRIX_F32_PROBE_END(MatrixF32OpGetColNumber, 0, 0);
+
 	return t_dest->m_col;
 }
 
 size_t matrixf32GetRowNumber(MatrixF32Ptr t_dest) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpGetRowNumber);
+
 	if (t_dest == 0) {
 		THROW("Matrix Error: Null pointer", MatrixStatusErrNullPtr);
+
+		return 0;
 	}
 
+	MATRIX_F32_PROBE_END(MatrixF32OpGetRowNumber, 0, 0);
+
 	return t_dest->m_row;
 }
 
 AddrOwnerShip matrixf32GetOwnership(MatrixF32Ptr t_dest) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpGetOwnership);
+
 	if (t_dest == 0) {
 		THROW("Matrix Error: Null pointer", MatrixStatusErrNullPtr);
+
+		return OwnerShipNull;
 	}
 
+	MATRIX_F32_PROBE_END(MatrixF32OpGetOwnership, 0, 0);
+
 	return t_dest->m_addrOwnerShip;
 }
 
+MatrixLayout matrixf32GetLayout(MatrixF32Ptr t_dest) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpGetLayout);
+
+	if (t_dest == 0) {
+		THROW("Matrix Error: Null pointer", MatrixStatusErrNullPtr);
+
+		return MatrixLayoutRowMajor;
+	}
+
+	MATRIX_F32_PROBE_END(MatrixF32OpGetLayout, 0, 0);
+
+	return t_dest->m_layout;
+}
+
 float matrixf32GetValueAt(MatrixF32Ptr t_dest, MatrixDimType t_dim) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpGetValueAt);
+
 	if (m_matrixf32HaveNullPtr(1, t_dest)) {
 		THROW("Matrix Error: Null pointer", MatrixStatusErrNullPtr);
+
+		return 0.0f;
 	}
 
 	bool bound_error = t_dim.m_row >= t_dest->m_row || t_dim.m_col >= t_dest->m_col;
 
 	if (bound_error) {
 		THROW("Matrix Error: Out of bound", MatrixStatusErrOutOfBound);
+
+		return 0.0f;
 	}
 
-	return t_dest->m_val[t_dest->m_col * t_dim.m_row + t_dim.m_col];
+	MATRIX_F32_PROBE_END(MatrixF32OpGetValueAt, 0, sizeof(float));
+
+	return t_dest->m_val[m_matrixf32Offset(t_dest, t_dim.m_row, t_dim.m_col)];
 }
 
 float *matrixf32GetBuffer(MatrixF32Ptr t_dest) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpGetBuffer);
+
 	if (t_dest == 0) {
 		THROW("Matrix Error: Null pointer", MatrixStatusErrNullPtr);
+
+		return 0;
 	}
 
+	m_matrixf32Touch(t_dest);
+
+	MATRIX_F32_PROBE_END(MatrixF32OpGetBuffer, 0, 0);
+
 	return t_dest->m_val;
 }
 
 MatrixStatus matrixf32SetValueAt(MatrixF32Ptr t_dest, MatrixDimType t_dim, float t_val) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpSetValueAt);
+
 	if (m_matrixf32HaveNullPtr(1, t_dest)) return MatrixStatusErrNullPtr;
 
 	if (t_dim.m_row < t_dest->m_row && t_dim.m_col < t_dest->m_col) {
-		t_dest->m_val[t_dest->m_col * t_dim.m_row + t_dim.m_col] = t_val;
+		t_dest->m_val[m_matrixf32Offset(t_dest, t_dim.m_row, t_dim.m_col)] = t_val;
+		m_matrixf32Touch(t_dest);
+
+		MATRIX_F32_PROBE_END(MatrixF32OpSetValueAt, 0, sizeof(float));
 
 		return MatrixStatusOK;
 	} else {
@@ -216,114 +401,213 @@ MatrixStatus matrixf32SetValueAt(MatrixF32Ptr t_dest, MatrixDimType t_dim, float
 }
 
 MatrixStatus matrixf32SetAllEntriesTo(MatrixF32Ptr t_dest, float t_val) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpSetAllEntriesTo);
+
 	if (m_matrixf32HaveNullPtr(1, t_dest)) return MatrixStatusErrNullPtr;
 
+	m_matrixf32Touch(t_dest);
+
 	for (size_t i = 0; i < t_dest->m_row * t_dest->m_col; ++i) {
 		t_dest->m_val[i] = t_val;
 	}
 
+	MATRIX_F32_PROBE_END(MatrixF32OpSetAllEntriesTo, 0, m_matrixf32TotalSize(t_dest) * sizeof(float));
+
 	return MatrixStatusOK;
 }
 
 bool matrixf32TwoMatEqual(const MatrixF32Ptr t_mat_a, const MatrixF32Ptr t_mat_b, float t_tolerance) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpTwoMatEqual);
+
 	if (m_matrixf32HaveNullPtr(2, t_mat_a, t_mat_b)) return false;
 	if (t_mat_a == t_mat_b) return true;
 	if (!m_matrixf32InputsDimMatch(2, t_mat_a, t_mat_b)) return false;
 
-	for (size_t i = 0; i < t_mat_a->m_row * t_mat_a->m_col; i++) {
-		if (fabsf(t_mat_a->m_val[i] - t_mat_b->m_val[i]) > t_tolerance) {
-			return false;
+	size_t i = 0;
+	if (m_matrixf32SameStorage(2, t_mat_a, t_mat_b)) {
+		for (; i < t_mat_a->m_row * t_mat_a->m_col; i++) {
+			if (fabsf(t_mat_a->m_val[i] - t_mat_b->m_val[i]) > t_tolerance) {
+				break;
+			}
+		}
+	} else {
+		// i counts the entries compared in the storage order of t_mat_a
+		for (; i < t_mat_a->m_row * t_mat_a->m_col; i++) {
+			const size_t row = t_mat_a->m_layout == MatrixLayoutRowMajor ? i / t_mat_a->m_col : i % t_mat_a->m_row;
+			const size_t col = t_mat_a->m_layout == MatrixLayoutRowMajor ? i % t_mat_a->m_col : i / t_mat_a->m_row;
+
+			if (fabsf(t_mat_a->m_val[i] - t_mat_b->m_val[m_matrixf32Offset(t_mat_b, row, col)]) > t_tolerance) {
+				break;
+			}
 		}
 	}
 
-	return true;
+	MATRIX_F32_PROBE_END(MatrixF32OpTwoMatEqual, 2 * i, 2 * i * sizeof(float));
+
+	return i == m_matrixf32TotalSize(t_mat_a);
 }
 
 MatrixStatus matrixf32Add(const MatrixF32Ptr t_dest, const MatrixF32Ptr t_mat_b, const MatrixF32Ptr t_mat_c) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpAdd);
+
 	if (m_matrixf32HaveNullPtr(3, t_dest, t_mat_b, t_mat_c)) return MatrixStatusErrNullPtr;
 	if (!m_matrixf32InputsDimMatch(3, t_dest, t_mat_b, t_mat_c)) return MatrixStatusErrDimMismatch;
 
-	for (size_t i = 0; i < m_matrixf32TotalSize(t_dest); ++i) {
-		t_dest->m_val[i] = t_mat_c->m_val[i] + t_mat_b->m_val[i];
+	m_matrixf32Touch(t_dest);
+
+	if (m_matrixf32SameStorage(3, t_dest, t_mat_b, t_mat_c)) {
+		for (size_t i = 0; i < m_matrixf32TotalSize(t_dest); ++i) {
+			t_dest->m_val[i] = t_mat_c->m_val[i] + t_mat_b->m_val[i];
+		}
+	} else {
+		for (size_t i = 0; i < t_dest->m_row; ++i) {
+			for (size_t j = 0; j < t_dest->m_col; ++j) {
+				t_dest->m_val[m_matrixf32Offset(t_dest, i, j)] =
+					t_mat_c->m_val[m_matrixf32Offset(t_mat_c, i, j)] + t_mat_b->m_val[m_matrixf32Offset(t_mat_b, i, j)];
+			}
+		}
 	}
 
+	MATRIX_F32_PROBE_END(MatrixF32OpAdd, m_matrixf32TotalSize(t_dest),
+						 3 * m_matrixf32TotalSize(t_dest) * sizeof(float));
+
 	return MatrixStatusOK;
 }
 
 MatrixStatus matrixf32Scale(const MatrixF32Ptr t_dest, float t_val, MatrixF32Ptr t_mat_b) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpScale);
+
 	if (m_matrixf32HaveNullPtr(2, t_dest, t_mat_b)) return MatrixStatusErrNullPtr;
 	if (!m_matrixf32InputsDimMatch(2, t_dest, t_mat_b)) return MatrixStatusErrDimMismatch;
 
-	for (size_t i = 0; i < m_matrixf32TotalSize(t_dest); ++i) {
-		t_dest->m_val[i] = t_val * t_mat_b->m_val[i];
+	m_matrixf32Touch(t_dest);
+
+	if (m_matrixf32SameStorage(2, t_dest, t_mat_b)) {
+		for (size_t i = 0; i < m_matrixf32TotalSize(t_dest); ++i) {
+			t_dest->m_val[i] = t_val * t_mat_b->m_val[i];
+		}
+	} else {
+		for (size_t i = 0; i < t_dest->m_row; ++i) {
+			for (size_t j = 0; j < t_dest->m_col; ++j) {
+				t_dest->m_val[m_matrixf32Offset(t_dest, i, j)] =
+					t_val * t_mat_b->m_val[m_matrixf32Offset(t_mat_b, i, j)];
+			}
+		}
 	}
 
+	MATRIX_F32_PROBE_END(MatrixF32OpScale, m_matrixf32TotalSize(t_dest),
+						 2 * m_matrixf32TotalSize(t_dest) * sizeof(float));
+
 	return MatrixStatusOK;
 }
 
 MatrixStatus matrixf32Subtract(const MatrixF32Ptr t_dest, const MatrixF32Ptr t_mat_b, const MatrixF32Ptr t_mat_c) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpSubtract);
+
 	if (m_matrixf32HaveNullPtr(3, t_dest, t_mat_b, t_mat_c)) return MatrixStatusErrNullPtr;
 	if (!m_matrixf32InputsDimMatch(3, t_dest, t_mat_b, t_mat_c)) return MatrixStatusErrDimMismatch;
 
-	for (size_t i = 0; i < m_matrixf32TotalSize(t_dest); ++i) {
-		t_dest->m_val[i] = t_mat_b->m_val[i] - t_mat_c->m_val[i];
+	m_matrixf32Touch(t_dest);
+
+	if (m_matrixf32SameStorage(3, t_dest, t_mat_b, t_mat_c)) {
+		for (size_t i = 0; i < m_matrixf32TotalSize(t_dest); ++i) {
+			t_dest->m_val[i] = t_mat_b->m_val[i] - t_mat_c->m_val[i];
+		}
+	} else {
+		for (size_t i = 0; i < t_dest->m_row; ++i) {
+			for (size_t j = 0; j < t_dest->m_col; ++j) {
+				t_dest->m_val[m_matrixf32Offset(t_dest, i, j)] =
+					t_mat_b->m_val[m_matrixf32Offset(t_mat_b, i, j)] - t_mat_c->m_val[m_matrixf32Offset(t_mat_c, i, j)];
+			}
+		}
 	}
 
+	MATRIX_F32_PROBE_END(MatrixF32OpSubtract, m_matrixf32TotalSize(t_dest),
+						 3 * m_matrixf32TotalSize(t_dest) * sizeof(float));
+
 	return MatrixStatusOK;
 }
 
 MatrixStatus matrixf32Multiplication(const MatrixF32Ptr t_dest, const MatrixF32Ptr t_mat_b,
 									 const MatrixF32Ptr t_mat_c) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpMultiplication);
+
 	if (m_matrixf32HaveNullPtr(3, t_dest, t_mat_b, t_mat_c)) return MatrixStatusErrNullPtr;
 	if (!m_matrixf32MultDimMatch(t_dest, t_mat_b, t_mat_c)) return MatrixStatusErrDimMismatch;
 
-	for (size_t i = 0; i < t_mat_b->m_row; ++i) {
-		for (size_t k = 0; k < t_mat_c->m_col; ++k) {
-			float temp = 0;
-			for (size_t j = 0; j < t_mat_b->m_col; ++j) {
-				temp += t_mat_b->m_val[j + i * t_mat_b->m_col] * t_mat_c->m_val[k + j * t_mat_c->m_col];
-			}
+	// the kernel runs in the layout of the result, a column-major product is computed as D^T = C^T * B^T
+	MatrixF32Ptr mat_b = m_matrixf32InLayout(t_mat_b, t_dest->m_layout, MatrixF32OpMultiplication);
+	MatrixF32Ptr mat_c = m_matrixf32InLayout(t_mat_c, t_dest->m_layout, MatrixF32OpMultiplication);
 
-			t_dest->m_val[t_mat_c->m_col * i + k] = temp;
-		}
+	if (mat_b == 0 || mat_c == 0) {
+		if (mat_b != t_mat_b) matrixf32Destroy(&mat_b);
+		if (mat_c != t_mat_c) matrixf32Destroy(&mat_c);
+
+		return MatrixStatusErrNullPtr;
 	}
 
+	m_matrixf32Touch(t_dest);
+
+	if (t_dest->m_layout == MatrixLayoutRowMajor) {
+		m_matrixf32GemmKernel(mat_b->m_row, mat_c->m_col, mat_b->m_col, 1.0f, mat_b->m_val, mat_b->m_col, mat_c->m_val,
+							  mat_c->m_col, false, t_dest->m_val, t_dest->m_col);
+	} else {
+		m_matrixf32GemmKernel(mat_c->m_col, mat_b->m_row, mat_b->m_col, 1.0f, mat_c->m_val, mat_c->m_row, mat_b->m_val,
+							  mat_b->m_row, false, t_dest->m_val, t_dest->m_row);
+	}
+
+	if (mat_b != t_mat_b) matrixf32Destroy(&mat_b);
+	if (mat_c != t_mat_c) matrixf32Destroy(&mat_c);
+
+	MATRIX_F32_PROBE_END(MatrixF32OpMultiplication, 2 * t_mat_b->m_row * t_mat_b->m_col * t_mat_c->m_col,
+						 sizeof(float) * (m_matrixf32TotalSize(t_mat_b) + m_matrixf32TotalSize(t_mat_c) +
+										  m_matrixf32TotalSize(t_dest)));
+
 	return MatrixStatusOK;
 }
 
 MatrixStatus matrixf32Copy(const MatrixF32Ptr t_dest, const MatrixF32Ptr t_source) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpCopy);
+
 	if (m_matrixf32HaveNullPtr(2, t_dest, t_source)) return MatrixStatusErrNullPtr;
 	if (!m_matrixf32InputsDimMatch(2, t_dest, t_source)) return MatrixStatusErrDimMismatch;
 
-	for (size_t i = 0; i < m_matrixf32TotalSize(t_source); ++i) {
-		t_dest->m_val[i] = t_source->m_val[i];
-	}
+	m_matrixf32Touch(t_dest);
+
+	if (t_dest != t_source) m_matrixf32CopyEntries(t_dest, t_source);
+
+	MATRIX_F32_PROBE_END(MatrixF32OpCopy, 0, 2 * m_matrixf32TotalSize(t_dest) * sizeof(float));
 
 	return MatrixStatusOK;
 }
 
 MatrixStatus matrixf32Swap(const MatrixF32Ptr t_to_swap, size_t t_from, size_t t_to, MatrixSwapOpt t_opt) {
-	if (m_matrixf32HaveNullPtr(1, t_to_swap)) return MatrixStatusErrNullPtr;
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpSwap);
 
-	int begin, end, diff;  // matrix position index
-	int i;				   // loop index
+	if (m_matrixf32HaveNullPtr(1, t_to_swap)) return MatrixStatusErrNullPtr;
 
+	const size_t row_stride = m_matrixf32RowStride(t_to_swap);
+	const size_t col_stride = m_matrixf32ColStride(t_to_swap);
+	float *from, *to;
 	float temp;
 
 	if (t_opt == SwapOptRow) {
 		if (t_to_swap->m_row > t_to && t_to_swap->m_row > t_from) {
 			if (t_to == t_from) return MatrixStatusOK;
 
-			begin = t_to_swap->m_col * t_to;
-			end = t_to_swap->m_col * (t_to + 1);
-			diff = t_from - t_to;
+			m_matrixf32Touch(t_to_swap);
 
-			for (i = begin; i < end; ++i) {
-				temp = t_to_swap->m_val[i];
-				t_to_swap->m_val[i] = t_to_swap->m_val[i + t_to_swap->m_col * diff];
-				t_to_swap->m_val[i + t_to_swap->m_col * diff] = temp;
+			from = t_to_swap->m_val + t_from * row_stride;
+			to = t_to_swap->m_val + t_to * row_stride;
+
+			for (size_t i = 0; i < t_to_swap->m_col; ++i) {
+				temp = to[i * col_stride];
+				to[i * col_stride] = from[i * col_stride];
+				from[i * col_stride] = temp;
 			}
 
+			MATRIX_F32_PROBE_END(MatrixF32OpSwap, 0, 4 * t_to_swap->m_col * sizeof(float));
+
 			return MatrixStatusOK;
 		}
 
@@ -332,16 +616,19 @@ MatrixStatus matrixf32Swap(const MatrixF32Ptr t_to_swap, size_t t_from, size_t t
 		if (t_to_swap->m_col > t_to && t_to_swap->m_col > t_from) {
 			if (t_to == t_from) return MatrixStatusOK;
 
-			begin = t_to;
-			end = t_to + t_to_swap->m_col * t_to_swap->m_row;
-			diff = t_from - t_to;
+			m_matrixf32Touch(t_to_swap);
 
-			for (i = begin; i < end; i += t_to_swap->m_col) {
-				temp = t_to_swap->m_val[i];
-				t_to_swap->m_val[i] = t_to_swap->m_val[i + diff];
-				t_to_swap->m_val[i + diff] = temp;
+			from = t_to_swap->m_val + t_from * col_stride;
+			to = t_to_swap->m_val + t_to * col_stride;
+
+			for (size_t i = 0; i < t_to_swap->m_row; ++i) {
+				temp = to[i * row_stride];
+				to[i * row_stride] = from[i * row_stride];
+				from[i * row_stride] = temp;
 			}
 
+			MATRIX_F32_PROBE_END(MatrixF32OpSwap, 0, 4 * t_to_swap->m_row * sizeof(float));
+
 			return MatrixStatusOK;
 		}
 
@@ -351,71 +638,88 @@ MatrixStatus matrixf32Swap(const MatrixF32Ptr t_to_swap, size_t t_from, size_t t
 	return MatrixStatusErrUnknownOpt;
 }
 
-MatrixStatus matrixf32InPlaceLU(const MatrixF32Ptr t_dest_and_source, const MatrixF32Ptr t_permutation) {
-	if (m_matrixf32HaveNullPtr(2, t_dest_and_source, t_permutation)) return MatrixStatusErrNullPtr;
-	if (m_matrixf32IsSquareMatrix(1, t_dest_and_source) != 0) return MatrixStatusErrDimMismatch;
-	if (t_dest_and_source->m_row != t_permutation->m_row) return MatrixStatusErrDimMismatch;
-
-	size_t i, j, k, biggest_index = 0;
+// the elimination of matrixf32InPlaceLU on a row-major matrix, run by the selected backend
+static MatrixStatus m_matrixf32LUKernel(const MatrixF32Ptr t_dest_and_source, const MatrixF32Ptr t_permutation) {
+	const size_t n = t_dest_and_source->m_row;
+	size_t *pivot = MATRIX_F32_MALLOC(n * sizeof(size_t));
 
-	float biggest = 0.0f, temp = 0.0f;
+	if (pivot == 0) return MatrixStatusErrNullPtr;
 
 	// initialize t_permutation matrix, t_permutation should be a column vector
 	// but it is fine if it is not a column vector
-	for (i = 0; i < t_permutation->m_row; ++i) {
+	for (size_t i = 0; i < t_permutation->m_row; ++i) {
 		// first column
-		t_permutation->m_val[i * t_permutation->m_col] = (float)i;
+		t_permutation->m_val[m_matrixf32Offset(t_permutation, i, 0)] = (float)i;
 	}
 
-	// partial pivot (largest value in each column)
-	for (i = 0; i < t_dest_and_source->m_col; ++i) {
-		biggest = 0;
+	for (size_t i = 0; i < n; ++i) {
+		pivot[i] = i;
+	}
 
-		for (k = i; k < t_dest_and_source->m_row; ++k) {
-			temp = fabsf(t_dest_and_source->m_val[i + k * t_dest_and_source->m_row]);
+	const bool factorized = m_matrixf32LUFactorKernel(t_dest_and_source->m_val, n, pivot);
 
-			if (temp > biggest) {
-				biggest_index = k;
-				biggest = temp;
-			}
-		}
+	// replay the row interchanges on the whole t_permutation
+	for (size_t i = 0; i < n; ++i) {
+		matrixf32Swap(t_permutation, pivot[i], i, SwapOptRow);
+	}
 
-		// the matrix has a column of zeros	-> singular
-		if (biggest == 0.0f) {
-			return MatrixStatusErrSingular;
-		}
+	MATRIX_F32_FREE(pivot);
+
+	// the matrix has a column of zeros	-> singular
+	return factorized ? MatrixStatusOK : MatrixStatusErrSingular;
+}
 
-		// swap m_row
-		matrixf32Swap(t_dest_and_source, biggest_index, i, SwapOptRow);
-		matrixf32Swap(t_permutation, biggest_index, i, SwapOptRow);
+MatrixStatus matrixf32InPlaceLU(const MatrixF32Ptr t_dest_and_source, const MatrixF32Ptr t_permutation) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpInPlaceLU);
 
-		for (j = i + 1; j < t_dest_and_source->m_row; ++j) {
-			t_dest_and_source->m_val[j * t_dest_and_source->m_col + i] /=
-				(t_dest_and_source->m_val[i * t_dest_and_source->m_col + i] + 1e-6f);
+	if (m_matrixf32HaveNullPtr(2, t_dest_and_source, t_permutation)) return MatrixStatusErrNullPtr;
+	if (m_matrixf32IsSquareMatrix(1, t_dest_and_source) != 0) return MatrixStatusErrDimMismatch;
+	if (t_dest_and_source->m_row != t_permutation->m_row) return MatrixStatusErrDimMismatch;
 
-			for (k = i + 1; k < t_dest_and_source->m_col; ++k) {
-				t_dest_and_source->m_val[j * t_dest_and_source->m_col + k] -=
-					t_dest_and_source->m_val[j * t_dest_and_source->m_col + i] *
-					t_dest_and_source->m_val[i * t_dest_and_source->m_col + k];
-			}
-		}
+	// a column-major matrix is factorized in a row-major copy, the elimination runs along the rows
+	MatrixF32Ptr lu = m_matrixf32InLayout(t_dest_and_source, MatrixLayoutRowMajor, MatrixF32OpInPlaceLU);
+	if (lu == 0) return MatrixStatusErrNullPtr;
+
+	m_matrixf32Touch(t_dest_and_source);
+	m_matrixf32Touch(t_permutation);
+
+	MatrixStatus ret_val = m_matrixf32LUKernel(lu, t_permutation);
+
+	if (lu != t_dest_and_source) {
+		m_matrixf32CopyEntries(t_dest_and_source, lu);
+		matrixf32Destroy(&lu);
 	}
 
+	if (ret_val != MatrixStatusOK) return ret_val;
+
+	MATRIX_F32_PROBE_END(MatrixF32OpInPlaceLU, m_matrixf32LUFlops(t_dest_and_source->m_row),
+						 2 * m_matrixf32TotalSize(t_dest_and_source) * sizeof(float));
+
 	return MatrixStatusOK;
 }
 
 MatrixStatus matrixf32OutPlaceLU(const MatrixF32Ptr t_dest, const MatrixF32Ptr t_source,
 								 const MatrixF32Ptr t_permutation) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpOutPlaceLU);
+
 	if (m_matrixf32HaveNullPtr(3, t_dest, t_source, t_permutation)) return MatrixStatusErrNullPtr;
 
 	MatrixStatus retval = matrixf32Copy(t_dest, t_source);
 	if (retval != MatrixStatusOK) return retval;
 
-	return matrixf32InPlaceLU(t_dest, t_permutation);
+	retval = matrixf32InPlaceLU(t_dest, t_permutation);
+	if (retval != MatrixStatusOK) return retval;
+
+	MATRIX_F32_PROBE_END(MatrixF32OpOutPlaceLU, m_matrixf32LUFlops(t_dest->m_row),
+						 4 * m_matrixf32TotalSize(t_dest) * sizeof(float));
+
+	return MatrixStatusOK;
 }
 
 MatrixStatus matrixf32ForwardSubstitution(const MatrixF32Ptr t_result, const MatrixF32Ptr t_lower_triangular,
 										  const MatrixF32Ptr t_column) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpForwardSubstitution);
+
 	if (m_matrixf32HaveNullPtr(3, t_lower_triangular, t_column, t_result)) return MatrixStatusErrNullPtr;
 
 	bool dim_not_matched = t_lower_triangular->m_row != t_column->m_row ||
@@ -423,122 +727,308 @@ MatrixStatus matrixf32ForwardSubstitution(const MatrixF32Ptr t_result, const Mat
 						   t_column->m_col != 1 || (m_matrixf32IsSquareMatrix(1, t_lower_triangular) != 0);
 	if (dim_not_matched) return MatrixStatusErrDimMismatch;
 
-	size_t i = 0, j = 0;
-	float temp, main_diagonal_term;
+	m_matrixf32Touch(t_result);
 
-	for (i = 0; i < t_lower_triangular->m_row; ++i) {
-		temp = t_column->m_val[i];
+	const size_t n = t_lower_triangular->m_row;
+	const float *lower = t_lower_triangular->m_val;
+	float *result = t_result->m_val;
 
-		for (j = 0; j < i; ++j) {
-			temp -= t_lower_triangular->m_val[i * t_lower_triangular->m_col + j] * t_result->m_val[j];
-		}
+	if (t_lower_triangular->m_layout == MatrixLayoutRowMajor) {
+		// x_i = (b_i - L[i, :i] * x[:i]) / L_ii, the row of L is contiguous
+		for (size_t i = 0; i < n; ++i) {
+			const float main_diagonal_term = lower[i * n + i];
 
-		main_diagonal_term = t_lower_triangular->m_val[i * t_lower_triangular->m_col + i];
+			if (fabsf(main_diagonal_term) <= 1e-6f) {
+				return MatrixStatusErrSingular;
+			}
 
-		if (fabsf(main_diagonal_term) <= 1e-6f) {
-			return MatrixStatusErrSingular;
+			result[i] = (t_column->m_val[i] - m_matrixf32DotKernel(i, lower + i * n, result)) / main_diagonal_term;
 		}
+	} else {
+		// column oriented, x[i + 1:] -= x_i * L[i + 1:, i] once x_i is known, the column of L is contiguous
+		if (result != t_column->m_val) memcpy(result, t_column->m_val, n * sizeof(float));
 
-		t_result->m_val[i] = temp / main_diagonal_term;
+		for (size_t i = 0; i < n; ++i) {
+			const float main_diagonal_term = lower[i * n + i];
+
+			if (fabsf(main_diagonal_term) <= 1e-6f) {
+				return MatrixStatusErrSingular;
+			}
+
+			result[i] /= main_diagonal_term;
+			m_matrixf32AxpyKernel(n - i - 1, -result[i], lower + i * n + i + 1, result + i + 1);
+		}
 	}
 
+	MATRIX_F32_PROBE_END(MatrixF32OpForwardSubstitution, t_lower_triangular->m_row * t_lower_triangular->m_row,
+						 (m_matrixf32TotalSize(t_lower_triangular) / 2 + 2 * t_column->m_row) * sizeof(float));
+
 	return MatrixStatusOK;
 }
 
 MatrixStatus matrixf32BackwardSubstitution(const MatrixF32Ptr t_result, const MatrixF32Ptr t_upper_triangular,
 										   const MatrixF32Ptr t_column) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpBackwardSubstitution);
+
 	if (m_matrixf32HaveNullPtr(3, t_upper_triangular, t_column, t_result)) return MatrixStatusErrNullPtr;
 	bool dim_not_matched = t_upper_triangular->m_row != t_column->m_row ||
 						   t_upper_triangular->m_row != t_result->m_row || t_result->m_col != 1 ||
 						   t_column->m_col != 1 || (m_matrixf32IsSquareMatrix(1, t_upper_triangular) != 0);
 	if (dim_not_matched) return MatrixStatusErrDimMismatch;
 
-	int i = 0;
-	size_t j = 0;
-	float temp, main_diagonal_term;
+	m_matrixf32Touch(t_result);
 
-	for (i = t_upper_triangular->m_col - 1; i >= 0; --i) {
-		temp = t_column->m_val[i];
+	const size_t n = t_upper_triangular->m_row;
+	const float *upper = t_upper_triangular->m_val;
+	float *result = t_result->m_val;
 
-		for (j = i + 1; j < t_upper_triangular->m_row; ++j) {
-			temp -= t_upper_triangular->m_val[i * t_upper_triangular->m_col + j] * t_result->m_val[j];
-		}
+	if (t_upper_triangular->m_layout == MatrixLayoutRowMajor) {
+		// x_i = (b_i - U[i, i + 1:] * x[i + 1:]) / U_ii, the row of U is contiguous
+		for (size_t i = n; i-- > 0;) {
+			const float main_diagonal_term = upper[i * n + i];
 
-		main_diagonal_term = t_upper_triangular->m_val[i * t_upper_triangular->m_col + i];
+			if (fabsf(main_diagonal_term) <= 1e-6f) {
+				return MatrixStatusErrSingular;
+			}
 
-		if (fabsf(main_diagonal_term) <= 1e-6f) {
-			return MatrixStatusErrSingular;
+			result[i] = (t_column->m_val[i] - m_matrixf32DotKernel(n - i - 1, upper + i * n + i + 1, result + i + 1)) /
+						main_diagonal_term;
 		}
+	} else {
+		// column oriented, x[:i] -= x_i * U[:i, i] once x_i is known, the column of U is contiguous
+		if (result != t_column->m_val) memcpy(result, t_column->m_val, n * sizeof(float));
 
-		t_result->m_val[i] = temp / main_diagonal_term;
+		for (size_t i = n; i-- > 0;) {
+			const float main_diagonal_term = upper[i * n + i];
+
+			if (fabsf(main_diagonal_term) <= 1e-6f) {
+				return MatrixStatusErrSingular;
+			}
+
+			result[i] /= main_diagonal_term;
+			m_matrixf32AxpyKernel(i, -result[i], upper + i * n, result);
+		}
 	}
 
+	MATRIX_F32_PROBE_END(MatrixF32OpBackwardSubstitution, t_upper_triangular->m_row * t_upper_triangular->m_row,
+						 (m_matrixf32TotalSize(t_upper_triangular) / 2 + 2 * t_column->m_row) * sizeof(float));
+
 	return MatrixStatusOK;
 }
 
+// factorizes t_source into its attached cache unless the cached LU decomposition is still valid
+static MatrixStatus m_matrixf32FactorCacheLU(const MatrixF32Ptr t_source, MatrixF32Op t_op) {
+	struct MatrixF32FactorCache *cache = t_source->m_cache;
+
+	if (cache->m_luValid && cache->m_luVersion == t_source->m_version) return cache->m_luStatus;
+
+	const size_t n = t_source->m_row;
+
+	if (cache->m_lu == 0) {
+		cache->m_lu = m_matrixf32CreateFor((MatrixDimType){n, n}, t_op);
+		cache->m_permutation = m_matrixf32CreateFor((MatrixDimType){n, 1}, t_op);
+
+		if (m_matrixf32HaveNullPtr(2, cache->m_lu, cache->m_permutation)) {
+			matrixf32Destroy(&cache->m_lu);
+			matrixf32Destroy(&cache->m_permutation);
+
+			return MatrixStatusErrNullPtr;
+		}
+	}
+
+	cache->m_luStatus = matrixf32OutPlaceLU(cache->m_lu, t_source, cache->m_permutation);
+	cache->m_luVersion = t_source->m_version;
+	cache->m_luValid = true;
+
+	return cache->m_luStatus;
+}
+
 MatrixStatus matrixf32Inverse(const MatrixF32Ptr t_dest, const MatrixF32Ptr t_source) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpInverse);
+
 	MatrixStatus ret_val;
 
 	if (m_matrixf32HaveNullPtr(2, t_dest, t_source)) return MatrixStatusErrNullPtr;
 	if ((m_matrixf32IsSquareMatrix(2, t_dest, t_source) != 0) || !m_matrixf32InputsDimMatch(2, t_dest, t_source))
 		return MatrixStatusErrDimMismatch;
 
-	float temp = 0.0f;
-	size_t i = 0, j = 0, k = 0;
-	MatrixF32Ptr permutation = matrixf32Create((MatrixDimType){t_source->m_row, 1});
-	MatrixF32Ptr result = matrixf32Create((MatrixDimType){t_source->m_row, t_source->m_col});
+	const size_t n = t_source->m_row;
+	const uint32_t version = t_source->m_version;
+	struct MatrixF32FactorCache *cache = t_source->m_cache;
+
+	if (cache != 0 && cache->m_inverseValid && cache->m_inverseVersion == version) {
+		m_matrixf32Touch(t_dest);
+		m_matrixf32CopyEntries(t_dest, cache->m_inverse);
+
+		MATRIX_F32_PROBE_END(MatrixF32OpInverse, 0, 2 * m_matrixf32TotalSize(t_source) * sizeof(float));
+
+		return MatrixStatusOK;
+	}
+
+	MatrixF32Ptr permutation, result;
+
+	// the kernels write the inverse row by row
+	MatrixF32Ptr inverse = t_dest;
+
+	if (t_dest->m_layout != MatrixLayoutRowMajor) {
+		inverse = m_matrixf32CreateFor((MatrixDimType){n, n}, MatrixF32OpInverse);
+		if (inverse != 0 && inverse->m_val == 0) matrixf32Destroy(&inverse);
+		if (inverse == 0) return MatrixStatusErrNullPtr;
+	}
+
+	MATRIX_F32_SPAN_BEGIN(lu);
+
+	if (cache != 0) {
+		ret_val = m_matrixf32FactorCacheLU(t_source, MatrixF32OpInverse);
+		permutation = cache->m_permutation;
+		result = cache->m_lu;
+	} else {
+		permutation = m_matrixf32CreateFor((MatrixDimType){n, 1}, MatrixF32OpInverse);
+		result = m_matrixf32CreateFor((MatrixDimType){n, n}, MatrixF32OpInverse);
+		ret_val = matrixf32OutPlaceLU(result, t_source, permutation);
+	}
+
+	MATRIX_F32_SPAN_END(lu, "Inverse/LU");
+
+	if (ret_val == MatrixStatusOK) {
+		m_matrixf32Touch(t_dest);
 
-	ret_val = matrixf32OutPlaceLU(result, t_source, permutation);
+		MATRIX_F32_SPAN_BEGIN(forward);
 
-	if (ret_val != MatrixStatusOK) {
+		m_matrixf32LUForwardKernel(result->m_val, permutation->m_val, n, 0, n, inverse->m_val);
+
+		MATRIX_F32_SPAN_END(forward, "Inverse/Forward");
+
+		MATRIX_F32_SPAN_BEGIN(backward);
+
+		if (!m_matrixf32LUBackwardKernel(result->m_val, n, inverse->m_val, n)) ret_val = MatrixStatusErrSingular;
+
+		MATRIX_F32_SPAN_END(backward, "Inverse/Backward");
+	}
+
+	if (inverse != t_dest) {
+		if (ret_val == MatrixStatusOK) m_matrixf32CopyEntries(t_dest, inverse);
+		matrixf32Destroy(&inverse);
+	}
+
+	if (cache == 0) {
 		matrixf32Destroy(&permutation);
 		matrixf32Destroy(&result);
+	} else if (ret_val == MatrixStatusOK) {
+		if (cache->m_inverse == 0) cache->m_inverse = m_matrixf32CreateFor((MatrixDimType){n, n}, MatrixF32OpInverse);
 
-		return ret_val;
+		if (cache->m_inverse != 0 && cache->m_inverse->m_val != 0) {
+			m_matrixf32CopyEntries(cache->m_inverse, t_dest);
+			cache->m_inverseVersion = version;
+			cache->m_inverseValid = true;
+		}
 	}
 
-	MatrixF32Ptr column = matrixf32Create((MatrixDimType){t_source->m_row, 1});
+	if (ret_val != MatrixStatusOK) return ret_val;
 
-	if (column == 0) {
-		matrixf32Destroy(&column);
+	MATRIX_F32_PROBE_END(MatrixF32OpInverse,
+						 m_matrixf32LUFlops(t_source->m_row) + 2 * t_source->m_row * m_matrixf32TotalSize(t_source),
+						 3 * m_matrixf32TotalSize(t_source) * sizeof(float));
 
-		return MatrixStatusErrNullPtr;
+	return MatrixStatusOK;
+}
+
+uint32_t matrixf32GetVersion(MatrixF32Ptr t_dest) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpGetVersion);
+
+	if (t_dest == 0) {
+		THROW("Matrix Error: Null pointer", MatrixStatusErrNullPtr);
+
+		return 0;
 	}
 
-	for (i = 0; i < t_source->m_row; ++i) {
-		for (j = 0; j < t_source->m_row; ++j) {
-			column->m_val[j] = (float)(permutation->m_val[j] == i);
-		}
+	MATRIX_F32_PROBE_END(MatrixF32OpGetVersion, 0, 0);
 
-		// forward substitution without dividing the diagonal term
-		for (j = 0; j < result->m_row; ++j) {
-			temp = column->m_val[j];
+	return t_dest->m_version;
+}
 
-			for (k = 0; k < j; ++k) {
-				temp -= result->m_val[j * result->m_col + k] * column->m_val[k];
-			}
+MatrixStatus matrixf32SetFactorCache(MatrixF32Ptr t_dest, bool t_enable) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpSetFactorCache);
 
-			column->m_val[j] = temp;
-		}
+	if (m_matrixf32HaveNullPtr(1, t_dest)) return MatrixStatusErrNullPtr;
 
-		ret_val = matrixf32BackwardSubstitution(column, result, column);
+	if (!t_enable) {
+		m_matrixf32FactorCacheFree(&t_dest->m_cache);
+	} else if (t_dest->m_cache == 0) {
+		if (m_matrixf32IsSquareMatrix(1, t_dest) != 0) return MatrixStatusErrDimMismatch;
 
-		if (ret_val != MatrixStatusOK) {
-			matrixf32Destroy(&permutation);
-			matrixf32Destroy(&result);
-			matrixf32Destroy(&column);
+		t_dest->m_cache = MATRIX_F32_MALLOC(sizeof(struct MatrixF32FactorCache));
+		if (t_dest->m_cache == 0) return MatrixStatusErrNullPtr;
 
-			return ret_val;
-		}
+		memset(t_dest->m_cache, 0, sizeof(struct MatrixF32FactorCache));
+	}
 
-		for (k = 0; k < t_source->m_col; ++k) {
-			t_dest->m_val[k * t_source->m_col + i] = column->m_val[k];
-		}
+	MATRIX_F32_PROBE_END(MatrixF32OpSetFactorCache, 0, 0);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32Solve(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_a, const MatrixF32Ptr t_column) {
+	MATRIX_F32_PROBE_BEGIN(MatrixF32OpSolve);
+
+	MatrixStatus ret_val;
+
+	if (m_matrixf32HaveNullPtr(3, t_result, t_mat_a, t_column)) return MatrixStatusErrNullPtr;
+	if (m_matrixf32IsSquareMatrix(1, t_mat_a) != 0 || t_mat_a->m_row != t_column->m_row ||
+		!m_matrixf32InputsDimMatch(2, t_result, t_column))
+		return MatrixStatusErrDimMismatch;
+
+	const size_t n = t_mat_a->m_row;
+	const size_t k = t_column->m_col;
+	struct MatrixF32FactorCache *cache = t_mat_a->m_cache;
+	MatrixF32Ptr permutation, lu;
+
+	// the kernels solve for all columns row by row
+	MatrixF32Ptr column = m_matrixf32InLayout(t_column, MatrixLayoutRowMajor, MatrixF32OpSolve);
+	MatrixF32Ptr result = column == 0 ? 0 : m_matrixf32InLayout(t_result, MatrixLayoutRowMajor, MatrixF32OpSolve);
+
+	if (column == 0 || result == 0) {
+		if (column != t_column) matrixf32Destroy(&column);
+
+		return MatrixStatusErrNullPtr;
+	}
+
+#ifdef MATRIX_F32_ENABLE_STATS
+	const bool factorized = cache != 0 && cache->m_luValid && cache->m_luVersion == t_mat_a->m_version;
+#endif
+
+	if (cache != 0) {
+		ret_val = m_matrixf32FactorCacheLU(t_mat_a, MatrixF32OpSolve);
+		permutation = cache->m_permutation;
+		lu = cache->m_lu;
+	} else {
+		permutation = m_matrixf32CreateFor((MatrixDimType){n, 1}, MatrixF32OpSolve);
+		lu = m_matrixf32CreateFor((MatrixDimType){n, n}, MatrixF32OpSolve);
+		ret_val = matrixf32OutPlaceLU(lu, t_mat_a, permutation);
+	}
+
+	if (ret_val == MatrixStatusOK) {
+		m_matrixf32Touch(t_result);
+		m_matrixf32LUForwardKernel(lu->m_val, permutation->m_val, n, column->m_val, k, result->m_val);
+		if (!m_matrixf32LUBackwardKernel(lu->m_val, n, result->m_val, k)) ret_val = MatrixStatusErrSingular;
 	}
 
-	matrixf32Destroy(&permutation);
-	matrixf32Destroy(&column);
-	matrixf32Destroy(&result);
+	if (column != t_column) matrixf32Destroy(&column);
+
+	if (result != t_result) {
+		if (ret_val == MatrixStatusOK) m_matrixf32CopyEntries(t_result, result);
+		matrixf32Destroy(&result);
+	}
+
+	if (cache == 0) {
+		matrixf32Destroy(&permutation);
+		matrixf32Destroy(&lu);
+	}
+
+	if (ret_val != MatrixStatusOK) return ret_val;
+
+	MATRIX_F32_PROBE_END(MatrixF32OpSolve, (factorized ? 0 : m_matrixf32LUFlops(n)) + 2 * n * n * k,
+						 (m_matrixf32TotalSize(t_mat_a) + 2 * m_matrixf32TotalSize(t_column)) * sizeof(float));
 
 	return MatrixStatusOK;
 }
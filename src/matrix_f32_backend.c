@@ -0,0 +1,546 @@
+/**
+ * @Date:   2026-10-20T09:14:26+08:00
+ * @Last modified time: 2026-10-20T09:14:26+08:00
+ */
+
+#include "include/matrix_f32_backend.h"
+#include "src/matrix_f32_private.h"
+
+#include <math.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+// columns of C the native GEMM keeps in registers for 4 rows at a time
+#define MATRIX_F32_NATIVE_GEMM_COLS 16
+
+// columns per panel of the native LU, the trailing matrix is updated once per panel through the GEMM kernel
+#ifndef MATRIX_F32_NATIVE_LU_BLOCK
+#define MATRIX_F32_NATIVE_LU_BLOCK 32
+#endif
+
+// private function
+// a product with a single contiguous column of B and C is a matrix-vector product, done with the GEMV kernel
+static inline bool m_matrixf32GemmIsGemv(size_t t_n, size_t t_ldb, size_t t_ldc) {
+	return t_n == 1 && t_ldb == 1 && t_ldc == 1;
+}
+
+static void m_matrixf32ReferenceGemm(size_t t_m, size_t t_n, size_t t_k, float t_alpha, const float *t_a,
+									 size_t t_lda, const float *t_b, size_t t_ldb, bool t_accumulate, float *t_c,
+									 size_t t_ldc) {
+	if (m_matrixf32GemmIsGemv(t_n, t_ldb, t_ldc)) {
+		m_matrixf32GemvKernel(t_m, t_k, t_alpha, t_a, t_lda, t_b, t_accumulate ? 1.0f : 0.0f, t_c);
+
+		return;
+	}
+
+	if (!t_accumulate) {
+		for (size_t i = 0; i < t_m; ++i) {
+			memset(t_c + i * t_ldc, 0, t_n * sizeof(float));
+		}
+	}
+
+	// i-k-j order keeps the inner loop contiguous in B and C, blocking keeps a panel of B hot in cache
+	for (size_t k_begin = 0; k_begin < t_k; k_begin += MATRIX_F32_GEMM_BLOCK_K) {
+		const size_t k_end = (t_k - k_begin) > MATRIX_F32_GEMM_BLOCK_K ? k_begin + MATRIX_F32_GEMM_BLOCK_K : t_k;
+
+		for (size_t j_begin = 0; j_begin < t_n; j_begin += MATRIX_F32_GEMM_BLOCK_N) {
+			const size_t j_end = (t_n - j_begin) > MATRIX_F32_GEMM_BLOCK_N ? j_begin + MATRIX_F32_GEMM_BLOCK_N : t_n;
+
+			for (size_t i = 0; i < t_m; ++i) {
+				float *c_row = t_c + i * t_ldc;
+
+				for (size_t k = k_begin; k < k_end; ++k) {
+					const float a_ik = t_alpha * t_a[i * t_lda + k];
+					const float *b_row = t_b + k * t_ldb;
+
+					for (size_t j = j_begin; j < j_end; ++j) {
+						c_row[j] += a_ik * b_row[j];
+					}
+				}
+			}
+		}
+	}
+}
+
+static bool m_matrixf32ReferenceGetrf(float *t_a, size_t t_n, size_t *t_pivot) {
+	for (size_t i = 0; i < t_n; ++i) {
+		size_t biggest_index = i;
+		float biggest = 0.0f;
+
+		// partial pivot (largest value in each column)
+		for (size_t k = i; k < t_n; ++k) {
+			const float temp = fabsf(t_a[k * t_n + i]);
+
+			if (temp > biggest) {
+				biggest_index = k;
+				biggest = temp;
+			}
+		}
+
+		if (biggest == 0.0f) return false;
+
+		t_pivot[i] = biggest_index;
+
+		if (biggest_index != i) {
+			float *from = t_a + biggest_index * t_n;
+			float *to = t_a + i * t_n;
+
+			for (size_t j = 0; j < t_n; ++j) {
+				const float temp = to[j];
+				to[j] = from[j];
+				from[j] = temp;
+			}
+		}
+
+		for (size_t j = i + 1; j < t_n; ++j) {
+			t_a[j * t_n + i] /= (t_a[i * t_n + i] + 1e-6f);
+
+			m_matrixf32AxpyKernel(t_n - i - 1, -t_a[j * t_n + i], t_a + i * t_n + i + 1, t_a + j * t_n + i + 1);
+		}
+	}
+
+	return true;
+}
+
+static void m_matrixf32ReferenceLUForward(const float *t_lu, const float *t_permutation, size_t t_n,
+										  const float *t_b, size_t t_k, float *t_y) {
+	for (size_t j = 0; j < t_n; ++j) {
+		float *y_row = t_y + j * t_k;
+		const size_t source_row = (size_t)t_permutation[j];
+
+		if (t_b != 0) {
+			memcpy(y_row, t_b + source_row * t_k, t_k * sizeof(float));
+		} else {
+			for (size_t i = 0; i < t_k; ++i) {
+				y_row[i] = (float)(i == source_row);
+			}
+		}
+
+		// a single column is a dot product with the row of L
+		if (t_k == 1) {
+			y_row[0] -= m_matrixf32DotKernel(j, t_lu + j * t_n, t_y);
+			continue;
+		}
+
+		for (size_t k = 0; k < j; ++k) {
+			m_matrixf32AxpyKernel(t_k, -t_lu[j * t_n + k], t_y + k * t_k, y_row);
+		}
+	}
+}
+
+static bool m_matrixf32ReferenceLUBackward(const float *t_lu, size_t t_n, float *t_x, size_t t_k) {
+	for (size_t j = t_n; j-- > 0;) {
+		float *x_row = t_x + j * t_k;
+		const float main_diagonal_term = t_lu[j * t_n + j];
+
+		if (fabsf(main_diagonal_term) <= 1e-6f) return false;
+
+		if (t_k == 1) {
+			x_row[0] = (x_row[0] - m_matrixf32DotKernel(t_n - j - 1, t_lu + j * t_n + j + 1, x_row + 1)) /
+					   main_diagonal_term;
+			continue;
+		}
+
+		for (size_t k = j + 1; k < t_n; ++k) {
+			m_matrixf32AxpyKernel(t_k, -t_lu[j * t_n + k], t_x + k * t_k, x_row);
+		}
+
+		for (size_t i = 0; i < t_k; ++i) {
+			x_row[i] /= main_diagonal_term;
+		}
+	}
+
+	return true;
+}
+
+/**
+ *	Same blocking as the reference kernel, but 4 x MATRIX_F32_NATIVE_GEMM_COLS tiles of C are accumulated in local
+ *	arrays over a whole block of k, so each row of B loaded is used 4 times and C is written once per block.
+ */
+static void m_matrixf32NativeGemm(size_t t_m, size_t t_n, size_t t_k, float t_alpha, const float *t_a, size_t t_lda,
+								  const float *t_b, size_t t_ldb, bool t_accumulate, float *t_c, size_t t_ldc) {
+	enum { COLS = MATRIX_F32_NATIVE_GEMM_COLS };
+
+	if (m_matrixf32GemmIsGemv(t_n, t_ldb, t_ldc)) {
+		m_matrixf32GemvKernel(t_m, t_k, t_alpha, t_a, t_lda, t_b, t_accumulate ? 1.0f : 0.0f, t_c);
+
+		return;
+	}
+
+	if (!t_accumulate) {
+		for (size_t i = 0; i < t_m; ++i) {
+			memset(t_c + i * t_ldc, 0, t_n * sizeof(float));
+		}
+	}
+
+	for (size_t k_begin = 0; k_begin < t_k; k_begin += MATRIX_F32_GEMM_BLOCK_K) {
+		const size_t k_end = (t_k - k_begin) > MATRIX_F32_GEMM_BLOCK_K ? k_begin + MATRIX_F32_GEMM_BLOCK_K : t_k;
+
+		for (size_t j_begin = 0; j_begin < t_n; j_begin += MATRIX_F32_GEMM_BLOCK_N) {
+			const size_t j_end = (t_n - j_begin) > MATRIX_F32_GEMM_BLOCK_N ? j_begin + MATRIX_F32_GEMM_BLOCK_N : t_n;
+			size_t i = 0;
+
+			for (; i + 4 <= t_m; i += 4) {
+				const float *a0 = t_a + i * t_lda, *a1 = a0 + t_lda, *a2 = a1 + t_lda, *a3 = a2 + t_lda;
+				size_t j = j_begin;
+
+				for (; j + COLS <= j_end; j += COLS) {
+					float acc0[COLS] = {0}, acc1[COLS] = {0}, acc2[COLS] = {0}, acc3[COLS] = {0};
+
+					for (size_t k = k_begin; k < k_end; ++k) {
+						const float *b_row = t_b + k * t_ldb + j;
+
+						for (size_t l = 0; l < COLS; ++l) {
+							acc0[l] += a0[k] * b_row[l];
+							acc1[l] += a1[k] * b_row[l];
+							acc2[l] += a2[k] * b_row[l];
+							acc3[l] += a3[k] * b_row[l];
+						}
+					}
+
+					float *c0 = t_c + i * t_ldc + j, *c1 = c0 + t_ldc, *c2 = c1 + t_ldc, *c3 = c2 + t_ldc;
+
+					for (size_t l = 0; l < COLS; ++l) {
+						c0[l] += t_alpha * acc0[l];
+						c1[l] += t_alpha * acc1[l];
+						c2[l] += t_alpha * acc2[l];
+						c3[l] += t_alpha * acc3[l];
+					}
+				}
+
+				// columns left over at the end of the block
+				if (j < j_end) {
+					m_matrixf32ReferenceGemm(4, j_end - j, k_end - k_begin, t_alpha, t_a + i * t_lda + k_begin, t_lda,
+											 t_b + k_begin * t_ldb + j, t_ldb, true, t_c + i * t_ldc + j, t_ldc);
+				}
+			}
+
+			if (i < t_m) {
+				m_matrixf32ReferenceGemm(t_m - i, j_end - j_begin, k_end - k_begin, t_alpha, t_a + i * t_lda + k_begin,
+										 t_lda, t_b + k_begin * t_ldb + j_begin, t_ldb, true,
+										 t_c + i * t_ldc + j_begin, t_ldc);
+			}
+		}
+	}
+}
+
+/**
+ *	Right-looking LU by panels of MATRIX_F32_NATIVE_LU_BLOCK columns: the panel is eliminated column by column,
+ *	the rows of U to its right are solved with the unit lower triangle of the panel, and the trailing matrix gets a
+ *	single rank-block update A22 -= L21 * U12 through the GEMM kernel. Pivots are divided exactly.
+ */
+static bool m_matrixf32NativeGetrf(float *t_a, size_t t_n, size_t *t_pivot) {
+	for (size_t k_begin = 0; k_begin < t_n; k_begin += MATRIX_F32_NATIVE_LU_BLOCK) {
+		const size_t k_end =
+			(t_n - k_begin) > MATRIX_F32_NATIVE_LU_BLOCK ? k_begin + MATRIX_F32_NATIVE_LU_BLOCK : t_n;
+
+		for (size_t k = k_begin; k < k_end; ++k) {
+			size_t biggest_index = k;
+			float biggest = 0.0f;
+
+			for (size_t i = k; i < t_n; ++i) {
+				const float temp = fabsf(t_a[i * t_n + k]);
+
+				if (temp > biggest) {
+					biggest_index = i;
+					biggest = temp;
+				}
+			}
+
+			if (biggest == 0.0f) return false;
+
+			t_pivot[k] = biggest_index;
+
+			if (biggest_index != k) {
+				float *from = t_a + biggest_index * t_n;
+				float *to = t_a + k * t_n;
+
+				for (size_t j = 0; j < t_n; ++j) {
+					const float temp = to[j];
+					to[j] = from[j];
+					from[j] = temp;
+				}
+			}
+
+			const float *row_k = t_a + k * t_n;
+
+			for (size_t i = k + 1; i < t_n; ++i) {
+				float *row_i = t_a + i * t_n;
+				const float l_ik = row_i[k] / row_k[k];
+
+				row_i[k] = l_ik;
+
+				for (size_t j = k + 1; j < k_end; ++j) {
+					row_i[j] -= l_ik * row_k[j];
+				}
+			}
+		}
+
+		if (k_end == t_n) break;
+
+		// U12 = L11^-1 * A12
+		for (size_t i = k_begin + 1; i < k_end; ++i) {
+			float *row_i = t_a + i * t_n;
+
+			for (size_t p = k_begin; p < i; ++p) {
+				const float l_ip = row_i[p];
+				const float *row_p = t_a + p * t_n;
+
+				for (size_t j = k_end; j < t_n; ++j) {
+					row_i[j] -= l_ip * row_p[j];
+				}
+			}
+		}
+
+		const size_t trailing = t_n - k_end;
+
+		m_matrixf32NativeGemm(trailing, trailing, k_end - k_begin, -1.0f, t_a + k_end * t_n + k_begin, t_n,
+							  t_a + k_begin * t_n + k_end, t_n, true, t_a + k_end * t_n + k_end, t_n);
+	}
+
+	return true;
+}
+
+// L * Y = P * B by blocks of rows, the rows above a block are eliminated from it at once through the GEMM kernel
+static void m_matrixf32NativeLUForward(const float *t_lu, const float *t_permutation, size_t t_n, const float *t_b,
+									   size_t t_k, float *t_y) {
+	for (size_t j_begin = 0; j_begin < t_n; j_begin += MATRIX_F32_NATIVE_LU_BLOCK) {
+		const size_t j_end =
+			(t_n - j_begin) > MATRIX_F32_NATIVE_LU_BLOCK ? j_begin + MATRIX_F32_NATIVE_LU_BLOCK : t_n;
+
+		for (size_t j = j_begin; j < j_end; ++j) {
+			float *y_row = t_y + j * t_k;
+			const size_t source_row = (size_t)t_permutation[j];
+
+			if (t_b != 0) {
+				memcpy(y_row, t_b + source_row * t_k, t_k * sizeof(float));
+			} else {
+				for (size_t i = 0; i < t_k; ++i) {
+					y_row[i] = (float)(i == source_row);
+				}
+			}
+		}
+
+		m_matrixf32NativeGemm(j_end - j_begin, t_k, j_begin, -1.0f, t_lu + j_begin * t_n, t_n, t_y, t_k, true,
+							  t_y + j_begin * t_k, t_k);
+
+		for (size_t j = j_begin + 1; j < j_end; ++j) {
+			for (size_t k = j_begin; k < j; ++k) {
+				m_matrixf32AxpyKernel(t_k, -t_lu[j * t_n + k], t_y + k * t_k, t_y + j * t_k);
+			}
+		}
+	}
+}
+
+// U * X = Y by blocks of rows from the bottom, likewise
+static bool m_matrixf32NativeLUBackward(const float *t_lu, size_t t_n, float *t_x, size_t t_k) {
+	for (size_t j_end = t_n; j_end > 0;) {
+		const size_t j_begin = j_end > MATRIX_F32_NATIVE_LU_BLOCK ? j_end - MATRIX_F32_NATIVE_LU_BLOCK : 0;
+
+		m_matrixf32NativeGemm(j_end - j_begin, t_k, t_n - j_end, -1.0f, t_lu + j_begin * t_n + j_end, t_n,
+							  t_x + j_end * t_k, t_k, true, t_x + j_begin * t_k, t_k);
+
+		for (size_t j = j_end; j-- > j_begin;) {
+			float *x_row = t_x + j * t_k;
+			const float main_diagonal_term = t_lu[j * t_n + j];
+
+			if (fabsf(main_diagonal_term) <= 1e-6f) return false;
+
+			for (size_t k = j + 1; k < j_end; ++k) {
+				m_matrixf32AxpyKernel(t_k, -t_lu[j * t_n + k], t_x + k * t_k, x_row);
+			}
+
+			for (size_t i = 0; i < t_k; ++i) {
+				x_row[i] /= main_diagonal_term;
+			}
+		}
+
+		j_end = j_begin;
+	}
+
+	return true;
+}
+
+static const MatrixF32BackendOps m_matrixf32ReferenceOps = {m_matrixf32ReferenceGemm, m_matrixf32ReferenceGetrf,
+															 m_matrixf32ReferenceLUForward,
+															 m_matrixf32ReferenceLUBackward};
+
+static const MatrixF32BackendOps m_matrixf32NativeOps = {m_matrixf32NativeGemm, m_matrixf32NativeGetrf,
+														  m_matrixf32NativeLUForward, m_matrixf32NativeLUBackward};
+
+static const char *const m_matrixf32BackendNames[MatrixBackendCount] = {"reference", "native", "cblas"};
+
+static const MatrixF32BackendOps *const m_matrixf32Backends[MatrixBackendCount] = {
+	&m_matrixf32ReferenceOps, &m_matrixf32NativeOps,
+#ifdef MATRIX_F32_ENABLE_CBLAS
+	&m_matrixf32CblasOps,
+#else
+	0,
+#endif
+};
+
+// MatrixBackendCount until the first selection
+static atomic_int selected_backend = MatrixBackendCount;
+
+static MatrixBackend m_matrixf32BackendByName(const char *t_name) {
+	for (int i = 0; i < MatrixBackendCount; ++i) {
+		if (strcmp(t_name, m_matrixf32BackendNames[i]) == 0) return (MatrixBackend)i;
+	}
+
+	return MatrixBackendCount;
+}
+
+static const MatrixF32BackendOps *m_matrixf32BackendOps(void) {
+	int backend = atomic_load_explicit(&selected_backend, memory_order_relaxed);
+
+	if (backend == MatrixBackendCount) {
+		const char *name = getenv(MATRIX_F32_BACKEND_ENV);
+		int from_env = name == 0 ? MatrixBackendReference : (int)m_matrixf32BackendByName(name);
+
+		if (!matrixf32BackendAvailable((MatrixBackend)from_env)) from_env = MatrixBackendReference;
+
+		// a concurrent matrixf32SetBackend wins
+		if (atomic_compare_exchange_strong(&selected_backend, &backend, from_env)) backend = from_env;
+	}
+
+	return m_matrixf32Backends[backend];
+}
+
+// C = A * B and the solution X of A * X = B by LU, t_lu, t_permutation and t_pivot are work memory
+static bool m_matrixf32BackendCheckRun(const MatrixF32BackendOps *t_ops, size_t t_n, const float *t_a,
+									   const float *t_b, float *t_c, float *t_x, float *t_lu, float *t_permutation,
+									   size_t *t_pivot) {
+	t_ops->m_gemm(t_n, t_n, t_n, 1.0f, t_a, t_n, t_b, t_n, false, t_c, t_n);
+
+	memcpy(t_lu, t_a, t_n * t_n * sizeof(float));
+
+	for (size_t i = 0; i < t_n; ++i) {
+		t_pivot[i] = i;
+		t_permutation[i] = (float)i;
+	}
+
+	if (!t_ops->m_getrf(t_lu, t_n, t_pivot)) return false;
+
+	for (size_t i = 0; i < t_n; ++i) {
+		const float temp = t_permutation[i];
+		t_permutation[i] = t_permutation[t_pivot[i]];
+		t_permutation[t_pivot[i]] = temp;
+	}
+
+	t_ops->m_luForward(t_lu, t_permutation, t_n, t_b, t_n, t_x);
+
+	return t_ops->m_luBackward(t_lu, t_n, t_x, t_n);
+}
+
+// largest |t_x - t_reference| relative to the largest |t_reference|
+static float m_matrixf32BackendDeviation(const float *t_x, const float *t_reference, size_t t_count) {
+	float deviation = 0.0f, scale = 0.0f;
+
+	for (size_t i = 0; i < t_count; ++i) {
+		deviation = fmaxf(deviation, fabsf(t_x[i] - t_reference[i]));
+		scale = fmaxf(scale, fabsf(t_reference[i]));
+	}
+
+	return scale > 0.0f ? deviation / scale : deviation;
+}
+
+void m_matrixf32GemmKernel(size_t t_m, size_t t_n, size_t t_k, float t_alpha, const float *t_a, size_t t_lda,
+						   const float *t_b, size_t t_ldb, bool t_accumulate, float *t_c, size_t t_ldc) {
+	m_matrixf32BackendOps()->m_gemm(t_m, t_n, t_k, t_alpha, t_a, t_lda, t_b, t_ldb, t_accumulate, t_c, t_ldc);
+}
+
+bool m_matrixf32LUFactorKernel(float *t_a, size_t t_n, size_t *t_pivot) {
+	return m_matrixf32BackendOps()->m_getrf(t_a, t_n, t_pivot);
+}
+
+bool m_matrixf32LUFactorExactKernel(float *t_a, size_t t_n, size_t *t_pivot) {
+	return m_matrixf32NativeOps.m_getrf(t_a, t_n, t_pivot);
+}
+
+void m_matrixf32LUForwardKernel(const float *t_lu, const float *t_permutation, size_t t_n, const float *t_b,
+								size_t t_k, float *t_y) {
+	m_matrixf32BackendOps()->m_luForward(t_lu, t_permutation, t_n, t_b, t_k, t_y);
+}
+
+bool m_matrixf32LUBackwardKernel(const float *t_lu, size_t t_n, float *t_x, size_t t_k) {
+	return m_matrixf32BackendOps()->m_luBackward(t_lu, t_n, t_x, t_k);
+}
+
+bool matrixf32BackendAvailable(MatrixBackend t_backend) {
+	return t_backend >= 0 && t_backend < MatrixBackendCount && m_matrixf32Backends[t_backend] != 0;
+}
+
+const char *matrixf32BackendName(MatrixBackend t_backend) {
+	if (t_backend < 0 || t_backend >= MatrixBackendCount) return 0;
+
+	return m_matrixf32BackendNames[t_backend];
+}
+
+MatrixStatus matrixf32SetBackend(MatrixBackend t_backend) {
+	if (!matrixf32BackendAvailable(t_backend)) return MatrixStatusErrUnknownOpt;
+
+	atomic_store_explicit(&selected_backend, (int)t_backend, memory_order_relaxed);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32SetBackendByName(const char *t_name) {
+	if (t_name == 0) return MatrixStatusErrNullPtr;
+
+	return matrixf32SetBackend(m_matrixf32BackendByName(t_name));
+}
+
+MatrixBackend matrixf32GetBackend(void) {
+	const MatrixF32BackendOps *ops = m_matrixf32BackendOps();
+
+	for (int i = 0; i < MatrixBackendCount; ++i) {
+		if (m_matrixf32Backends[i] == ops) return (MatrixBackend)i;
+	}
+
+	return MatrixBackendReference;
+}
+
+MatrixStatus matrixf32BackendSelfTest(MatrixBackend t_backend, size_t t_n, float *t_max_error) {
+	if (t_max_error == 0) return MatrixStatusErrNullPtr;
+	if (t_n == 0) return MatrixStatusErrDimMismatch;
+	if (!matrixf32BackendAvailable(t_backend)) return MatrixStatusErrUnknownOpt;
+
+	const size_t size = t_n * t_n;
+	float *block = MATRIX_F32_MALLOC((7 * size + t_n) * sizeof(float));
+	size_t *pivot = MATRIX_F32_MALLOC(t_n * sizeof(size_t));
+
+	if (block == 0 || pivot == 0) {
+		MATRIX_F32_FREE(block);
+		MATRIX_F32_FREE(pivot);
+
+		return MatrixStatusErrNullPtr;
+	}
+
+	float *a = block, *b = block + size;
+	float *c_reference = block + 2 * size, *x_reference = block + 3 * size;
+	float *c = block + 4 * size, *x = block + 5 * size;
+	float *lu = block + 6 * size, *permutation = block + 7 * size;
+	uint32_t seed = 1;
+
+	// uniform in [-1, 1], well conditioned with high probability
+	for (size_t i = 0; i < 2 * size; ++i) {
+		seed = seed * 1103515245u + 12345u;
+		block[i] = (float)((seed >> 8) % 2001) / 1000.0f - 1.0f;
+	}
+
+	MatrixStatus ret_val = MatrixStatusErrSingular;
+
+	if (m_matrixf32BackendCheckRun(&m_matrixf32ReferenceOps, t_n, a, b, c_reference, x_reference, lu, permutation,
+								   pivot) &&
+		m_matrixf32BackendCheckRun(m_matrixf32Backends[t_backend], t_n, a, b, c, x, lu, permutation, pivot)) {
+		*t_max_error = fmaxf(m_matrixf32BackendDeviation(c, c_reference, size),
+							 m_matrixf32BackendDeviation(x, x_reference, size));
+		ret_val = MatrixStatusOK;
+	}
+
+	MATRIX_F32_FREE(block);
+	MATRIX_F32_FREE(pivot);
+
+	return ret_val;
+}
@@ -0,0 +1,263 @@
+/**
+ * @Date:   2026-10-20T11:37:02+08:00
+ * @Last modified time: 2026-10-20T11:37:02+08:00
+ */
+
+#include "include/matrix_f32_blas.h"
+#include "src/matrix_f32_private.h"
+
+#include <math.h>
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// private function
+static inline size_t m_matrixf32BlasLength(const MatrixF32Ptr t_vector) { return t_vector->m_row * t_vector->m_col; }
+
+float m_matrixf32DotKernel(size_t t_n, const float *t_x, const float *t_y) {
+	size_t i = 0;
+	float sum = 0.0f;
+
+#if defined(__SSE__)
+	__m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+
+	for (; i + 8 <= t_n; i += 8) {
+		acc0 = _mm_add_ps(acc0, _mm_mul_ps(_mm_loadu_ps(t_x + i), _mm_loadu_ps(t_y + i)));
+		acc1 = _mm_add_ps(acc1, _mm_mul_ps(_mm_loadu_ps(t_x + i + 4), _mm_loadu_ps(t_y + i + 4)));
+	}
+
+	float lane[4];
+	_mm_storeu_ps(lane, _mm_add_ps(acc0, acc1));
+	sum = (lane[0] + lane[1]) + (lane[2] + lane[3]);
+#elif defined(__ARM_NEON)
+	float32x4_t acc0 = vdupq_n_f32(0.0f), acc1 = vdupq_n_f32(0.0f);
+
+	for (; i + 8 <= t_n; i += 8) {
+		acc0 = vmlaq_f32(acc0, vld1q_f32(t_x + i), vld1q_f32(t_y + i));
+		acc1 = vmlaq_f32(acc1, vld1q_f32(t_x + i + 4), vld1q_f32(t_y + i + 4));
+	}
+
+	const float32x4_t acc = vaddq_f32(acc0, acc1);
+	sum = (vgetq_lane_f32(acc, 0) + vgetq_lane_f32(acc, 1)) + (vgetq_lane_f32(acc, 2) + vgetq_lane_f32(acc, 3));
+#else
+	// independent sums hide the latency of the FPU adder
+	float acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+
+	for (; i + 4 <= t_n; i += 4) {
+		acc0 += t_x[i] * t_y[i];
+		acc1 += t_x[i + 1] * t_y[i + 1];
+		acc2 += t_x[i + 2] * t_y[i + 2];
+		acc3 += t_x[i + 3] * t_y[i + 3];
+	}
+
+	sum = (acc0 + acc1) + (acc2 + acc3);
+#endif
+
+	for (; i < t_n; ++i) {
+		sum += t_x[i] * t_y[i];
+	}
+
+	return sum;
+}
+
+void m_matrixf32AxpyKernel(size_t t_n, float t_alpha, const float *t_x, float *t_y) {
+	size_t i = 0;
+
+#if defined(__SSE__)
+	const __m128 alpha = _mm_set1_ps(t_alpha);
+
+	for (; i + 8 <= t_n; i += 8) {
+		_mm_storeu_ps(t_y + i, _mm_add_ps(_mm_loadu_ps(t_y + i), _mm_mul_ps(alpha, _mm_loadu_ps(t_x + i))));
+		_mm_storeu_ps(t_y + i + 4,
+					  _mm_add_ps(_mm_loadu_ps(t_y + i + 4), _mm_mul_ps(alpha, _mm_loadu_ps(t_x + i + 4))));
+	}
+#elif defined(__ARM_NEON)
+	for (; i + 8 <= t_n; i += 8) {
+		vst1q_f32(t_y + i, vmlaq_n_f32(vld1q_f32(t_y + i), vld1q_f32(t_x + i), t_alpha));
+		vst1q_f32(t_y + i + 4, vmlaq_n_f32(vld1q_f32(t_y + i + 4), vld1q_f32(t_x + i + 4), t_alpha));
+	}
+#else
+	for (; i + 4 <= t_n; i += 4) {
+		t_y[i] += t_alpha * t_x[i];
+		t_y[i + 1] += t_alpha * t_x[i + 1];
+		t_y[i + 2] += t_alpha * t_x[i + 2];
+		t_y[i + 3] += t_alpha * t_x[i + 3];
+	}
+#endif
+
+	for (; i < t_n; ++i) {
+		t_y[i] += t_alpha * t_x[i];
+	}
+}
+
+float m_matrixf32Nrm2Kernel(size_t t_n, const float *t_x) {
+	return m_matrixf32Norm2FromSquares(m_matrixf32DotKernel(t_n, t_x, t_x), t_n, t_x);
+}
+
+void m_matrixf32GemvKernel(size_t t_m, size_t t_n, float t_alpha, const float *t_a, size_t t_lda, const float *t_x,
+						   float t_beta, float *t_y) {
+	for (size_t i = 0; i < t_m; ++i) {
+		const float product = t_alpha * m_matrixf32DotKernel(t_n, t_a + i * t_lda, t_x);
+
+		t_y[i] = t_beta == 0.0f ? product : product + t_beta * t_y[i];
+	}
+}
+
+void m_matrixf32GemvTransposedKernel(size_t t_m, size_t t_n, float t_alpha, const float *t_a, size_t t_lda,
+									 const float *t_x, float t_beta, float *t_y) {
+	for (size_t j = 0; j < t_n; ++j) {
+		t_y[j] = t_beta == 0.0f ? 0.0f : t_beta * t_y[j];
+	}
+
+	// row by row, so A is read contiguously
+	for (size_t i = 0; i < t_m; ++i) {
+		m_matrixf32AxpyKernel(t_n, t_alpha * t_x[i], t_a + i * t_lda, t_y);
+	}
+}
+
+void m_matrixf32GerKernel(size_t t_m, size_t t_n, float t_alpha, const float *t_x, const float *t_y, float *t_a,
+						  size_t t_lda) {
+	for (size_t i = 0; i < t_m; ++i) {
+		m_matrixf32AxpyKernel(t_n, t_alpha * t_x[i], t_y, t_a + i * t_lda);
+	}
+}
+
+float m_matrixf32HouseholderKernel(float *t_x, size_t t_m, float *t_beta) {
+	const float alpha = t_x[0];
+	const float sigma = t_m > 1 ? m_matrixf32DotKernel(t_m - 1, t_x + 1, t_x + 1) : 0.0f;
+
+	t_x[0] = 1.0f;
+
+	if (sigma == 0.0f) {
+		*t_beta = alpha;
+
+		return 0.0f;
+	}
+
+	const float norm = sqrtf(alpha * alpha + sigma);
+	const float beta = alpha <= 0.0f ? norm : -norm;
+	const float scale = 1.0f / (alpha - beta);
+
+	for (size_t i = 1; i < t_m; ++i) {
+		t_x[i] *= scale;
+	}
+
+	*t_beta = beta;
+
+	return (beta - alpha) / beta;
+}
+
+void m_matrixf32HouseholderApplyKernel(size_t t_m, float t_tau, const float *t_v, size_t t_incv, float *t_x) {
+	if (t_tau == 0.0f || t_m == 0) return;
+
+	float dot = t_x[0];
+
+	for (size_t i = 1; i < t_m; ++i) {
+		dot += t_v[(i - 1) * t_incv] * t_x[i];
+	}
+
+	dot *= t_tau;
+	t_x[0] -= dot;
+
+	for (size_t i = 1; i < t_m; ++i) {
+		t_x[i] -= dot * t_v[(i - 1) * t_incv];
+	}
+}
+
+MatrixStatus matrixf32Dot(float *t_result, const MatrixF32Ptr t_x, const MatrixF32Ptr t_y) {
+	if (t_result == 0 || t_x == 0 || t_y == 0 || t_x->m_val == 0 || t_y->m_val == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixf32IsVector(t_x) || !m_matrixf32IsVector(t_y)) return MatrixStatusErrDimMismatch;
+	if (m_matrixf32BlasLength(t_x) != m_matrixf32BlasLength(t_y)) return MatrixStatusErrDimMismatch;
+
+	*t_result = m_matrixf32DotKernel(m_matrixf32BlasLength(t_x), t_x->m_val, t_y->m_val);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32Nrm2(float *t_result, const MatrixF32Ptr t_x) {
+	if (t_result == 0 || t_x == 0 || t_x->m_val == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixf32IsVector(t_x)) return MatrixStatusErrDimMismatch;
+
+	*t_result = m_matrixf32Nrm2Kernel(m_matrixf32BlasLength(t_x), t_x->m_val);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32Axpy(const MatrixF32Ptr t_y, float t_alpha, const MatrixF32Ptr t_x) {
+	if (t_x == 0 || t_y == 0 || t_x->m_val == 0 || t_y->m_val == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixf32IsVector(t_x) || !m_matrixf32IsVector(t_y)) return MatrixStatusErrDimMismatch;
+	if (m_matrixf32BlasLength(t_x) != m_matrixf32BlasLength(t_y)) return MatrixStatusErrDimMismatch;
+
+	m_matrixf32Touch(t_y);
+
+	m_matrixf32AxpyKernel(m_matrixf32BlasLength(t_x), t_alpha, t_x->m_val, t_y->m_val);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32Gemv(const MatrixF32Ptr t_y, float t_alpha, const MatrixF32Ptr t_mat_a, const MatrixF32Ptr t_x,
+						   float t_beta) {
+	if (t_y == 0 || t_mat_a == 0 || t_x == 0) return MatrixStatusErrNullPtr;
+	if (t_y->m_val == 0 || t_mat_a->m_val == 0 || t_x->m_val == 0) return MatrixStatusErrNullPtr;
+
+	const size_t m = t_mat_a->m_row, n = t_mat_a->m_col;
+	bool dim_not_matched = !m_matrixf32IsVector(t_x) || !m_matrixf32IsVector(t_y) ||
+						   m_matrixf32BlasLength(t_x) != n || m_matrixf32BlasLength(t_y) != m;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+
+	m_matrixf32Touch(t_y);
+
+	// a column-major A is the row-major buffer of A^T
+	if (t_mat_a->m_layout == MatrixLayoutRowMajor) {
+		m_matrixf32GemvKernel(m, n, t_alpha, t_mat_a->m_val, n, t_x->m_val, t_beta, t_y->m_val);
+	} else {
+		m_matrixf32GemvTransposedKernel(n, m, t_alpha, t_mat_a->m_val, m, t_x->m_val, t_beta, t_y->m_val);
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32GemvTransposed(const MatrixF32Ptr t_y, float t_alpha, const MatrixF32Ptr t_mat_a,
+									 const MatrixF32Ptr t_x, float t_beta) {
+	if (t_y == 0 || t_mat_a == 0 || t_x == 0) return MatrixStatusErrNullPtr;
+	if (t_y->m_val == 0 || t_mat_a->m_val == 0 || t_x->m_val == 0) return MatrixStatusErrNullPtr;
+
+	const size_t m = t_mat_a->m_row, n = t_mat_a->m_col;
+	bool dim_not_matched = !m_matrixf32IsVector(t_x) || !m_matrixf32IsVector(t_y) ||
+						   m_matrixf32BlasLength(t_x) != m || m_matrixf32BlasLength(t_y) != n;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+
+	m_matrixf32Touch(t_y);
+
+	if (t_mat_a->m_layout == MatrixLayoutRowMajor) {
+		m_matrixf32GemvTransposedKernel(m, n, t_alpha, t_mat_a->m_val, n, t_x->m_val, t_beta, t_y->m_val);
+	} else {
+		m_matrixf32GemvKernel(n, m, t_alpha, t_mat_a->m_val, m, t_x->m_val, t_beta, t_y->m_val);
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32Ger(const MatrixF32Ptr t_mat_a, float t_alpha, const MatrixF32Ptr t_x, const MatrixF32Ptr t_y) {
+	if (t_mat_a == 0 || t_x == 0 || t_y == 0) return MatrixStatusErrNullPtr;
+	if (t_mat_a->m_val == 0 || t_x->m_val == 0 || t_y->m_val == 0) return MatrixStatusErrNullPtr;
+
+	const size_t m = t_mat_a->m_row, n = t_mat_a->m_col;
+	bool dim_not_matched = !m_matrixf32IsVector(t_x) || !m_matrixf32IsVector(t_y) ||
+						   m_matrixf32BlasLength(t_x) != m || m_matrixf32BlasLength(t_y) != n;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+
+	m_matrixf32Touch(t_mat_a);
+
+	// A^T += alpha * y * x^T on the buffer of a column-major A
+	if (t_mat_a->m_layout == MatrixLayoutRowMajor) {
+		m_matrixf32GerKernel(m, n, t_alpha, t_x->m_val, t_y->m_val, t_mat_a->m_val, n);
+	} else {
+		m_matrixf32GerKernel(n, m, t_alpha, t_y->m_val, t_x->m_val, t_mat_a->m_val, m);
+	}
+
+	return MatrixStatusOK;
+}
@@ -0,0 +1,83 @@
+/**
+ * @Date:   2026-10-20T09:14:26+08:00
+ * @Last modified time: 2026-10-20T09:14:26+08:00
+ */
+
+#include "src/matrix_f32_private.h"
+
+#ifdef MATRIX_F32_ENABLE_CBLAS
+
+#include <cblas.h>
+#include <lapacke.h>
+#include <math.h>
+#include <string.h>
+
+// private function
+static void m_matrixf32CblasGemm(size_t t_m, size_t t_n, size_t t_k, float t_alpha, const float *t_a, size_t t_lda,
+								 const float *t_b, size_t t_ldb, bool t_accumulate, float *t_c, size_t t_ldc) {
+	if (t_m == 0 || t_n == 0) return;
+
+	// leading dimensions must be at least 1 even if the operand is empty
+	cblas_sgemm(CblasRowMajor, CblasNoTrans, CblasNoTrans, (int)t_m, (int)t_n, (int)t_k, t_alpha, t_a,
+				(int)(t_lda > 0 ? t_lda : 1), t_b, (int)(t_ldb > 0 ? t_ldb : 1), t_accumulate ? 1.0f : 0.0f, t_c,
+				(int)t_ldc);
+}
+
+static bool m_matrixf32CblasGetrf(float *t_a, size_t t_n, size_t *t_pivot) {
+	lapack_int *ipiv = MATRIX_F32_MALLOC(t_n * sizeof(lapack_int));
+
+	if (ipiv == 0) return false;
+
+	lapack_int info = LAPACKE_sgetrf(LAPACK_ROW_MAJOR, (lapack_int)t_n, (lapack_int)t_n, t_a, (lapack_int)t_n, ipiv);
+
+	// a zero pivot at step info - 1, the interchanges before it are valid
+	const size_t steps = info > 0 ? (size_t)info - 1 : t_n;
+
+	for (size_t i = 0; i < steps; ++i) {
+		t_pivot[i] = (size_t)ipiv[i] - 1;
+	}
+
+	MATRIX_F32_FREE(ipiv);
+
+	return info == 0;
+}
+
+static void m_matrixf32CblasLUForward(const float *t_lu, const float *t_permutation, size_t t_n, const float *t_b,
+									  size_t t_k, float *t_y) {
+	for (size_t j = 0; j < t_n; ++j) {
+		float *y_row = t_y + j * t_k;
+		const size_t source_row = (size_t)t_permutation[j];
+
+		if (t_b != 0) {
+			memcpy(y_row, t_b + source_row * t_k, t_k * sizeof(float));
+		} else {
+			for (size_t i = 0; i < t_k; ++i) {
+				y_row[i] = (float)(i == source_row);
+			}
+		}
+	}
+
+	if (t_n == 0 || t_k == 0) return;
+
+	cblas_strsm(CblasRowMajor, CblasLeft, CblasLower, CblasNoTrans, CblasUnit, (int)t_n, (int)t_k, 1.0f, t_lu,
+				(int)t_n, t_y, (int)t_k);
+}
+
+static bool m_matrixf32CblasLUBackward(const float *t_lu, size_t t_n, float *t_x, size_t t_k) {
+	// same singularity threshold as matrixf32BackwardSubstitution
+	for (size_t j = 0; j < t_n; ++j) {
+		if (fabsf(t_lu[j * t_n + j]) <= 1e-6f) return false;
+	}
+
+	if (t_n == 0 || t_k == 0) return true;
+
+	cblas_strsm(CblasRowMajor, CblasLeft, CblasUpper, CblasNoTrans, CblasNonUnit, (int)t_n, (int)t_k, 1.0f, t_lu,
+				(int)t_n, t_x, (int)t_k);
+
+	return true;
+}
+
+const MatrixF32BackendOps m_matrixf32CblasOps = {m_matrixf32CblasGemm, m_matrixf32CblasGetrf,
+												  m_matrixf32CblasLUForward, m_matrixf32CblasLUBackward};
+
+#endif
@@ -0,0 +1,176 @@
+/**
+ * @Date:   2026-10-19T19:02:16+08:00
+ * @Last modified time: 2026-10-19T19:02:16+08:00
+ */
+
+#include "include/matrix_f32_cholesky.h"
+#include "src/matrix_f32_private.h"
+
+#include <math.h>
+#include <string.h>
+
+// private function
+bool m_matrixf32CholeskyKernel(float *t_a, size_t t_n, size_t t_lda) {
+	for (size_t i = 0; i < t_n; ++i) {
+		float *row_i = t_a + i * t_lda;
+
+		for (size_t j = 0; j <= i; ++j) {
+			const float *row_j = t_a + j * t_lda;
+			float sum = row_i[j];
+
+			for (size_t p = 0; p < j; ++p) {
+				sum -= row_i[p] * row_j[p];
+			}
+
+			if (i == j) {
+				if (!(sum > 0.0f)) return false;
+				row_i[i] = sqrtf(sum);
+			} else {
+				row_i[j] = sum / row_j[j];
+			}
+		}
+
+		for (size_t j = i + 1; j < t_n; ++j) {
+			row_i[j] = 0.0f;
+		}
+	}
+
+	return true;
+}
+
+void m_matrixf32CholeskySolveKernel(const float *t_l, size_t t_n, size_t t_ldl, float *t_b, size_t t_k,
+									size_t t_ldb) {
+	// L * Y = B
+	for (size_t i = 0; i < t_n; ++i) {
+		float *row_i = t_b + i * t_ldb;
+
+		for (size_t p = 0; p < i; ++p) {
+			const float l_ip = t_l[i * t_ldl + p];
+			const float *row_p = t_b + p * t_ldb;
+
+			for (size_t c = 0; c < t_k; ++c) {
+				row_i[c] -= l_ip * row_p[c];
+			}
+		}
+
+		const float inv_diag = 1.0f / t_l[i * t_ldl + i];
+
+		for (size_t c = 0; c < t_k; ++c) {
+			row_i[c] *= inv_diag;
+		}
+	}
+
+	// L^T * X = Y
+	for (size_t i = t_n; i-- > 0;) {
+		float *row_i = t_b + i * t_ldb;
+
+		for (size_t p = i + 1; p < t_n; ++p) {
+			const float l_pi = t_l[p * t_ldl + i];
+			const float *row_p = t_b + p * t_ldb;
+
+			for (size_t c = 0; c < t_k; ++c) {
+				row_i[c] -= l_pi * row_p[c];
+			}
+		}
+
+		const float inv_diag = 1.0f / t_l[i * t_ldl + i];
+
+		for (size_t c = 0; c < t_k; ++c) {
+			row_i[c] *= inv_diag;
+		}
+	}
+}
+
+MatrixStatus matrixf32Cholesky(const MatrixF32Ptr t_result, const MatrixF32Ptr t_source) {
+	if (t_result == 0 || t_source == 0 || t_result->m_val == 0 || t_source->m_val == 0) return MatrixStatusErrNullPtr;
+
+	bool dim_not_matched = t_source->m_row != t_source->m_col || t_result->m_row != t_source->m_row ||
+						   t_result->m_col != t_source->m_col;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+	if (!m_matrixf32RowMajorBuffer(t_result) || !m_matrixf32RowMajorBuffer(t_source)) return MatrixStatusErrLayout;
+
+	const size_t n = t_source->m_row;
+	m_matrixf32Touch(t_result);
+	if (t_result->m_val != t_source->m_val) memcpy(t_result->m_val, t_source->m_val, n * n * sizeof(float));
+
+	return m_matrixf32CholeskyKernel(t_result->m_val, n, n) ? MatrixStatusOK : MatrixStatusErrSingular;
+}
+
+MatrixStatus matrixf32CholeskySolve(const MatrixF32Ptr t_result, const MatrixF32Ptr t_lower,
+									const MatrixF32Ptr t_column) {
+	if (t_result == 0 || t_lower == 0 || t_column == 0) return MatrixStatusErrNullPtr;
+	if (t_result->m_val == 0 || t_lower->m_val == 0 || t_column->m_val == 0) return MatrixStatusErrNullPtr;
+
+	bool dim_not_matched = t_lower->m_row != t_lower->m_col || t_column->m_row != t_lower->m_row ||
+						   t_result->m_row != t_column->m_row || t_result->m_col != t_column->m_col;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+	bool row_major = m_matrixf32RowMajorBuffer(t_lower) && m_matrixf32RowMajorBuffer(t_column) &&
+					 m_matrixf32RowMajorBuffer(t_result);
+	if (!row_major) return MatrixStatusErrLayout;
+
+	const size_t n = t_lower->m_row;
+
+	for (size_t i = 0; i < n; ++i) {
+		if (t_lower->m_val[i * n + i] == 0.0f) return MatrixStatusErrSingular;
+	}
+
+	m_matrixf32Touch(t_result);
+
+	if (t_result->m_val != t_column->m_val) {
+		memcpy(t_result->m_val, t_column->m_val, t_column->m_row * t_column->m_col * sizeof(float));
+	}
+
+	m_matrixf32CholeskySolveKernel(t_lower->m_val, n, n, t_result->m_val, t_result->m_col, t_result->m_col);
+
+	return MatrixStatusOK;
+}
+
+/**
+ *	Rank-1 update (t_sign = 1) or downdate (t_sign = -1) with a sequence of Givens (hyperbolic for the downdate)
+ *	rotations, one per column of L.
+ */
+static MatrixStatus m_matrixf32CholeskyRankOne(const MatrixF32Ptr t_lower, const MatrixF32Ptr t_vector,
+												float t_sign) {
+	if (t_lower == 0 || t_vector == 0 || t_lower->m_val == 0 || t_vector->m_val == 0) return MatrixStatusErrNullPtr;
+
+	bool dim_not_matched = t_lower->m_row != t_lower->m_col || t_vector->m_row != t_lower->m_row ||
+						   t_vector->m_col != 1;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+	if (!m_matrixf32RowMajorBuffer(t_lower)) return MatrixStatusErrLayout;
+
+	m_matrixf32Touch(t_lower);
+	m_matrixf32Touch(t_vector);
+
+	const size_t n = t_lower->m_row;
+	float *l = t_lower->m_val;
+	float *x = t_vector->m_val;
+
+	for (size_t k = 0; k < n; ++k) {
+		const float l_kk = l[k * n + k];
+		const float r_squared = l_kk * l_kk + t_sign * x[k] * x[k];
+
+		if (l_kk == 0.0f || !(r_squared > 0.0f)) return MatrixStatusErrSingular;
+
+		const float r = sqrtf(r_squared);
+		const float c = r / l_kk;
+		const float s = x[k] / l_kk;
+		l[k * n + k] = r;
+
+		for (size_t i = k + 1; i < n; ++i) {
+			float *l_ik = &l[i * n + k];
+
+			*l_ik = (*l_ik + t_sign * s * x[i]) / c;
+			x[i] = c * x[i] - s * *l_ik;
+		}
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32CholeskyUpdate(const MatrixF32Ptr t_lower, const MatrixF32Ptr t_vector) {
+	return m_matrixf32CholeskyRankOne(t_lower, t_vector, 1.0f);
+}
+
+MatrixStatus matrixf32CholeskyDowndate(const MatrixF32Ptr t_lower, const MatrixF32Ptr t_vector) {
+	return m_matrixf32CholeskyRankOne(t_lower, t_vector, -1.0f);
+}
@@ -0,0 +1,291 @@
+/**
+ * @Date:   2026-10-20T19:26:48+08:00
+ * @Last modified time: 2026-10-20T19:26:48+08:00
+ */
+
+#include "include/matrix_f32_determinant.h"
+#include "src/matrix_f32_private.h"
+
+#include <math.h>
+
+#define MATRIX_F32_RCOND_MAX_ITERATIONS 5
+
+/**
+ *	The LU factors of an n x n matrix, entry (i, j) is at m_val[i * m_rowStride + j * m_colStride]
+ */
+typedef struct MatrixF32Factors {
+	const float *m_val;
+	const float *m_permutation;
+	size_t m_n;
+	size_t m_rowStride;
+	size_t m_colStride;
+} MatrixF32FactorsType;
+
+// private function
+static inline float m_matrixf32FactorAt(const MatrixF32FactorsType *t_factors, size_t t_row, size_t t_col) {
+	return t_factors->m_val[t_row * t_factors->m_rowStride + t_col * t_factors->m_colStride];
+}
+
+static MatrixStatus m_matrixf32FactorsInit(MatrixF32FactorsType *t_factors, const MatrixF32Ptr t_lu,
+										   const MatrixF32Ptr t_permutation) {
+	if (t_lu == 0 || t_permutation == 0 || t_lu->m_val == 0 || t_permutation->m_val == 0) {
+		return MatrixStatusErrNullPtr;
+	}
+
+	const size_t n = t_lu->m_row;
+	bool dim_not_matched = t_lu->m_col != n || !m_matrixf32IsVector(t_permutation) ||
+						   t_permutation->m_row * t_permutation->m_col != n;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+
+	for (size_t i = 0; i < n; ++i) {
+		const float row = t_permutation->m_val[i];
+
+		if (!(row >= 0.0f && row < (float)n) || row != floorf(row)) return MatrixStatusErrOutOfBound;
+	}
+
+	t_factors->m_val = t_lu->m_val;
+	t_factors->m_permutation = t_permutation->m_val;
+	t_factors->m_n = n;
+	t_factors->m_rowStride = m_matrixf32RowStride(t_lu);
+	t_factors->m_colStride = m_matrixf32ColStride(t_lu);
+
+	return MatrixStatusOK;
+}
+
+/**
+ *	Sign of the permutation, (-1)^(n - number of cycles). Each cycle is walked from its smallest row only
+ */
+static float m_matrixf32PermutationSign(const MatrixF32FactorsType *t_factors) {
+	size_t transpositions = 0;
+
+	for (size_t i = 0; i < t_factors->m_n; ++i) {
+		size_t len = 1, row = (size_t)t_factors->m_permutation[i];
+
+		for (; row != i && row > i && len <= t_factors->m_n; ++len) {
+			row = (size_t)t_factors->m_permutation[row];
+		}
+
+		if (row == i) transpositions += len - 1;
+	}
+
+	return (transpositions & 1) ? -1.0f : 1.0f;
+}
+
+/**
+ *	det(A) as t_mantissa * 2^t_exponent with t_mantissa in [0.5, 1) in magnitude, or 0
+ */
+static void m_matrixf32FactorsDeterminant(const MatrixF32FactorsType *t_factors, float *t_mantissa,
+										  int *t_exponent) {
+	float mantissa = m_matrixf32PermutationSign(t_factors);
+	int exponent = 0;
+
+	// renormalized after every factor so the running product neither overflows nor underflows
+	for (size_t i = 0; i < t_factors->m_n; ++i) {
+		int factor_exponent;
+
+		mantissa = frexpf(mantissa * m_matrixf32FactorAt(t_factors, i, i), &factor_exponent);
+		exponent += factor_exponent;
+	}
+
+	*t_mantissa = mantissa;
+	*t_exponent = exponent;
+}
+
+static inline float m_matrixf32FactorsDot(const float *t_lu, size_t t_stride, size_t t_n, const float *t_x) {
+	if (t_stride == 1) return m_matrixf32DotKernel(t_n, t_lu, t_x);
+
+	float sum = 0.0f;
+
+	for (size_t k = 0; k < t_n; ++k) {
+		sum += t_lu[k * t_stride] * t_x[k];
+	}
+
+	return sum;
+}
+
+/**
+ *	Solves A * t_y = t_x, t_y = U^-1 * L^-1 * P * t_x
+ */
+static void m_matrixf32FactorsSolve(const MatrixF32FactorsType *t_factors, const float *t_x, float *t_y) {
+	const size_t n = t_factors->m_n, rs = t_factors->m_rowStride, cs = t_factors->m_colStride;
+
+	for (size_t i = 0; i < n; ++i) {
+		t_y[i] = t_x[(size_t)t_factors->m_permutation[i]];
+	}
+
+	for (size_t i = 0; i < n; ++i) {
+		t_y[i] -= m_matrixf32FactorsDot(t_factors->m_val + i * rs, cs, i, t_y);
+	}
+
+	for (size_t i = n; i-- > 0;) {
+		const float *row = t_factors->m_val + i * rs + (i + 1) * cs;
+
+		t_y[i] = (t_y[i] - m_matrixf32FactorsDot(row, cs, n - i - 1, t_y + i + 1)) /
+				 m_matrixf32FactorAt(t_factors, i, i);
+	}
+}
+
+/**
+ *	Solves A^T * t_z = t_x, t_z = P^T * L^-T * U^-T * t_x, t_x is overwritten
+ */
+static void m_matrixf32FactorsSolveTransposed(const MatrixF32FactorsType *t_factors, float *t_x, float *t_z) {
+	const size_t n = t_factors->m_n, rs = t_factors->m_rowStride, cs = t_factors->m_colStride;
+
+	// the columns of the factors are the rows of their transposes
+	for (size_t i = 0; i < n; ++i) {
+		t_x[i] = (t_x[i] - m_matrixf32FactorsDot(t_factors->m_val + i * cs, rs, i, t_x)) /
+				 m_matrixf32FactorAt(t_factors, i, i);
+	}
+
+	for (size_t i = n; i-- > 0;) {
+		const float *col = t_factors->m_val + (i + 1) * rs + i * cs;
+
+		t_x[i] -= m_matrixf32FactorsDot(col, rs, n - i - 1, t_x + i + 1);
+	}
+
+	for (size_t i = 0; i < n; ++i) {
+		t_z[(size_t)t_factors->m_permutation[i]] = t_x[i];
+	}
+}
+
+static float m_matrixf32NormOne(size_t t_n, const float *t_x) {
+	float sum = 0.0f;
+
+	for (size_t i = 0; i < t_n; ++i) {
+		sum += fabsf(t_x[i]);
+	}
+
+	return sum;
+}
+
+/**
+ *	Lower bound of ||A^-1||_1, Higham's Algorithm 4.1 (ACM TOMS 14(4), 1988) built on Hager's method. x moves to the
+ *	unit vector of the largest gradient entry until the estimate stops growing, then an alternating vector guards
+ *	against the cases where the gradient is misleading
+ */
+static float m_matrixf32FactorsInverseNorm(const MatrixF32FactorsType *t_factors, float *t_workspace) {
+	const size_t n = t_factors->m_n;
+	float *x = t_workspace, *y = t_workspace + n, *sign = t_workspace + 2 * n;
+	float estimate = 0.0f;
+	size_t unit = n;  // index of the unit vector in x, n for the first iteration
+
+	for (size_t i = 0; i < n; ++i) {
+		x[i] = 1.0f / (float)n;
+	}
+
+	for (size_t iteration = 0; iteration < MATRIX_F32_RCOND_MAX_ITERATIONS; ++iteration) {
+		m_matrixf32FactorsSolve(t_factors, x, y);
+
+		const float norm = m_matrixf32NormOne(n, y);
+
+		if (unit < n && norm <= estimate) break;
+
+		estimate = norm;
+
+		bool sign_changed = false;
+
+		for (size_t i = 0; i < n; ++i) {
+			const float s = y[i] >= 0.0f ? 1.0f : -1.0f;
+
+			if (unit == n || s != sign[i]) sign_changed = true;
+			sign[i] = s;
+			y[i] = s;
+		}
+
+		if (!sign_changed) break;
+
+		// the gradient A^-T * sign(y), x holds it afterwards
+		m_matrixf32FactorsSolveTransposed(t_factors, y, x);
+
+		size_t largest = 0;
+
+		for (size_t i = 1; i < n; ++i) {
+			if (fabsf(x[i]) > fabsf(x[largest])) largest = i;
+		}
+
+		if (unit < n && fabsf(x[largest]) <= x[unit]) break;
+
+		for (size_t i = 0; i < n; ++i) {
+			x[i] = (float)(i == largest);
+		}
+
+		unit = largest;
+	}
+
+	// x_i = (-1)^i * (1 + i / (n - 1))
+	for (size_t i = 0; i < n; ++i) {
+		const float magnitude = 1.0f + (n > 1 ? (float)i / (float)(n - 1) : 0.0f);
+
+		x[i] = (i & 1) ? -magnitude : magnitude;
+	}
+
+	m_matrixf32FactorsSolve(t_factors, x, y);
+
+	const float alternative = 2.0f * m_matrixf32NormOne(n, y) / (3.0f * (float)n);
+
+	return alternative > estimate ? alternative : estimate;
+}
+
+MatrixStatus matrixf32LUDeterminant(float *t_result, const MatrixF32Ptr t_lu, const MatrixF32Ptr t_permutation) {
+	if (t_result == 0) return MatrixStatusErrNullPtr;
+
+	MatrixF32FactorsType factors;
+	MatrixStatus ret_val = m_matrixf32FactorsInit(&factors, t_lu, t_permutation);
+	if (ret_val != MatrixStatusOK) return ret_val;
+
+	float mantissa;
+	int exponent;
+	m_matrixf32FactorsDeterminant(&factors, &mantissa, &exponent);
+
+	*t_result = ldexpf(mantissa, exponent);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32LULogDeterminant(float *t_result, float *t_sign, const MatrixF32Ptr t_lu,
+									   const MatrixF32Ptr t_permutation) {
+	if (t_result == 0) return MatrixStatusErrNullPtr;
+
+	MatrixF32FactorsType factors;
+	MatrixStatus ret_val = m_matrixf32FactorsInit(&factors, t_lu, t_permutation);
+	if (ret_val != MatrixStatusOK) return ret_val;
+
+	float mantissa;
+	int exponent;
+	m_matrixf32FactorsDeterminant(&factors, &mantissa, &exponent);
+
+	// log|m * 2^e| = log|m| + e * log(2), in double so a large e does not cost digits
+	*t_result = mantissa == 0.0f ? -INFINITY : (float)(log(fabs((double)mantissa)) + exponent * log(2.0));
+
+	if (t_sign != 0) *t_sign = mantissa > 0.0f ? 1.0f : (mantissa < 0.0f ? -1.0f : mantissa);
+
+	return MatrixStatusOK;
+}
+
+size_t matrixf32LURcondWorkspaceLen(size_t t_n) { return 3 * t_n; }
+
+MatrixStatus matrixf32LURcond(float *t_result, const MatrixF32Ptr t_lu, const MatrixF32Ptr t_permutation,
+							  float t_norm_a, float *t_workspace, size_t t_workspace_len) {
+	if (t_result == 0 || t_workspace == 0) return MatrixStatusErrNullPtr;
+
+	MatrixF32FactorsType factors;
+	MatrixStatus ret_val = m_matrixf32FactorsInit(&factors, t_lu, t_permutation);
+	if (ret_val != MatrixStatusOK) return ret_val;
+
+	if (t_workspace_len < matrixf32LURcondWorkspaceLen(factors.m_n)) return MatrixStatusErrOutOfBound;
+
+	*t_result = 0.0f;
+
+	if (!(t_norm_a > 0.0f)) return MatrixStatusOK;
+
+	for (size_t i = 0; i < factors.m_n; ++i) {
+		if (m_matrixf32FactorAt(&factors, i, i) == 0.0f) return MatrixStatusOK;
+	}
+
+	const float inverse_norm = m_matrixf32FactorsInverseNorm(&factors, t_workspace);
+
+	// an inverse norm beyond the float range is singular to working precision as well
+	if (isfinite(inverse_norm) && inverse_norm > 0.0f) *t_result = 1.0f / t_norm_a / inverse_norm;
+
+	return MatrixStatusOK;
+}
@@ -0,0 +1,310 @@
+/**
+ * @Date:   2026-10-19T23:41:52+08:00
+ * @Last modified time: 2026-10-19T23:41:52+08:00
+ */
+
+#include "include/matrix_f32_eigen.h"
+#include "src/matrix_f32_private.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+#ifndef MATRIX_F32_EIGEN_BLOCK
+#define MATRIX_F32_EIGEN_BLOCK 32
+#endif
+
+// QL iterations allowed per eigenvalue
+#define MATRIX_F32_EIGEN_MAX_ITERATIONS 30
+
+// private function
+static size_t m_matrixf32EigenBlock(size_t t_n) { return t_n < MATRIX_F32_EIGEN_BLOCK ? t_n : MATRIX_F32_EIGEN_BLOCK; }
+
+static float m_matrixf32EigenDot(const float *t_x, const float *t_y, size_t t_len) {
+	float sum = 0.0f;
+
+	for (size_t i = 0; i < t_len; ++i) {
+		sum += t_x[i] * t_y[i];
+	}
+
+	return sum;
+}
+
+/**
+ *	Reduces the full symmetric n x n t_a to tridiagonal form Q^T A Q with diagonal t_d and subdiagonal t_e. The
+ *	reflectors of Q are left below the subdiagonal of t_a with their scalars in t_tau.
+ *
+ *	The columns are processed in panels of b. Within a panel the trailing matrix is not updated, the reflector
+ *	vectors v and the vectors w of the rank-2 updates A -= v w^T + w v^T are collected in t_vt and t_wt (b x n) and
+ *	applied to the columns of the panel as needed. The trailing matrix then takes all 2b updates at once through the
+ *	GEMM kernel, with t_v and t_w (n x b) holding the transposes.
+ */
+static void m_matrixf32EigenTridiagonalize(float *t_a, size_t t_n, float *t_d, float *t_e, float *t_tau, float *t_vt,
+										   float *t_wt, float *t_v, float *t_w) {
+	const size_t n = t_n;
+	const size_t block = m_matrixf32EigenBlock(n);
+
+	for (size_t start = 0; start + 1 < n; start += block) {
+		const size_t panel = n - 1 - start < block ? n - 1 - start : block;
+
+		for (size_t j = 0; j < panel; ++j) {
+			const size_t i = start + j;
+			float *v = t_vt + j * n;
+			float *w = t_wt + j * n;
+
+			// bring column i up to date with the updates of the panel so far
+			for (size_t q = 0; q < j; ++q) {
+				const float *vq = t_vt + q * n;
+				const float *wq = t_wt + q * n;
+
+				for (size_t r = i; r < n; ++r) {
+					t_a[r * n + i] -= vq[r] * wq[i] + wq[r] * vq[i];
+				}
+			}
+
+			t_d[i] = t_a[i * n + i];
+
+			memset(v, 0, (i + 1) * sizeof(float));
+			memset(w, 0, (i + 1) * sizeof(float));
+
+			for (size_t r = i + 1; r < n; ++r) {
+				v[r] = t_a[r * n + i];
+			}
+
+			const size_t m = n - i - 1;
+			const float tau = m_matrixf32HouseholderKernel(v + i + 1, m, &t_e[i]);
+			t_tau[i] = tau;
+
+			for (size_t r = i + 2; r < n; ++r) {
+				t_a[r * n + i] = v[r];
+			}
+
+			if (tau == 0.0f) {
+				memset(w + i + 1, 0, m * sizeof(float));
+				continue;
+			}
+
+			// p = tau * A22 v with A22 = stored A22 - V W^T - W V^T
+			for (size_t r = i + 1; r < n; ++r) {
+				w[r] = m_matrixf32EigenDot(t_a + r * n + i + 1, v + i + 1, m);
+			}
+
+			for (size_t q = 0; q < j; ++q) {
+				const float *vq = t_vt + q * n;
+				const float *wq = t_wt + q * n;
+				const float wv = m_matrixf32EigenDot(wq + i + 1, v + i + 1, m);
+				const float vv = m_matrixf32EigenDot(vq + i + 1, v + i + 1, m);
+
+				for (size_t r = i + 1; r < n; ++r) {
+					w[r] -= vq[r] * wv + wq[r] * vv;
+				}
+			}
+
+			// w = p - (tau / 2) (p^T v) v
+			for (size_t r = i + 1; r < n; ++r) {
+				w[r] *= tau;
+			}
+
+			const float alpha = -0.5f * tau * m_matrixf32EigenDot(w + i + 1, v + i + 1, m);
+
+			for (size_t r = i + 1; r < n; ++r) {
+				w[r] += alpha * v[r];
+			}
+		}
+
+		// A[s:, s:] -= V W^T + W V^T
+		const size_t trailing_start = start + panel;
+		const size_t m = n - trailing_start;
+
+		for (size_t r = 0; r < m; ++r) {
+			for (size_t q = 0; q < panel; ++q) {
+				t_v[r * panel + q] = t_vt[q * n + trailing_start + r];
+				t_w[r * panel + q] = t_wt[q * n + trailing_start + r];
+			}
+		}
+
+		float *trailing = t_a + trailing_start * n + trailing_start;
+
+		m_matrixf32GemmKernel(m, m, panel, -1.0f, t_v, panel, t_wt + trailing_start, n, true, trailing, n);
+		m_matrixf32GemmKernel(m, m, panel, -1.0f, t_w, panel, t_vt + trailing_start, n, true, trailing, n);
+	}
+
+	t_d[n - 1] = t_a[(n - 1) * n + n - 1];
+	t_e[n - 1] = 0.0f;
+}
+
+/**
+ *	Diagonalizes the symmetric tridiagonal matrix (t_d, t_e) in place by the implicit QL algorithm. The rotations are
+ *	accumulated into the rows of t_zt if it is not NULL, row i then holds the eigenvector of t_d[i].
+ */
+static bool m_matrixf32EigenTridiagonalQL(float *t_d, float *t_e, size_t t_n, float *t_zt) {
+	for (size_t l = 0; l < t_n; ++l) {
+		size_t iterations = 0;
+		size_t m;
+
+		do {
+			for (m = l; m + 1 < t_n; ++m) {
+				const float dd = fabsf(t_d[m]) + fabsf(t_d[m + 1]);
+
+				if (fabsf(t_e[m]) <= FLT_EPSILON * dd) break;
+			}
+
+			if (m == l) break;
+			if (iterations++ == MATRIX_F32_EIGEN_MAX_ITERATIONS) return false;
+
+			// Wilkinson shift
+			float g = (t_d[l + 1] - t_d[l]) / (2.0f * t_e[l]);
+			float r = hypotf(g, 1.0f);
+			g = t_d[m] - t_d[l] + t_e[l] / (g + copysignf(r, g));
+
+			float s = 1.0f, c = 1.0f, p = 0.0f;
+			bool underflow = false;
+
+			for (size_t i = m; i-- > l;) {
+				const float f = s * t_e[i];
+				const float b = c * t_e[i];
+
+				r = hypotf(f, g);
+				t_e[i + 1] = r;
+
+				if (r == 0.0f) {
+					t_d[i + 1] -= p;
+					t_e[m] = 0.0f;
+					underflow = true;
+					break;
+				}
+
+				s = f / r;
+				c = g / r;
+				g = t_d[i + 1] - p;
+				r = (t_d[i] - g) * s + 2.0f * c * b;
+				p = s * r;
+				t_d[i + 1] = g + p;
+				g = c * r - b;
+
+				if (t_zt != 0) {
+					float *z_i = t_zt + i * t_n;
+					float *z_next = z_i + t_n;
+
+					for (size_t k = 0; k < t_n; ++k) {
+						const float z = z_next[k];
+						z_next[k] = s * z_i[k] + c * z;
+						z_i[k] = c * z_i[k] - s * z;
+					}
+				}
+			}
+
+			if (underflow) continue;
+
+			t_d[l] -= p;
+			t_e[l] = g;
+			t_e[m] = 0.0f;
+		} while (m != l);
+	}
+
+	return true;
+}
+
+size_t matrixf32SymEigenWorkspaceLen(size_t t_n, bool t_vectors) {
+	if (t_n == 0) return 0;
+
+	return t_n * t_n * (t_vectors ? 2 : 1) + 3 * t_n + 4 * t_n * m_matrixf32EigenBlock(t_n);
+}
+
+MatrixStatus matrixf32SymEigen(const MatrixF32Ptr t_values, const MatrixF32Ptr t_vectors, const MatrixF32Ptr t_source,
+							   float *t_workspace, size_t t_workspace_len) {
+	if (t_values == 0 || t_source == 0 || t_workspace == 0) return MatrixStatusErrNullPtr;
+	if (t_values->m_val == 0 || t_source->m_val == 0 || (t_vectors != 0 && t_vectors->m_val == 0)) {
+		return MatrixStatusErrNullPtr;
+	}
+
+	const size_t n = t_source->m_row;
+	const size_t k = t_values->m_row;
+	bool dim_not_matched = t_source->m_col != n || t_values->m_col != 1 || k > n ||
+						   (t_vectors != 0 && (t_vectors->m_row != n || t_vectors->m_col != k));
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+	if (!m_matrixf32RowMajorBuffer(t_vectors) || !m_matrixf32RowMajorBuffer(t_source)) return MatrixStatusErrLayout;
+	if (t_workspace_len < matrixf32SymEigenWorkspaceLen(n, t_vectors != 0)) return MatrixStatusErrOutOfBound;
+
+	const size_t block = m_matrixf32EigenBlock(n);
+	float *a = t_workspace;
+	float *d = a + n * n;
+	float *e = d + n;
+	float *tau = e + n;
+	float *vt = tau + n;
+	float *wt = vt + block * n;
+	float *v = wt + block * n;
+	float *w = v + n * block;
+	float *zt = t_vectors != 0 ? w + n * block : 0;
+
+	// symmetric copy of the lower triangle
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t j = 0; j <= i; ++j) {
+			a[i * n + j] = t_source->m_val[i * n + j];
+			a[j * n + i] = t_source->m_val[i * n + j];
+		}
+	}
+
+	m_matrixf32EigenTridiagonalize(a, n, d, e, tau, vt, wt, v, w);
+
+	if (zt != 0) {
+		memset(zt, 0, n * n * sizeof(float));
+
+		for (size_t i = 0; i < n; ++i) {
+			zt[i * n + i] = 1.0f;
+		}
+	}
+
+	if (!m_matrixf32EigenTridiagonalQL(d, e, n, zt)) return MatrixStatusErrSingular;
+
+	// selection of the k largest, the eigenvectors follow their eigenvalues
+	for (size_t j = 0; j < k; ++j) {
+		size_t largest = j;
+
+		for (size_t i = j + 1; i < n; ++i) {
+			if (d[i] > d[largest]) largest = i;
+		}
+
+		if (largest == j) continue;
+
+		const float swap = d[j];
+		d[j] = d[largest];
+		d[largest] = swap;
+
+		for (size_t c = 0; zt != 0 && c < n; ++c) {
+			const float swap_z = zt[j * n + c];
+			zt[j * n + c] = zt[largest * n + c];
+			zt[largest * n + c] = swap_z;
+		}
+	}
+
+	m_matrixf32Touch(t_values);
+	memcpy(t_values->m_val, d, k * sizeof(float));
+
+	if (t_vectors == 0) return MatrixStatusOK;
+
+	m_matrixf32Touch(t_vectors);
+
+	for (size_t j = 0; j < k; ++j) {
+		float *y = zt + j * n;
+
+		// Q z = H_0 (H_1 (... H_n-2 z))
+		for (size_t i = n - 1; i-- > 0;) {
+			m_matrixf32HouseholderApplyKernel(n - i - 1, tau[i], a + (i + 2) * n + i, n, y + i + 1);
+		}
+
+		size_t largest = 0;
+
+		for (size_t r = 1; r < n; ++r) {
+			if (fabsf(y[r]) > fabsf(y[largest])) largest = r;
+		}
+
+		const float sign = y[largest] < 0.0f ? -1.0f : 1.0f;
+
+		for (size_t r = 0; r < n; ++r) {
+			t_vectors->m_val[r * k + j] = sign * y[r];
+		}
+	}
+
+	return MatrixStatusOK;
+}
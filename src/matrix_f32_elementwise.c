@@ -0,0 +1,455 @@
+/**
+ * @Date:   2026-10-20T17:05:13+08:00
+ * @Last modified time: 2026-10-20T17:05:13+08:00
+ */
+
+#include "include/matrix_f32_elementwise.h"
+#include "src/matrix_f32_private.h"
+
+#include <math.h>
+#include <string.h>
+
+// the exponential needs integer lanes, hence SSE2, and sqrt and division need AArch64
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define MATRIX_F32_ELEMENTWISE_NEON
+#endif
+
+// floats per block, operands in another layout than the result are gathered into a block that stays in L1. Two
+// blocks live on the stack of every call, 2 KiB with the vector kernels and 512 bytes for a Cortex-M without them
+#ifndef MATRIX_F32_ELEMENTWISE_BLOCK
+#if defined(__SSE2__) || defined(MATRIX_F32_ELEMENTWISE_NEON)
+#define MATRIX_F32_ELEMENTWISE_BLOCK 256
+#else
+#define MATRIX_F32_ELEMENTWISE_BLOCK 64
+#endif
+#endif
+
+// exp(x) = 2^k * exp(r) with |r| <= ln(2) / 2, ln(2) split so k * MATRIX_F32_EXP_LN2_HI is exact
+#define MATRIX_F32_EXP_LOG2E 1.44269504088896341f
+#define MATRIX_F32_EXP_LN2_HI 0.693359375f
+#define MATRIX_F32_EXP_LN2_LO -2.12194440e-4f
+#define MATRIX_F32_EXP_MIN -104.0f	// 2^k over- or underflows beyond these, k stays in [-150, 128]
+#define MATRIX_F32_EXP_MAX 89.0f
+
+/**
+ *	Operand of the elementwise kernels, entry (i, j) is at m_val[i * m_rowStride + j * m_colStride]. A stride of 0
+ *	repeats a vector along the rows or the columns
+ */
+typedef struct MatrixF32Operand {
+	const float *m_val;
+	size_t m_rowStride;
+	size_t m_colStride;
+} MatrixF32OperandType;
+
+// private function
+static inline MatrixF32OperandType m_matrixf32ElementwiseOperand(const MatrixF32Ptr t_mat) {
+	MatrixF32OperandType operand = {t_mat->m_val, m_matrixf32RowStride(t_mat), m_matrixf32ColStride(t_mat)};
+
+	return operand;
+}
+
+static inline bool m_matrixf32ElementwiseMapValid(MatrixMapType t_map) {
+	if (t_map.m_func == MatrixMapClamp) return t_map.m_lo <= t_map.m_hi;
+
+	return t_map.m_func >= MatrixMapIdentity && t_map.m_func <= MatrixMapClamp;
+}
+
+static inline float m_matrixf32ExpPow2(int t_k) {
+	const uint32_t bits = (uint32_t)(t_k + 127) << 23;
+	float pow2;
+
+	memcpy(&pow2, &bits, sizeof(float));
+
+	return pow2;
+}
+
+/**
+ *	Cephes expf polynomial, 2^k is applied in two halves so it neither overflows nor underflows before the product
+ */
+static inline float m_matrixf32ExpScalar(float t_x) {
+	if (isnan(t_x)) return t_x;
+
+	const float x = fminf(fmaxf(t_x, MATRIX_F32_EXP_MIN), MATRIX_F32_EXP_MAX);
+	const int k = (int)floorf(x * MATRIX_F32_EXP_LOG2E + 0.5f);
+	const float r = (x - (float)k * MATRIX_F32_EXP_LN2_HI) - (float)k * MATRIX_F32_EXP_LN2_LO;
+
+	float p = 1.9875691500e-4f;
+	p = p * r + 1.3981999507e-3f;
+	p = p * r + 8.3334519073e-3f;
+	p = p * r + 4.1665795894e-2f;
+	p = p * r + 1.6666665459e-1f;
+	p = p * r + 5.0000001201e-1f;
+
+	const float y = p * r * r + r + 1.0f;
+
+	return y * m_matrixf32ExpPow2(k / 2) * m_matrixf32ExpPow2(k - k / 2);
+}
+
+static void m_matrixf32MapAbs(size_t t_n, const float *t_x, float *t_y) {
+	size_t i = 0;
+
+#if defined(__SSE2__)
+	const __m128 sign = _mm_set1_ps(-0.0f);
+
+	for (; i + 4 <= t_n; i += 4) {
+		_mm_storeu_ps(t_y + i, _mm_andnot_ps(sign, _mm_loadu_ps(t_x + i)));
+	}
+#elif defined(MATRIX_F32_ELEMENTWISE_NEON)
+	for (; i + 4 <= t_n; i += 4) {
+		vst1q_f32(t_y + i, vabsq_f32(vld1q_f32(t_x + i)));
+	}
+#endif
+
+	for (; i < t_n; ++i) {
+		t_y[i] = fabsf(t_x[i]);
+	}
+}
+
+static void m_matrixf32MapSqrt(size_t t_n, const float *t_x, float *t_y) {
+	size_t i = 0;
+
+#if defined(__SSE2__)
+	for (; i + 4 <= t_n; i += 4) {
+		_mm_storeu_ps(t_y + i, _mm_sqrt_ps(_mm_loadu_ps(t_x + i)));
+	}
+#elif defined(MATRIX_F32_ELEMENTWISE_NEON)
+	for (; i + 4 <= t_n; i += 4) {
+		vst1q_f32(t_y + i, vsqrtq_f32(vld1q_f32(t_x + i)));
+	}
+#endif
+
+	for (; i < t_n; ++i) {
+		t_y[i] = sqrtf(t_x[i]);
+	}
+}
+
+static void m_matrixf32MapClamp(size_t t_n, float t_lo, float t_hi, const float *t_x, float *t_y) {
+	size_t i = 0;
+
+#if defined(__SSE2__)
+	const __m128 lo = _mm_set1_ps(t_lo), hi = _mm_set1_ps(t_hi);
+
+	// minps and maxps return their second operand if one is NaN, which keeps NaN entries
+	for (; i + 4 <= t_n; i += 4) {
+		_mm_storeu_ps(t_y + i, _mm_min_ps(hi, _mm_max_ps(lo, _mm_loadu_ps(t_x + i))));
+	}
+#elif defined(MATRIX_F32_ELEMENTWISE_NEON)
+	const float32x4_t lo = vdupq_n_f32(t_lo), hi = vdupq_n_f32(t_hi);
+
+	for (; i + 4 <= t_n; i += 4) {
+		vst1q_f32(t_y + i, vminq_f32(vmaxq_f32(vld1q_f32(t_x + i), lo), hi));
+	}
+#endif
+
+	for (; i < t_n; ++i) {
+		t_y[i] = t_x[i] < t_lo ? t_lo : (t_x[i] > t_hi ? t_hi : t_x[i]);
+	}
+}
+
+static void m_matrixf32MapExp(size_t t_n, const float *t_x, float *t_y) {
+	size_t i = 0;
+
+#if defined(__SSE2__)
+	const __m128 lo = _mm_set1_ps(MATRIX_F32_EXP_MIN), hi = _mm_set1_ps(MATRIX_F32_EXP_MAX);
+	const __m128i bias = _mm_set1_epi32(127);
+
+	for (; i + 4 <= t_n; i += 4) {
+		// NaN passes the clamp and propagates through r
+		const __m128 x = _mm_min_ps(hi, _mm_max_ps(lo, _mm_loadu_ps(t_x + i)));
+		const __m128i k = _mm_cvtps_epi32(_mm_mul_ps(x, _mm_set1_ps(MATRIX_F32_EXP_LOG2E)));
+		const __m128 kf = _mm_cvtepi32_ps(k);
+		const __m128 r = _mm_sub_ps(_mm_sub_ps(x, _mm_mul_ps(kf, _mm_set1_ps(MATRIX_F32_EXP_LN2_HI))),
+									_mm_mul_ps(kf, _mm_set1_ps(MATRIX_F32_EXP_LN2_LO)));
+
+		__m128 p = _mm_set1_ps(1.9875691500e-4f);
+		p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(1.3981999507e-3f));
+		p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(8.3334519073e-3f));
+		p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(4.1665795894e-2f));
+		p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(1.6666665459e-1f));
+		p = _mm_add_ps(_mm_mul_ps(p, r), _mm_set1_ps(5.0000001201e-1f));
+
+		const __m128 y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(_mm_mul_ps(p, r), r), r), _mm_set1_ps(1.0f));
+		const __m128i k_half = _mm_srai_epi32(k, 1);
+		const __m128 pow2_a = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(k_half, bias), 23));
+		const __m128 pow2_b = _mm_castsi128_ps(_mm_slli_epi32(_mm_add_epi32(_mm_sub_epi32(k, k_half), bias), 23));
+
+		_mm_storeu_ps(t_y + i, _mm_mul_ps(_mm_mul_ps(y, pow2_a), pow2_b));
+	}
+#elif defined(MATRIX_F32_ELEMENTWISE_NEON)
+	const float32x4_t lo = vdupq_n_f32(MATRIX_F32_EXP_MIN), hi = vdupq_n_f32(MATRIX_F32_EXP_MAX);
+	const int32x4_t bias = vdupq_n_s32(127);
+
+	for (; i + 4 <= t_n; i += 4) {
+		const float32x4_t x = vminq_f32(vmaxq_f32(vld1q_f32(t_x + i), lo), hi);
+		const int32x4_t k = vcvtnq_s32_f32(vmulq_n_f32(x, MATRIX_F32_EXP_LOG2E));
+		const float32x4_t kf = vcvtq_f32_s32(k);
+		const float32x4_t r = vmlsq_n_f32(vmlsq_n_f32(x, kf, MATRIX_F32_EXP_LN2_HI), kf, MATRIX_F32_EXP_LN2_LO);
+
+		float32x4_t p = vdupq_n_f32(1.9875691500e-4f);
+		p = vmlaq_f32(vdupq_n_f32(1.3981999507e-3f), p, r);
+		p = vmlaq_f32(vdupq_n_f32(8.3334519073e-3f), p, r);
+		p = vmlaq_f32(vdupq_n_f32(4.1665795894e-2f), p, r);
+		p = vmlaq_f32(vdupq_n_f32(1.6666665459e-1f), p, r);
+		p = vmlaq_f32(vdupq_n_f32(5.0000001201e-1f), p, r);
+
+		const float32x4_t y = vmlaq_f32(vaddq_f32(r, vdupq_n_f32(1.0f)), vmulq_f32(p, r), r);
+		const int32x4_t k_half = vshrq_n_s32(k, 1);
+		const float32x4_t pow2_a = vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(k_half, bias), 23));
+		const float32x4_t pow2_b = vreinterpretq_f32_s32(vshlq_n_s32(vaddq_s32(vsubq_s32(k, k_half), bias), 23));
+
+		vst1q_f32(t_y + i, vmulq_f32(vmulq_f32(y, pow2_a), pow2_b));
+	}
+#endif
+
+	for (; i < t_n; ++i) {
+		t_y[i] = m_matrixf32ExpScalar(t_x[i]);
+	}
+}
+
+/**
+ *	Applies t_map to t_n entries of t_x into t_y, which may be t_x
+ */
+static void m_matrixf32MapKernel(size_t t_n, MatrixMapType t_map, const float *t_x, float *t_y) {
+	switch (t_map.m_func) {
+		case MatrixMapIdentity:
+			if (t_y != t_x) memmove(t_y, t_x, t_n * sizeof(float));
+			break;
+		case MatrixMapAbs:
+			m_matrixf32MapAbs(t_n, t_x, t_y);
+			break;
+		case MatrixMapSqrt:
+			m_matrixf32MapSqrt(t_n, t_x, t_y);
+			break;
+		case MatrixMapExp:
+			m_matrixf32MapExp(t_n, t_x, t_y);
+			break;
+		case MatrixMapClamp:
+			m_matrixf32MapClamp(t_n, t_map.m_lo, t_map.m_hi, t_x, t_y);
+			break;
+	}
+}
+
+#if defined(__SSE2__)
+static inline __m128 m_matrixf32ZipVector(MatrixZipOp t_op, __m128 t_b, __m128 t_c) {
+	switch (t_op) {
+		case MatrixZipAdd:
+			return _mm_add_ps(t_b, t_c);
+		case MatrixZipSubtract:
+			return _mm_sub_ps(t_b, t_c);
+		case MatrixZipMultiply:
+			return _mm_mul_ps(t_b, t_c);
+		case MatrixZipDivide:
+			return _mm_div_ps(t_b, t_c);
+	}
+
+	return t_b;
+}
+#elif defined(MATRIX_F32_ELEMENTWISE_NEON)
+static inline float32x4_t m_matrixf32ZipVector(MatrixZipOp t_op, float32x4_t t_b, float32x4_t t_c) {
+	switch (t_op) {
+		case MatrixZipAdd:
+			return vaddq_f32(t_b, t_c);
+		case MatrixZipSubtract:
+			return vsubq_f32(t_b, t_c);
+		case MatrixZipMultiply:
+			return vmulq_f32(t_b, t_c);
+		case MatrixZipDivide:
+			return vdivq_f32(t_b, t_c);
+	}
+
+	return t_b;
+}
+#endif
+
+static inline float m_matrixf32ZipScalar(MatrixZipOp t_op, float t_b, float t_c) {
+	switch (t_op) {
+		case MatrixZipAdd:
+			return t_b + t_c;
+		case MatrixZipSubtract:
+			return t_b - t_c;
+		case MatrixZipMultiply:
+			return t_b * t_c;
+		case MatrixZipDivide:
+			return t_b / t_c;
+	}
+
+	return t_b;
+}
+
+/**
+ *	t_y[i] = t_b[i] op t_c[i] for t_n entries, or t_b[i] op t_c[0] if t_c_repeat. t_y may be t_b or t_c
+ */
+static void m_matrixf32ZipKernel(size_t t_n, MatrixZipOp t_op, const float *t_b, const float *t_c, bool t_c_repeat,
+								 float *t_y) {
+	size_t i = 0;
+
+#if defined(__SSE2__)
+	const __m128 repeated = _mm_set1_ps(t_c[0]);
+
+	for (; i + 4 <= t_n; i += 4) {
+		const __m128 c = t_c_repeat ? repeated : _mm_loadu_ps(t_c + i);
+
+		_mm_storeu_ps(t_y + i, m_matrixf32ZipVector(t_op, _mm_loadu_ps(t_b + i), c));
+	}
+#elif defined(MATRIX_F32_ELEMENTWISE_NEON)
+	const float32x4_t repeated = vdupq_n_f32(t_c[0]);
+
+	for (; i + 4 <= t_n; i += 4) {
+		const float32x4_t c = t_c_repeat ? repeated : vld1q_f32(t_c + i);
+
+		vst1q_f32(t_y + i, m_matrixf32ZipVector(t_op, vld1q_f32(t_b + i), c));
+	}
+#endif
+
+	for (; i < t_n; ++i) {
+		t_y[i] = m_matrixf32ZipScalar(t_op, t_b[i], t_c[t_c_repeat ? 0 : i]);
+	}
+}
+
+/**
+ *	Returns t_n entries t_stride apart from t_src contiguously, t_src itself if they already are
+ */
+static const float *m_matrixf32ElementwiseGather(const float *t_src, size_t t_stride, size_t t_n, float *t_block) {
+	if (t_stride == 1) return t_src;
+
+	for (size_t i = 0; i < t_n; ++i) {
+		t_block[i] = t_src[i * t_stride];
+	}
+
+	return t_block;
+}
+
+/**
+ *	t_result = map(b op c), or map(b) if t_c.m_val is NULL, walking the buffer of t_result block by block so every
+ *	entry is read and written once
+ */
+static void m_matrixf32ElementwiseRun(const MatrixF32Ptr t_result, MatrixF32OperandType t_b, MatrixZipOp t_op,
+									  MatrixF32OperandType t_c, MatrixMapType t_map) {
+	const bool row_major = t_result->m_layout == MatrixLayoutRowMajor;
+	size_t lines = row_major ? t_result->m_row : t_result->m_col;
+	size_t len = row_major ? t_result->m_col : t_result->m_row;
+
+	// strides of the operands along a line of the result buffer and from one line to the next
+	const size_t b_along = row_major ? t_b.m_colStride : t_b.m_rowStride;
+	const size_t b_across = row_major ? t_b.m_rowStride : t_b.m_colStride;
+	const size_t c_along = row_major ? t_c.m_colStride : t_c.m_rowStride;
+	const size_t c_across = row_major ? t_c.m_rowStride : t_c.m_colStride;
+
+	// operands stored like the result make the buffer one line
+	if (b_along == 1 && b_across == len && (t_c.m_val == 0 || (c_along == 1 && c_across == len))) {
+		len *= lines;
+		lines = 1;
+	}
+
+	float b_block[MATRIX_F32_ELEMENTWISE_BLOCK], c_block[MATRIX_F32_ELEMENTWISE_BLOCK];
+
+	for (size_t line = 0; line < lines; ++line) {
+		for (size_t offset = 0; offset < len; offset += MATRIX_F32_ELEMENTWISE_BLOCK) {
+			const size_t n = len - offset < MATRIX_F32_ELEMENTWISE_BLOCK ? len - offset : MATRIX_F32_ELEMENTWISE_BLOCK;
+			float *y = t_result->m_val + line * len + offset;
+			const float *b = m_matrixf32ElementwiseGather(t_b.m_val + line * b_across + offset * b_along, b_along, n,
+														  b_block);
+
+			if (t_c.m_val == 0) {
+				m_matrixf32MapKernel(n, t_map, b, y);
+				continue;
+			}
+
+			const float *c = t_c.m_val + line * c_across + offset * c_along;
+
+			if (c_along != 0) c = m_matrixf32ElementwiseGather(c, c_along, n, c_block);
+
+			m_matrixf32ZipKernel(n, t_op, b, c, c_along == 0, y);
+
+			if (t_map.m_func != MatrixMapIdentity) m_matrixf32MapKernel(n, t_map, y, y);
+		}
+	}
+}
+
+static MatrixStatus m_matrixf32ElementwiseZip(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b,
+											  MatrixZipOp t_op, const MatrixF32Ptr t_mat_c, MatrixMapType t_map) {
+	if (t_result == 0 || t_mat_b == 0 || t_mat_c == 0) return MatrixStatusErrNullPtr;
+	if (t_result->m_val == 0 || t_mat_b->m_val == 0 || t_mat_c->m_val == 0) return MatrixStatusErrNullPtr;
+	if (t_op < MatrixZipAdd || t_op > MatrixZipDivide || !m_matrixf32ElementwiseMapValid(t_map)) {
+		return MatrixStatusErrUnknownOpt;
+	}
+
+	bool dim_not_matched = t_mat_b->m_row != t_result->m_row || t_mat_b->m_col != t_result->m_col ||
+						   t_mat_c->m_row != t_result->m_row || t_mat_c->m_col != t_result->m_col;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+
+	m_matrixf32Touch(t_result);
+
+	m_matrixf32ElementwiseRun(t_result, m_matrixf32ElementwiseOperand(t_mat_b), t_op,
+							  m_matrixf32ElementwiseOperand(t_mat_c), t_map);
+
+	return MatrixStatusOK;
+}
+
+static MatrixStatus m_matrixf32ElementwiseBroadcast(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b,
+													MatrixZipOp t_op, const MatrixF32Ptr t_vector, bool t_along_rows) {
+	if (t_result == 0 || t_mat_b == 0 || t_vector == 0) return MatrixStatusErrNullPtr;
+	if (t_result->m_val == 0 || t_mat_b->m_val == 0 || t_vector->m_val == 0) return MatrixStatusErrNullPtr;
+	if (t_op < MatrixZipAdd || t_op > MatrixZipDivide) return MatrixStatusErrUnknownOpt;
+
+	const size_t len = t_along_rows ? t_result->m_col : t_result->m_row;
+	bool dim_not_matched = t_mat_b->m_row != t_result->m_row || t_mat_b->m_col != t_result->m_col ||
+						   !m_matrixf32IsVector(t_vector) || t_vector->m_row * t_vector->m_col != len;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+
+	m_matrixf32Touch(t_result);
+
+	// a row vector advances with the column index only, a column vector with the row index
+	MatrixF32OperandType vector = {t_vector->m_val, t_along_rows ? 0 : 1, t_along_rows ? 1 : 0};
+	MatrixMapType identity = {MatrixMapIdentity, 0.0f, 0.0f};
+
+	m_matrixf32ElementwiseRun(t_result, m_matrixf32ElementwiseOperand(t_mat_b), t_op, vector, identity);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32HadamardProduct(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b,
+									  const MatrixF32Ptr t_mat_c) {
+	MatrixMapType identity = {MatrixMapIdentity, 0.0f, 0.0f};
+
+	return m_matrixf32ElementwiseZip(t_result, t_mat_b, MatrixZipMultiply, t_mat_c, identity);
+}
+
+MatrixStatus matrixf32HadamardDivide(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b,
+									 const MatrixF32Ptr t_mat_c) {
+	MatrixMapType identity = {MatrixMapIdentity, 0.0f, 0.0f};
+
+	return m_matrixf32ElementwiseZip(t_result, t_mat_b, MatrixZipDivide, t_mat_c, identity);
+}
+
+MatrixStatus matrixf32BroadcastRow(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b, MatrixZipOp t_op,
+								   const MatrixF32Ptr t_row) {
+	return m_matrixf32ElementwiseBroadcast(t_result, t_mat_b, t_op, t_row, true);
+}
+
+MatrixStatus matrixf32BroadcastCol(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b, MatrixZipOp t_op,
+								   const MatrixF32Ptr t_col) {
+	return m_matrixf32ElementwiseBroadcast(t_result, t_mat_b, t_op, t_col, false);
+}
+
+MatrixStatus matrixf32Map(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b, MatrixMapType t_map) {
+	if (t_result == 0 || t_mat_b == 0 || t_result->m_val == 0 || t_mat_b->m_val == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixf32ElementwiseMapValid(t_map)) return MatrixStatusErrUnknownOpt;
+	if (t_mat_b->m_row != t_result->m_row || t_mat_b->m_col != t_result->m_col) return MatrixStatusErrDimMismatch;
+
+	m_matrixf32Touch(t_result);
+
+	MatrixF32OperandType none = {0, 0, 0};
+
+	m_matrixf32ElementwiseRun(t_result, m_matrixf32ElementwiseOperand(t_mat_b), MatrixZipAdd, none, t_map);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32Zip(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b, MatrixZipOp t_op,
+						  const MatrixF32Ptr t_mat_c, MatrixMapType t_map) {
+	return m_matrixf32ElementwiseZip(t_result, t_mat_b, t_op, t_mat_c, t_map);
+}
@@ -0,0 +1,227 @@
+/**
+ * @Date:   2026-10-19T15:10:12+08:00
+ * @Last modified time: 2026-10-19T15:10:12+08:00
+ */
+
+#include "include/matrix_f32_file.h"
+#include "src/matrix_f32_private.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define MATRIX_F32_FILE_HAVE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+const char m_matrixf32FileMagic[4] = {'M', 'F', '3', '2'};
+
+_Static_assert(sizeof(MatrixF32FileHeaderType) == MATRIX_F32_FILE_ALIGNMENT, "header must fill one alignment unit");
+
+// private function
+bool m_matrixf32FileHostIsLittleEndian(void) {
+	const uint16_t probe = 1;
+	uint8_t first_byte;
+	memcpy(&first_byte, &probe, 1);
+
+	return first_byte == 1;
+}
+
+// Fletcher-64 over 32 bit words, reduction is deferred so that the sums can not overflow in between
+uint64_t m_matrixf32FileChecksum(uint64_t t_seed, const float *t_val, size_t t_count) {
+	static const size_t block = 1u << 15;
+	static const uint64_t modulo = 0xFFFFFFFFu;
+
+	uint64_t sum1 = t_seed & 0xFFFFFFFFu, sum2 = t_seed >> 32;
+
+	for (size_t begin = 0; begin < t_count; begin += block) {
+		const size_t end = (t_count - begin) > block ? begin + block : t_count;
+
+		for (size_t i = begin; i < end; ++i) {
+			uint32_t word;
+			memcpy(&word, t_val + i, sizeof(word));
+
+			sum1 += word;
+			sum2 += sum1;
+		}
+
+		sum1 %= modulo;
+		sum2 %= modulo;
+	}
+
+	return (sum2 << 32) | sum1;
+}
+
+bool m_matrixf32FileHeaderValid(const MatrixF32FileHeaderType *t_header, uint64_t t_file_size) {
+	const MatrixF32FileHeaderType *h = t_header;
+
+	if (memcmp(h->m_magic, m_matrixf32FileMagic, sizeof(m_matrixf32FileMagic)) != 0) return false;
+	if (h->m_version != MATRIX_F32_FILE_VERSION || h->m_headerSize != sizeof(MatrixF32FileHeaderType)) return false;
+	if (h->m_alignment == 0 || (h->m_alignment & (h->m_alignment - 1)) != 0) return false;
+	if (h->m_payloadOffset < h->m_headerSize || h->m_payloadOffset % h->m_alignment != 0) return false;
+	if (h->m_row == 0 || h->m_col == 0 || h->m_stride != h->m_col) return false;
+
+	// payload size, guarding against overflow of row * stride * sizeof(float)
+	if (h->m_row > (SIZE_MAX / sizeof(float)) / h->m_stride) return false;
+	const uint64_t payload_size = h->m_row * h->m_stride * sizeof(float);
+
+	return t_file_size >= h->m_payloadOffset && t_file_size - h->m_payloadOffset >= payload_size;
+}
+
+MatrixStatus matrixf32FileWrite(const char *t_path, const MatrixF32Ptr t_source) {
+	if (t_path == 0 || t_source == 0 || t_source->m_val == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixf32RowMajorBuffer(t_source)) return MatrixStatusErrLayout;
+	if (!m_matrixf32FileHostIsLittleEndian()) return MatrixStatusErrIO;
+
+	const size_t count = t_source->m_row * t_source->m_col;
+
+	MatrixF32FileHeaderType header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.m_magic, m_matrixf32FileMagic, sizeof(m_matrixf32FileMagic));
+	header.m_version = MATRIX_F32_FILE_VERSION;
+	header.m_headerSize = sizeof(header);
+	header.m_alignment = MATRIX_F32_FILE_ALIGNMENT;
+	header.m_row = t_source->m_row;
+	header.m_col = t_source->m_col;
+	header.m_stride = t_source->m_col;
+	header.m_payloadOffset = sizeof(header);
+	header.m_checksum = m_matrixf32FileChecksum(0, t_source->m_val, count);
+
+	FILE *file = fopen(t_path, "wb");
+	if (file == 0) return MatrixStatusErrIO;
+
+	bool written = fwrite(&header, sizeof(header), 1, file) == 1 &&
+				   fwrite(t_source->m_val, sizeof(float), count, file) == count;
+
+	if (fclose(file) != 0 || !written) return MatrixStatusErrIO;
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32FileRead(const char *t_path, const MatrixF32Ptr t_dest) {
+	if (t_path == 0 || t_dest == 0 || t_dest->m_val == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixf32RowMajorBuffer(t_dest)) return MatrixStatusErrLayout;
+	if (!m_matrixf32FileHostIsLittleEndian()) return MatrixStatusErrIO;
+
+	FILE *file = fopen(t_path, "rb");
+	if (file == 0) return MatrixStatusErrIO;
+
+	MatrixStatus ret_val = MatrixStatusErrIO;
+	MatrixF32FileHeaderType header;
+
+	if (fread(&header, sizeof(header), 1, file) == 1 && fseek(file, 0, SEEK_END) == 0) {
+		long file_size = ftell(file);
+
+		if (file_size < 0 || !m_matrixf32FileHeaderValid(&header, (uint64_t)file_size)) {
+			ret_val = MatrixStatusErrIO;
+		} else if (header.m_row != t_dest->m_row || header.m_col != t_dest->m_col) {
+			ret_val = MatrixStatusErrDimMismatch;
+		} else if (fseek(file, (long)header.m_payloadOffset, SEEK_SET) == 0) {
+			const size_t count = t_dest->m_row * t_dest->m_col;
+
+			m_matrixf32Touch(t_dest);
+
+			if (fread(t_dest->m_val, sizeof(float), count, file) == count &&
+				m_matrixf32FileChecksum(0, t_dest->m_val, count) == header.m_checksum) {
+				ret_val = MatrixStatusOK;
+			}
+		}
+	}
+
+	fclose(file);
+
+	return ret_val;
+}
+
+#ifdef MATRIX_F32_FILE_HAVE_MMAP
+
+MatrixStatus matrixf32FileMap(const char *t_path, bool t_verify, MatrixF32FileMapType *t_map) {
+	if (t_path == 0 || t_map == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixf32FileHostIsLittleEndian()) return MatrixStatusErrIO;
+
+	memset(t_map, 0, sizeof(*t_map));
+
+	int fd = open(t_path, O_RDONLY);
+	if (fd < 0) return MatrixStatusErrIO;
+
+	struct stat file_stat;
+	if (fstat(fd, &file_stat) != 0 || (uint64_t)file_stat.st_size < sizeof(MatrixF32FileHeaderType) ||
+		(uint64_t)file_stat.st_size > SIZE_MAX) {
+		close(fd);
+
+		return MatrixStatusErrIO;
+	}
+
+	// private writable mapping, the matrix can be modified without touching the file
+	const size_t length = (size_t)file_stat.st_size;
+	void *addr = mmap(0, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+	close(fd);
+
+	if (addr == MAP_FAILED) return MatrixStatusErrIO;
+
+	const MatrixF32FileHeaderType *header = (const MatrixF32FileHeaderType *)addr;
+
+	if (!m_matrixf32FileHeaderValid(header, length)) {
+		munmap(addr, length);
+
+		return MatrixStatusErrIO;
+	}
+
+	float *payload = (float *)((char *)addr + header->m_payloadOffset);
+
+	if (t_verify && m_matrixf32FileChecksum(0, payload, header->m_row * header->m_stride) != header->m_checksum) {
+		munmap(addr, length);
+
+		return MatrixStatusErrIO;
+	}
+
+	MatrixF32Ptr matrix = m_matrixf32CreateContainerFor((MatrixDimType){header->m_row, header->m_col}, payload,
+														MatrixF32OpCreateContainer);
+	if (matrix == 0) {
+		munmap(addr, length);
+
+		return MatrixStatusErrNullPtr;
+	}
+
+	t_map->m_matrix = matrix;
+	t_map->m_addr = addr;
+	t_map->m_length = length;
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32FileUnmap(MatrixF32FileMapType *t_map) {
+	if (t_map == 0) return MatrixStatusErrNullPtr;
+
+	matrixf32Destroy(&t_map->m_matrix);
+
+	if (t_map->m_addr != 0 && munmap(t_map->m_addr, t_map->m_length) != 0) return MatrixStatusErrIO;
+
+	t_map->m_addr = 0;
+	t_map->m_length = 0;
+
+	return MatrixStatusOK;
+}
+
+#else
+
+MatrixStatus matrixf32FileMap(const char *t_path, bool t_verify, MatrixF32FileMapType *t_map) {
+	(void)t_verify;
+
+	if (t_path == 0 || t_map == 0) return MatrixStatusErrNullPtr;
+
+	memset(t_map, 0, sizeof(*t_map));
+
+	return MatrixStatusErrIO;
+}
+
+MatrixStatus matrixf32FileUnmap(MatrixF32FileMapType *t_map) {
+	if (t_map == 0) return MatrixStatusErrNullPtr;
+
+	return matrixf32Destroy(&t_map->m_matrix);
+}
+
+#endif
@@ -0,0 +1,510 @@
+/**
+ * @Date:   2026-10-19T21:58:14+08:00
+ * @Last modified time: 2026-10-19T21:58:14+08:00
+ */
+
+#include "include/matrix_f32_fixed.h"
+#include "src/matrix_f32_private.h"
+
+#include <string.h>
+
+// bound of the 64 bit working values of the solver, leaves room for one subtraction without overflow
+#define MATRIX_Q_WORK_LIMIT ((int64_t)1 << 61)
+#define MATRIX_Q31_ONE ((int64_t)1 << 31)
+
+struct MatrixQ15 {
+	size_t m_row;
+	size_t m_col;
+
+	int16_t *m_val;
+};
+
+struct MatrixQ31 {
+	size_t m_row;
+	size_t m_col;
+
+	int32_t *m_val;
+};
+
+// private function
+static inline int16_t m_matrixq15Saturate(int64_t t_val) {
+	return t_val > INT16_MAX ? INT16_MAX : (t_val < INT16_MIN ? INT16_MIN : (int16_t)t_val);
+}
+
+static inline int32_t m_matrixq31Saturate(int64_t t_val) {
+	return t_val > INT32_MAX ? INT32_MAX : (t_val < INT32_MIN ? INT32_MIN : (int32_t)t_val);
+}
+
+static inline int64_t m_matrixqWorkSaturate(int64_t t_val) {
+	return t_val > MATRIX_Q_WORK_LIMIT ? MATRIX_Q_WORK_LIMIT
+									   : (t_val < -MATRIX_Q_WORK_LIMIT ? -MATRIX_Q_WORK_LIMIT : t_val);
+}
+
+static bool m_matrixqDimMatch(size_t t_row_a, size_t t_col_a, size_t t_row_b, size_t t_col_b) {
+	return t_row_a == t_row_b && t_col_a == t_col_b;
+}
+
+static int64_t m_matrixqRoundFromF32(float t_val, double t_one, int64_t t_min, int64_t t_max) {
+	double scaled = (double)t_val * t_one;
+
+	if (!(scaled == scaled)) return 0;	// NaN
+	if (scaled >= (double)t_max) return t_max;
+	if (scaled <= (double)t_min) return t_min;
+
+	return (int64_t)(scaled + (scaled >= 0.0 ? 0.5 : -0.5));
+}
+
+/**
+ *	t_val * t_mul in Q31 for a working value t_val and |t_mul| <= 2^31. t_val is split into its integer and fraction
+ *	part so that neither partial product overflows 64 bits.
+ */
+static int64_t m_matrixqWorkMul(int64_t t_val, int64_t t_mul) {
+	const int64_t high = t_val >> 31;  // floor
+	const int64_t low = t_val - high * MATRIX_Q31_ONE;
+
+	return high * t_mul + ((low * t_mul) >> 31);
+}
+
+/**
+ *	t_num / t_den in Q31 for working values, rounded toward zero and saturated to the working range. t_den is not 0.
+ */
+static int64_t m_matrixqWorkDiv(int64_t t_num, int64_t t_den) {
+	const bool negative = (t_num < 0) != (t_den < 0);
+	uint64_t num = t_num < 0 ? (uint64_t)0 - (uint64_t)t_num : (uint64_t)t_num;
+	uint64_t den = t_den < 0 ? (uint64_t)0 - (uint64_t)t_den : (uint64_t)t_den;
+
+	// the remainder is shifted by 31 below and must not overflow
+	while (den >= (uint64_t)MATRIX_Q31_ONE) {
+		num >>= 1;
+		den >>= 1;
+	}
+
+	const uint64_t quotient = num / den;
+	if (quotient >= (uint64_t)1 << 30) return negative ? -MATRIX_Q_WORK_LIMIT : MATRIX_Q_WORK_LIMIT;
+
+	const uint64_t remainder = num % den;
+	const int64_t result = (int64_t)((quotient << 31) + (remainder << 31) / den);
+
+	return m_matrixqWorkSaturate(negative ? -result : result);
+}
+
+/**
+ *	Solves t_a * X = t_b in place by Gaussian elimination with partial pivoting, which is the LU factorization with
+ *	the forward substitution applied to t_b on the fly. t_a is n x n and t_b n x k, both working values in Q31. On
+ *	return t_b holds X clamped to the Q31 range.
+ */
+static MatrixStatus m_matrixqSolveKernel(int64_t *t_a, int64_t *t_b, size_t t_n, size_t t_k) {
+	for (size_t p = 0; p < t_n; ++p) {
+		size_t pivot = p;
+		int64_t pivot_abs = 0;
+
+		for (size_t i = p; i < t_n; ++i) {
+			const int64_t candidate = t_a[i * t_n + p] < 0 ? -t_a[i * t_n + p] : t_a[i * t_n + p];
+
+			if (candidate > pivot_abs) {
+				pivot = i;
+				pivot_abs = candidate;
+			}
+		}
+
+		if (pivot_abs == 0) return MatrixStatusErrSingular;
+
+		if (pivot != p) {
+			for (size_t j = 0; j < t_n; ++j) {
+				int64_t swap = t_a[p * t_n + j];
+				t_a[p * t_n + j] = t_a[pivot * t_n + j];
+				t_a[pivot * t_n + j] = swap;
+			}
+
+			for (size_t j = 0; j < t_k; ++j) {
+				int64_t swap = t_b[p * t_k + j];
+				t_b[p * t_k + j] = t_b[pivot * t_k + j];
+				t_b[pivot * t_k + j] = swap;
+			}
+		}
+
+		const int64_t *a_pivot = t_a + p * t_n;
+		const int64_t *b_pivot = t_b + p * t_k;
+
+		for (size_t i = p + 1; i < t_n; ++i) {
+			int64_t *a_row = t_a + i * t_n;
+			int64_t *b_row = t_b + i * t_k;
+
+			// |l| <= 1 thanks to the pivoting
+			const int64_t l = m_matrixqWorkDiv(a_row[p], a_pivot[p]);
+			if (l == 0) continue;
+
+			for (size_t j = p + 1; j < t_n; ++j) {
+				a_row[j] = m_matrixqWorkSaturate(a_row[j] - m_matrixqWorkMul(a_pivot[j], l));
+			}
+
+			for (size_t j = 0; j < t_k; ++j) {
+				b_row[j] = m_matrixqWorkSaturate(b_row[j] - m_matrixqWorkMul(b_pivot[j], l));
+			}
+		}
+	}
+
+	for (size_t i = t_n; i-- > 0;) {
+		const int64_t *a_row = t_a + i * t_n;
+		int64_t *b_row = t_b + i * t_k;
+
+		for (size_t j = 0; j < t_k; ++j) {
+			int64_t sum = b_row[j];
+
+			for (size_t c = i + 1; c < t_n; ++c) {
+				sum = m_matrixqWorkSaturate(sum - m_matrixqWorkMul(a_row[c], t_b[c * t_k + j]));
+			}
+
+			b_row[j] = m_matrixq31Saturate(m_matrixqWorkDiv(sum, a_row[i]));
+		}
+	}
+
+	return MatrixStatusOK;
+}
+
+/**
+ *	Allocates the working copies of the solver for an n x n system with k right hand sides, NULL if it fails
+ */
+static int64_t *m_matrixqSolveWorkspace(size_t t_n, size_t t_k) {
+	if (t_n > SIZE_MAX / sizeof(int64_t) / (t_n + t_k)) return 0;
+
+	return MATRIX_F32_MALLOC((t_n + t_k) * t_n * sizeof(int64_t));
+}
+
+MatrixQ15Ptr matrixq15Create(MatrixDimType t_dim) {
+	if (t_dim.m_row == 0 || t_dim.m_col == 0 || t_dim.m_row > SIZE_MAX / sizeof(int16_t) / t_dim.m_col) return 0;
+
+	MatrixQ15Ptr mat = MATRIX_F32_MALLOC(sizeof(struct MatrixQ15));
+	if (mat == 0) return 0;
+
+	mat->m_row = t_dim.m_row;
+	mat->m_col = t_dim.m_col;
+	mat->m_val = MATRIX_F32_MALLOC(t_dim.m_row * t_dim.m_col * sizeof(int16_t));
+
+	if (mat->m_val == 0) {
+		MATRIX_F32_FREE(mat);
+
+		return 0;
+	}
+
+	memset(mat->m_val, 0, t_dim.m_row * t_dim.m_col * sizeof(int16_t));
+
+	return mat;
+}
+
+MatrixStatus matrixq15Destroy(MatrixQ15Ptr *t_dest) {
+	if (t_dest == 0) return MatrixStatusErrNullPtr;
+
+	if (*t_dest != 0) MATRIX_F32_FREE((*t_dest)->m_val);
+
+	MATRIX_F32_FREE(*t_dest);
+	*t_dest = 0;
+
+	return MatrixStatusOK;
+}
+
+int16_t *matrixq15GetBuffer(MatrixQ15Ptr t_dest) { return t_dest == 0 ? 0 : t_dest->m_val; }
+
+MatrixStatus matrixq15FromF32(const MatrixQ15Ptr t_result, const MatrixF32Ptr t_source) {
+	if (t_result == 0 || t_source == 0 || t_source->m_val == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixqDimMatch(t_result->m_row, t_result->m_col, t_source->m_row, t_source->m_col)) {
+		return MatrixStatusErrDimMismatch;
+	}
+	if (!m_matrixf32RowMajorBuffer(t_source)) return MatrixStatusErrLayout;
+
+	for (size_t i = 0; i < t_result->m_row * t_result->m_col; ++i) {
+		t_result->m_val[i] = (int16_t)m_matrixqRoundFromF32(t_source->m_val[i], 32768.0, INT16_MIN, INT16_MAX);
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixq15ToF32(const MatrixF32Ptr t_result, const MatrixQ15Ptr t_source) {
+	if (t_result == 0 || t_source == 0 || t_result->m_val == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixqDimMatch(t_result->m_row, t_result->m_col, t_source->m_row, t_source->m_col)) {
+		return MatrixStatusErrDimMismatch;
+	}
+	if (!m_matrixf32RowMajorBuffer(t_result)) return MatrixStatusErrLayout;
+
+	m_matrixf32Touch(t_result);
+
+	for (size_t i = 0; i < t_source->m_row * t_source->m_col; ++i) {
+		t_result->m_val[i] = (float)t_source->m_val[i] * (1.0f / 32768.0f);
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixq15Add(const MatrixQ15Ptr t_result, const MatrixQ15Ptr t_mat_b, const MatrixQ15Ptr t_mat_c) {
+	if (t_result == 0 || t_mat_b == 0 || t_mat_c == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixqDimMatch(t_result->m_row, t_result->m_col, t_mat_b->m_row, t_mat_b->m_col) ||
+		!m_matrixqDimMatch(t_result->m_row, t_result->m_col, t_mat_c->m_row, t_mat_c->m_col)) {
+		return MatrixStatusErrDimMismatch;
+	}
+
+	for (size_t i = 0; i < t_result->m_row * t_result->m_col; ++i) {
+		t_result->m_val[i] = m_matrixq15Saturate((int32_t)t_mat_b->m_val[i] + t_mat_c->m_val[i]);
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixq15Subtract(const MatrixQ15Ptr t_result, const MatrixQ15Ptr t_mat_b, const MatrixQ15Ptr t_mat_c) {
+	if (t_result == 0 || t_mat_b == 0 || t_mat_c == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixqDimMatch(t_result->m_row, t_result->m_col, t_mat_b->m_row, t_mat_b->m_col) ||
+		!m_matrixqDimMatch(t_result->m_row, t_result->m_col, t_mat_c->m_row, t_mat_c->m_col)) {
+		return MatrixStatusErrDimMismatch;
+	}
+
+	for (size_t i = 0; i < t_result->m_row * t_result->m_col; ++i) {
+		t_result->m_val[i] = m_matrixq15Saturate((int32_t)t_mat_b->m_val[i] - t_mat_c->m_val[i]);
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixq15Scale(const MatrixQ15Ptr t_result, int16_t t_val, const MatrixQ15Ptr t_mat_b) {
+	if (t_result == 0 || t_mat_b == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixqDimMatch(t_result->m_row, t_result->m_col, t_mat_b->m_row, t_mat_b->m_col)) {
+		return MatrixStatusErrDimMismatch;
+	}
+
+	for (size_t i = 0; i < t_result->m_row * t_result->m_col; ++i) {
+		t_result->m_val[i] = m_matrixq15Saturate(((int32_t)t_mat_b->m_val[i] * t_val + (1 << 14)) >> 15);
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixq15Multiplication(const MatrixQ15Ptr t_result, const MatrixQ15Ptr t_mat_b,
+									 const MatrixQ15Ptr t_mat_c) {
+	if (t_result == 0 || t_mat_b == 0 || t_mat_c == 0) return MatrixStatusErrNullPtr;
+	if (t_mat_b->m_col != t_mat_c->m_row || t_result->m_row != t_mat_b->m_row || t_result->m_col != t_mat_c->m_col) {
+		return MatrixStatusErrDimMismatch;
+	}
+
+	const size_t inner = t_mat_b->m_col;
+	const size_t col = t_mat_c->m_col;
+
+	for (size_t i = 0; i < t_result->m_row; ++i) {
+		const int16_t *b_row = t_mat_b->m_val + i * inner;
+
+		for (size_t j = 0; j < col; ++j) {
+			int64_t sum = 0;
+
+			for (size_t k = 0; k < inner; ++k) {
+				sum += (int32_t)b_row[k] * t_mat_c->m_val[k * col + j];
+			}
+
+			t_result->m_val[i * col + j] = m_matrixq15Saturate((sum + (1 << 14)) >> 15);
+		}
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixq15Solve(const MatrixQ15Ptr t_result, const MatrixQ15Ptr t_mat_a, const MatrixQ15Ptr t_column) {
+	if (t_result == 0 || t_mat_a == 0 || t_column == 0) return MatrixStatusErrNullPtr;
+
+	const size_t n = t_mat_a->m_row;
+	const size_t k = t_column->m_col;
+	if (t_mat_a->m_col != n || t_column->m_row != n || !m_matrixqDimMatch(t_result->m_row, t_result->m_col, n, k)) {
+		return MatrixStatusErrDimMismatch;
+	}
+
+	int64_t *a = m_matrixqSolveWorkspace(n, k);
+	if (a == 0) return MatrixStatusErrNullPtr;
+
+	int64_t *b = a + n * n;
+
+	// Q15 to Q31
+	for (size_t i = 0; i < n * n; ++i) {
+		a[i] = (int64_t)t_mat_a->m_val[i] * 65536;
+	}
+
+	for (size_t i = 0; i < n * k; ++i) {
+		b[i] = (int64_t)t_column->m_val[i] * 65536;
+	}
+
+	MatrixStatus status = m_matrixqSolveKernel(a, b, n, k);
+
+	if (status == MatrixStatusOK) {
+		for (size_t i = 0; i < n * k; ++i) {
+			t_result->m_val[i] = m_matrixq15Saturate((b[i] + (1 << 15)) >> 16);
+		}
+	}
+
+	MATRIX_F32_FREE(a);
+
+	return status;
+}
+
+MatrixQ31Ptr matrixq31Create(MatrixDimType t_dim) {
+	if (t_dim.m_row == 0 || t_dim.m_col == 0 || t_dim.m_row > SIZE_MAX / sizeof(int32_t) / t_dim.m_col) return 0;
+
+	MatrixQ31Ptr mat = MATRIX_F32_MALLOC(sizeof(struct MatrixQ31));
+	if (mat == 0) return 0;
+
+	mat->m_row = t_dim.m_row;
+	mat->m_col = t_dim.m_col;
+	mat->m_val = MATRIX_F32_MALLOC(t_dim.m_row * t_dim.m_col * sizeof(int32_t));
+
+	if (mat->m_val == 0) {
+		MATRIX_F32_FREE(mat);
+
+		return 0;
+	}
+
+	memset(mat->m_val, 0, t_dim.m_row * t_dim.m_col * sizeof(int32_t));
+
+	return mat;
+}
+
+MatrixStatus matrixq31Destroy(MatrixQ31Ptr *t_dest) {
+	if (t_dest == 0) return MatrixStatusErrNullPtr;
+
+	if (*t_dest != 0) MATRIX_F32_FREE((*t_dest)->m_val);
+
+	MATRIX_F32_FREE(*t_dest);
+	*t_dest = 0;
+
+	return MatrixStatusOK;
+}
+
+int32_t *matrixq31GetBuffer(MatrixQ31Ptr t_dest) { return t_dest == 0 ? 0 : t_dest->m_val; }
+
+MatrixStatus matrixq31FromF32(const MatrixQ31Ptr t_result, const MatrixF32Ptr t_source) {
+	if (t_result == 0 || t_source == 0 || t_source->m_val == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixqDimMatch(t_result->m_row, t_result->m_col, t_source->m_row, t_source->m_col)) {
+		return MatrixStatusErrDimMismatch;
+	}
+	if (!m_matrixf32RowMajorBuffer(t_source)) return MatrixStatusErrLayout;
+
+	for (size_t i = 0; i < t_result->m_row * t_result->m_col; ++i) {
+		t_result->m_val[i] = (int32_t)m_matrixqRoundFromF32(t_source->m_val[i], 2147483648.0, INT32_MIN, INT32_MAX);
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixq31ToF32(const MatrixF32Ptr t_result, const MatrixQ31Ptr t_source) {
+	if (t_result == 0 || t_source == 0 || t_result->m_val == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixqDimMatch(t_result->m_row, t_result->m_col, t_source->m_row, t_source->m_col)) {
+		return MatrixStatusErrDimMismatch;
+	}
+	if (!m_matrixf32RowMajorBuffer(t_result)) return MatrixStatusErrLayout;
+
+	m_matrixf32Touch(t_result);
+
+	for (size_t i = 0; i < t_source->m_row * t_source->m_col; ++i) {
+		t_result->m_val[i] = (float)t_source->m_val[i] * (1.0f / 2147483648.0f);
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixq31Add(const MatrixQ31Ptr t_result, const MatrixQ31Ptr t_mat_b, const MatrixQ31Ptr t_mat_c) {
+	if (t_result == 0 || t_mat_b == 0 || t_mat_c == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixqDimMatch(t_result->m_row, t_result->m_col, t_mat_b->m_row, t_mat_b->m_col) ||
+		!m_matrixqDimMatch(t_result->m_row, t_result->m_col, t_mat_c->m_row, t_mat_c->m_col)) {
+		return MatrixStatusErrDimMismatch;
+	}
+
+	for (size_t i = 0; i < t_result->m_row * t_result->m_col; ++i) {
+		t_result->m_val[i] = m_matrixq31Saturate((int64_t)t_mat_b->m_val[i] + t_mat_c->m_val[i]);
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixq31Subtract(const MatrixQ31Ptr t_result, const MatrixQ31Ptr t_mat_b, const MatrixQ31Ptr t_mat_c) {
+	if (t_result == 0 || t_mat_b == 0 || t_mat_c == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixqDimMatch(t_result->m_row, t_result->m_col, t_mat_b->m_row, t_mat_b->m_col) ||
+		!m_matrixqDimMatch(t_result->m_row, t_result->m_col, t_mat_c->m_row, t_mat_c->m_col)) {
+		return MatrixStatusErrDimMismatch;
+	}
+
+	for (size_t i = 0; i < t_result->m_row * t_result->m_col; ++i) {
+		t_result->m_val[i] = m_matrixq31Saturate((int64_t)t_mat_b->m_val[i] - t_mat_c->m_val[i]);
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixq31Scale(const MatrixQ31Ptr t_result, int32_t t_val, const MatrixQ31Ptr t_mat_b) {
+	if (t_result == 0 || t_mat_b == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixqDimMatch(t_result->m_row, t_result->m_col, t_mat_b->m_row, t_mat_b->m_col)) {
+		return MatrixStatusErrDimMismatch;
+	}
+
+	for (size_t i = 0; i < t_result->m_row * t_result->m_col; ++i) {
+		t_result->m_val[i] = m_matrixq31Saturate(((int64_t)t_mat_b->m_val[i] * t_val + ((int64_t)1 << 30)) >> 31);
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixq31Multiplication(const MatrixQ31Ptr t_result, const MatrixQ31Ptr t_mat_b,
+									 const MatrixQ31Ptr t_mat_c) {
+	if (t_result == 0 || t_mat_b == 0 || t_mat_c == 0) return MatrixStatusErrNullPtr;
+	if (t_mat_b->m_col != t_mat_c->m_row || t_result->m_row != t_mat_b->m_row || t_result->m_col != t_mat_c->m_col) {
+		return MatrixStatusErrDimMismatch;
+	}
+
+	// beyond 65535 full scale products the 64 bit sum can overflow
+	if (t_mat_b->m_col > 65535) return MatrixStatusErrOutOfBound;
+
+	const size_t inner = t_mat_b->m_col;
+	const size_t col = t_mat_c->m_col;
+
+	for (size_t i = 0; i < t_result->m_row; ++i) {
+		const int32_t *b_row = t_mat_b->m_val + i * inner;
+
+		for (size_t j = 0; j < col; ++j) {
+			int64_t sum = 0;  // Q47
+
+			for (size_t k = 0; k < inner; ++k) {
+				sum += ((int64_t)b_row[k] * t_mat_c->m_val[k * col + j]) >> 15;
+			}
+
+			t_result->m_val[i * col + j] = m_matrixq31Saturate((sum + (1 << 15)) >> 16);
+		}
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixq31Solve(const MatrixQ31Ptr t_result, const MatrixQ31Ptr t_mat_a, const MatrixQ31Ptr t_column) {
+	if (t_result == 0 || t_mat_a == 0 || t_column == 0) return MatrixStatusErrNullPtr;
+
+	const size_t n = t_mat_a->m_row;
+	const size_t k = t_column->m_col;
+	if (t_mat_a->m_col != n || t_column->m_row != n || !m_matrixqDimMatch(t_result->m_row, t_result->m_col, n, k)) {
+		return MatrixStatusErrDimMismatch;
+	}
+
+	int64_t *a = m_matrixqSolveWorkspace(n, k);
+	if (a == 0) return MatrixStatusErrNullPtr;
+
+	int64_t *b = a + n * n;
+
+	for (size_t i = 0; i < n * n; ++i) {
+		a[i] = t_mat_a->m_val[i];
+	}
+
+	for (size_t i = 0; i < n * k; ++i) {
+		b[i] = t_column->m_val[i];
+	}
+
+	MatrixStatus status = m_matrixqSolveKernel(a, b, n, k);
+
+	if (status == MatrixStatusOK) {
+		for (size_t i = 0; i < n * k; ++i) {
+			t_result->m_val[i] = (int32_t)b[i];
+		}
+	}
+
+	MATRIX_F32_FREE(a);
+
+	return status;
+}
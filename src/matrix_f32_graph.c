@@ -0,0 +1,518 @@
+/**
+ * @Date:   2026-10-19T20:31:07+08:00
+ * @Last modified time: 2026-10-19T20:31:07+08:00
+ */
+
+#include "include/matrix_f32_graph.h"
+#include "src/matrix_f32_private.h"
+
+#include <string.h>
+
+// floats per block of a fused elementwise kernel, one block of every register stays in L1
+#ifndef MATRIX_F32_GRAPH_BLOCK
+#define MATRIX_F32_GRAPH_BLOCK 256
+#endif
+
+// rows of a multiplication computed before its epilogue runs, B is streamed once per panel
+#ifndef MATRIX_F32_GRAPH_PANEL
+#define MATRIX_F32_GRAPH_PANEL 64
+#endif
+
+// distinct matrices a fused kernel may touch, a longer chain is split into several steps
+#ifndef MATRIX_F32_GRAPH_REGISTERS
+#define MATRIX_F32_GRAPH_REGISTERS 8
+#endif
+
+typedef enum { GraphOpAdd = 0, GraphOpSubtract, GraphOpScale, GraphOpCopy, GraphOpMultiplication } GraphOpType;
+
+typedef struct GraphNode {
+	GraphOpType m_type;
+	MatrixF32Ptr m_dest;
+	MatrixF32Ptr m_a;
+	MatrixF32Ptr m_b;  // NULL for scale and copy
+	float m_scalar;	   // factor of scale, alpha of multiplication
+	bool m_removed;
+} GraphNodeType;
+
+typedef enum {
+	GraphInstrLoad = 0,
+	GraphInstrLoadPanel,
+	GraphInstrAdd,
+	GraphInstrSubtract,
+	GraphInstrScale,
+	GraphInstrCopy,
+	GraphInstrStore
+} GraphInstrType;
+
+typedef struct GraphInstruction {
+	GraphInstrType m_type;
+	uint8_t m_dest;	 // registers
+	uint8_t m_a;
+	uint8_t m_b;
+	float m_scalar;
+	MatrixF32Ptr m_matrix;	// load and store
+} GraphInstructionType;
+
+typedef struct GraphStep {
+	size_t m_first;	 // first instruction
+	size_t m_count;
+	size_t m_row;  // dimension of the elementwise range
+	size_t m_col;
+
+	// multiplication feeding the instructions panel by panel, m_gemmA is NULL if there is none
+	MatrixF32Ptr m_gemmA;
+	MatrixF32Ptr m_gemmB;
+	float m_alpha;
+} GraphStepType;
+
+typedef struct GraphBinding {
+	MatrixF32Ptr m_matrix;
+	bool m_written;
+} GraphBindingType;
+
+struct MatrixF32Graph {
+	GraphNodeType *m_node;
+	size_t m_nodeCount;
+	size_t m_nodeCapacity;
+
+	MatrixF32Ptr *m_temporary;
+	size_t m_temporaryCount;
+	size_t m_temporaryCapacity;
+
+	GraphInstructionType *m_instruction;
+	size_t m_instructionCount;
+	size_t m_instructionCapacity;
+
+	GraphStepType *m_step;
+	size_t m_stepCount;
+	size_t m_stepCapacity;
+
+	bool m_compiled;
+
+	float *m_register;	// MATRIX_F32_GRAPH_REGISTERS blocks
+	float *m_panel;		// MATRIX_F32_GRAPH_PANEL rows of the widest multiplication
+	size_t m_panelSize;
+};
+
+// private function
+// returns t_array with room for one more element, or NULL with t_array untouched if the allocation fails
+static void *m_matrixf32GraphGrow(void *t_array, size_t *t_capacity, size_t t_count, size_t t_size) {
+	if (t_count < *t_capacity) return t_array;
+
+	const size_t capacity = *t_capacity == 0 ? 16 : 2 * *t_capacity;
+	void *grown = MATRIX_F32_MALLOC(capacity * t_size);
+	if (grown == 0) return 0;
+
+	if (t_array != 0) memcpy(grown, t_array, t_count * t_size);
+	MATRIX_F32_FREE(t_array);
+	*t_capacity = capacity;
+
+	return grown;
+}
+
+static bool m_matrixf32GraphIsTemporary(const struct MatrixF32Graph *t_graph, const MatrixF32Ptr t_mat) {
+	for (size_t i = 0; i < t_graph->m_temporaryCount; ++i) {
+		if (t_graph->m_temporary[i] == t_mat) return true;
+	}
+
+	return false;
+}
+
+// whether the value t_mat has after node t_index is read later, or is a result of the graph
+static bool m_matrixf32GraphLiveAfter(const struct MatrixF32Graph *t_graph, size_t t_index, const MatrixF32Ptr t_mat) {
+	for (size_t i = t_index + 1; i < t_graph->m_nodeCount; ++i) {
+		const GraphNodeType *node = &t_graph->m_node[i];
+
+		if (node->m_removed) continue;
+		if (node->m_a == t_mat || node->m_b == t_mat) return true;
+		if (node->m_dest == t_mat) return false;
+	}
+
+	return !m_matrixf32GraphIsTemporary(t_graph, t_mat);
+}
+
+static MatrixStatus m_matrixf32GraphRecord(MatrixF32GraphPtr t_graph, GraphOpType t_type, const MatrixF32Ptr t_dest,
+										   const MatrixF32Ptr t_a, const MatrixF32Ptr t_b, float t_scalar) {
+	if (t_graph == 0 || t_dest == 0 || t_a == 0 || t_dest->m_val == 0 || t_a->m_val == 0) {
+		return MatrixStatusErrNullPtr;
+	}
+
+	const bool binary = t_type == GraphOpAdd || t_type == GraphOpSubtract || t_type == GraphOpMultiplication;
+	if (binary && (t_b == 0 || t_b->m_val == 0)) return MatrixStatusErrNullPtr;
+
+	bool dim_matched;
+
+	if (t_type == GraphOpMultiplication) {
+		dim_matched = t_a->m_col == t_b->m_row && t_dest->m_row == t_a->m_row && t_dest->m_col == t_b->m_col;
+	} else {
+		dim_matched = t_dest->m_row == t_a->m_row && t_dest->m_col == t_a->m_col &&
+					  (!binary || (t_dest->m_row == t_b->m_row && t_dest->m_col == t_b->m_col));
+	}
+
+	if (!dim_matched) return MatrixStatusErrDimMismatch;
+	bool row_major = m_matrixf32RowMajorBuffer(t_dest) && m_matrixf32RowMajorBuffer(t_a) &&
+					 m_matrixf32RowMajorBuffer(t_b);
+	if (!row_major) return MatrixStatusErrLayout;
+
+	GraphNodeType *node =
+		m_matrixf32GraphGrow(t_graph->m_node, &t_graph->m_nodeCapacity, t_graph->m_nodeCount, sizeof(GraphNodeType));
+	if (node == 0) return MatrixStatusErrNullPtr;
+
+	t_graph->m_node = node;
+	t_graph->m_node[t_graph->m_nodeCount++] =
+		(GraphNodeType){t_type, t_dest, t_a, binary ? t_b : 0, t_scalar, false};
+	t_graph->m_compiled = false;
+
+	return MatrixStatusOK;
+}
+
+static bool m_matrixf32GraphEmit(MatrixF32GraphPtr t_graph, GraphInstructionType t_instruction) {
+	GraphInstructionType *instruction =
+		m_matrixf32GraphGrow(t_graph->m_instruction, &t_graph->m_instructionCapacity, t_graph->m_instructionCount,
+							 sizeof(GraphInstructionType));
+	if (instruction == 0) return false;
+
+	t_graph->m_instruction = instruction;
+	t_graph->m_instruction[t_graph->m_instructionCount++] = t_instruction;
+
+	return true;
+}
+
+static int m_matrixf32GraphFind(const GraphBindingType *t_binding, size_t t_bound, const MatrixF32Ptr t_mat) {
+	for (size_t i = 0; i < t_bound; ++i) {
+		if (t_binding[i].m_matrix == t_mat) return (int)i;
+	}
+
+	return -1;
+}
+
+// register of t_mat, loaded from memory on first use
+static int m_matrixf32GraphLoad(MatrixF32GraphPtr t_graph, GraphBindingType *t_binding, size_t *t_bound,
+								const MatrixF32Ptr t_mat) {
+	int reg = m_matrixf32GraphFind(t_binding, *t_bound, t_mat);
+	if (reg >= 0) return reg;
+
+	reg = (int)(*t_bound)++;
+	t_binding[reg] = (GraphBindingType){t_mat, false};
+
+	GraphInstructionType load = {GraphInstrLoad, (uint8_t)reg, 0, 0, 0.0f, t_mat};
+
+	return m_matrixf32GraphEmit(t_graph, load) ? reg : -1;
+}
+
+// distinct matrices of t_node not bound to a register yet
+static size_t m_matrixf32GraphUnbound(const GraphBindingType *t_binding, size_t t_bound, const GraphNodeType *t_node) {
+	size_t unbound = 0;
+
+	if (m_matrixf32GraphFind(t_binding, t_bound, t_node->m_dest) < 0) ++unbound;
+	if (t_node->m_a != t_node->m_dest && m_matrixf32GraphFind(t_binding, t_bound, t_node->m_a) < 0) ++unbound;
+	if (t_node->m_b != 0 && t_node->m_b != t_node->m_dest && t_node->m_b != t_node->m_a &&
+		m_matrixf32GraphFind(t_binding, t_bound, t_node->m_b) < 0) {
+		++unbound;
+	}
+
+	return unbound;
+}
+
+static void m_matrixf32GraphFoldScale(MatrixF32GraphPtr t_graph) {
+	for (size_t i = 0; i + 1 < t_graph->m_nodeCount; ++i) {
+		GraphNodeType *scale = &t_graph->m_node[i];
+		GraphNodeType *mult = &t_graph->m_node[i + 1];
+		const MatrixF32Ptr temporary = scale->m_dest;
+
+		if (scale->m_removed || scale->m_type != GraphOpScale || mult->m_type != GraphOpMultiplication) continue;
+		if (!m_matrixf32GraphIsTemporary(t_graph, temporary) || scale->m_a == mult->m_dest) continue;
+		if ((mult->m_a == temporary) == (mult->m_b == temporary) || mult->m_dest == temporary) continue;
+		if (m_matrixf32GraphLiveAfter(t_graph, i + 1, temporary)) continue;
+
+		// (s * A) * B = s * (A * B)
+		if (mult->m_a == temporary) {
+			mult->m_a = scale->m_a;
+		} else {
+			mult->m_b = scale->m_a;
+		}
+
+		mult->m_scalar *= scale->m_scalar;
+		scale->m_removed = true;
+	}
+}
+
+static void m_matrixf32GraphRemoveDead(MatrixF32GraphPtr t_graph) {
+	for (size_t i = t_graph->m_nodeCount; i-- > 0;) {
+		GraphNodeType *node = &t_graph->m_node[i];
+
+		if (!node->m_removed && m_matrixf32GraphIsTemporary(t_graph, node->m_dest) &&
+			!m_matrixf32GraphLiveAfter(t_graph, i, node->m_dest)) {
+			node->m_removed = true;
+		}
+	}
+}
+
+// emits the step starting at node *t_index and moves *t_index past the last node it covers
+static MatrixStatus m_matrixf32GraphEmitStep(MatrixF32GraphPtr t_graph, size_t *t_index) {
+	static const GraphInstrType instr_of[] = {GraphInstrAdd, GraphInstrSubtract, GraphInstrScale, GraphInstrCopy};
+
+	GraphBindingType binding[MATRIX_F32_GRAPH_REGISTERS];
+	size_t bound = 0;
+
+	const GraphNodeType *first = &t_graph->m_node[*t_index];
+	GraphStepType step = {t_graph->m_instructionCount, 0, first->m_dest->m_row, first->m_dest->m_col, 0, 0, 1.0f};
+	size_t last = *t_index;
+	size_t i = *t_index;
+
+	if (first->m_type == GraphOpMultiplication) {
+		step.m_gemmA = first->m_a;
+		step.m_gemmB = first->m_b;
+		step.m_alpha = first->m_scalar;
+
+		binding[bound++] = (GraphBindingType){first->m_dest, true};
+		GraphInstructionType load = {GraphInstrLoadPanel, 0, 0, 0, 0.0f, 0};
+		if (!m_matrixf32GraphEmit(t_graph, load)) return MatrixStatusErrNullPtr;
+
+		++i;
+	}
+
+	for (; i < t_graph->m_nodeCount; ++i) {
+		const GraphNodeType *node = &t_graph->m_node[i];
+
+		if (node->m_removed) continue;
+		if (node->m_type == GraphOpMultiplication) break;
+		if (node->m_dest->m_row != step.m_row || node->m_dest->m_col != step.m_col) break;
+		// the multiplication reads all of B and its panel of A after the epilogue of earlier panels ran
+		if (step.m_gemmA != 0 && (node->m_dest == step.m_gemmA || node->m_dest == step.m_gemmB)) break;
+		if (bound + m_matrixf32GraphUnbound(binding, bound, node) > MATRIX_F32_GRAPH_REGISTERS) break;
+
+		const int reg_a = m_matrixf32GraphLoad(t_graph, binding, &bound, node->m_a);
+		const int reg_b = node->m_b != 0 ? m_matrixf32GraphLoad(t_graph, binding, &bound, node->m_b) : 0;
+		if (reg_a < 0 || reg_b < 0) return MatrixStatusErrNullPtr;
+
+		int reg_dest = m_matrixf32GraphFind(binding, bound, node->m_dest);
+		if (reg_dest < 0) reg_dest = (int)bound++;
+		binding[reg_dest] = (GraphBindingType){node->m_dest, true};
+
+		GraphInstructionType op = {instr_of[node->m_type], (uint8_t)reg_dest, (uint8_t)reg_a, (uint8_t)reg_b,
+								   node->m_scalar, 0};
+		if (!m_matrixf32GraphEmit(t_graph, op)) return MatrixStatusErrNullPtr;
+
+		last = i;
+	}
+
+	// write back what is read by a later step or is a result, intermediate temporaries stay in registers
+	for (size_t r = 0; r < bound; ++r) {
+		if (!binding[r].m_written || !m_matrixf32GraphLiveAfter(t_graph, last, binding[r].m_matrix)) continue;
+
+		GraphInstructionType store = {GraphInstrStore, 0, (uint8_t)r, 0, 0.0f, binding[r].m_matrix};
+		if (!m_matrixf32GraphEmit(t_graph, store)) return MatrixStatusErrNullPtr;
+	}
+
+	step.m_count = t_graph->m_instructionCount - step.m_first;
+
+	GraphStepType *steps =
+		m_matrixf32GraphGrow(t_graph->m_step, &t_graph->m_stepCapacity, t_graph->m_stepCount, sizeof(GraphStepType));
+	if (steps == 0) return MatrixStatusErrNullPtr;
+
+	t_graph->m_step = steps;
+	t_graph->m_step[t_graph->m_stepCount++] = step;
+	*t_index = i;
+
+	return MatrixStatusOK;
+}
+
+// runs the instructions of t_step on the elements [t_begin, t_end), t_panel holds the multiplication result of them
+static void m_matrixf32GraphRun(MatrixF32GraphPtr t_graph, const GraphStepType *t_step, size_t t_begin,
+								size_t t_end, const float *t_panel) {
+	const GraphInstructionType *instruction = t_graph->m_instruction + t_step->m_first;
+	const float *reg[MATRIX_F32_GRAPH_REGISTERS];
+
+	for (size_t offset = t_begin; offset < t_end; offset += MATRIX_F32_GRAPH_BLOCK) {
+		const size_t len = (t_end - offset) > MATRIX_F32_GRAPH_BLOCK ? MATRIX_F32_GRAPH_BLOCK : t_end - offset;
+
+		for (size_t i = 0; i < t_step->m_count; ++i) {
+			const GraphInstructionType *instr = &instruction[i];
+			float *out = t_graph->m_register + instr->m_dest * MATRIX_F32_GRAPH_BLOCK;
+
+			// loads only point into the source, operations write their register block
+			switch (instr->m_type) {
+				case GraphInstrLoad:
+					reg[instr->m_dest] = instr->m_matrix->m_val + offset;
+					continue;
+				case GraphInstrLoadPanel:
+					reg[instr->m_dest] = t_panel + (offset - t_begin);
+					continue;
+				case GraphInstrStore:
+					memcpy(instr->m_matrix->m_val + offset, reg[instr->m_a], len * sizeof(float));
+					continue;
+				case GraphInstrAdd:
+					for (size_t e = 0; e < len; ++e) out[e] = reg[instr->m_a][e] + reg[instr->m_b][e];
+					break;
+				case GraphInstrSubtract:
+					for (size_t e = 0; e < len; ++e) out[e] = reg[instr->m_a][e] - reg[instr->m_b][e];
+					break;
+				case GraphInstrScale:
+					for (size_t e = 0; e < len; ++e) out[e] = instr->m_scalar * reg[instr->m_a][e];
+					break;
+				case GraphInstrCopy:
+					if (out != reg[instr->m_a]) memcpy(out, reg[instr->m_a], len * sizeof(float));
+					break;
+			}
+
+			reg[instr->m_dest] = out;
+		}
+	}
+}
+
+MatrixF32GraphPtr matrixf32GraphCreate(void) {
+	MatrixF32GraphPtr graph = MATRIX_F32_MALLOC(sizeof(struct MatrixF32Graph));
+	if (graph == 0) return 0;
+
+	memset(graph, 0, sizeof(struct MatrixF32Graph));
+
+	return graph;
+}
+
+MatrixStatus matrixf32GraphDestroy(MatrixF32GraphPtr *t_graph) {
+	if (t_graph == 0) return MatrixStatusErrNullPtr;
+
+	if (*t_graph != 0) {
+		MATRIX_F32_FREE((*t_graph)->m_node);
+		MATRIX_F32_FREE((*t_graph)->m_temporary);
+		MATRIX_F32_FREE((*t_graph)->m_instruction);
+		MATRIX_F32_FREE((*t_graph)->m_step);
+		MATRIX_F32_FREE((*t_graph)->m_register);
+		MATRIX_F32_FREE((*t_graph)->m_panel);
+	}
+
+	MATRIX_F32_FREE(*t_graph);
+	*t_graph = 0;
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32GraphAdd(MatrixF32GraphPtr t_graph, const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b,
+							   const MatrixF32Ptr t_mat_c) {
+	return m_matrixf32GraphRecord(t_graph, GraphOpAdd, t_result, t_mat_b, t_mat_c, 0.0f);
+}
+
+MatrixStatus matrixf32GraphSubtract(MatrixF32GraphPtr t_graph, const MatrixF32Ptr t_result,
+									const MatrixF32Ptr t_mat_b, const MatrixF32Ptr t_mat_c) {
+	return m_matrixf32GraphRecord(t_graph, GraphOpSubtract, t_result, t_mat_b, t_mat_c, 0.0f);
+}
+
+MatrixStatus matrixf32GraphScale(MatrixF32GraphPtr t_graph, const MatrixF32Ptr t_result, float t_val,
+								 const MatrixF32Ptr t_mat_b) {
+	return m_matrixf32GraphRecord(t_graph, GraphOpScale, t_result, t_mat_b, 0, t_val);
+}
+
+MatrixStatus matrixf32GraphMultiplication(MatrixF32GraphPtr t_graph, const MatrixF32Ptr t_result,
+										  const MatrixF32Ptr t_mat_b, const MatrixF32Ptr t_mat_c) {
+	return m_matrixf32GraphRecord(t_graph, GraphOpMultiplication, t_result, t_mat_b, t_mat_c, 1.0f);
+}
+
+MatrixStatus matrixf32GraphCopy(MatrixF32GraphPtr t_graph, const MatrixF32Ptr t_result, const MatrixF32Ptr t_source) {
+	return m_matrixf32GraphRecord(t_graph, GraphOpCopy, t_result, t_source, 0, 0.0f);
+}
+
+MatrixStatus matrixf32GraphSetTemporary(MatrixF32GraphPtr t_graph, const MatrixF32Ptr t_mat) {
+	if (t_graph == 0 || t_mat == 0) return MatrixStatusErrNullPtr;
+	if (m_matrixf32GraphIsTemporary(t_graph, t_mat)) return MatrixStatusOK;
+
+	MatrixF32Ptr *temporary = m_matrixf32GraphGrow(t_graph->m_temporary, &t_graph->m_temporaryCapacity,
+												   t_graph->m_temporaryCount, sizeof(MatrixF32Ptr));
+	if (temporary == 0) return MatrixStatusErrNullPtr;
+
+	t_graph->m_temporary = temporary;
+	t_graph->m_temporary[t_graph->m_temporaryCount++] = t_mat;
+	t_graph->m_compiled = false;
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32GraphCompile(MatrixF32GraphPtr t_graph) {
+	if (t_graph == 0) return MatrixStatusErrNullPtr;
+
+	t_graph->m_compiled = false;
+	t_graph->m_instructionCount = 0;
+	t_graph->m_stepCount = 0;
+
+	for (size_t i = 0; i < t_graph->m_nodeCount; ++i) {
+		t_graph->m_node[i].m_removed = false;
+	}
+
+	m_matrixf32GraphFoldScale(t_graph);
+	m_matrixf32GraphRemoveDead(t_graph);
+
+	size_t panel_size = 0;
+
+	for (size_t i = 0; i < t_graph->m_nodeCount;) {
+		if (t_graph->m_node[i].m_removed) {
+			++i;
+			continue;
+		}
+
+		MatrixStatus ret_val = m_matrixf32GraphEmitStep(t_graph, &i);
+		if (ret_val != MatrixStatusOK) return ret_val;
+
+		const GraphStepType *step = &t_graph->m_step[t_graph->m_stepCount - 1];
+		const size_t panel_rows = step->m_row < MATRIX_F32_GRAPH_PANEL ? step->m_row : MATRIX_F32_GRAPH_PANEL;
+
+		if (step->m_gemmA != 0 && panel_rows * step->m_col > panel_size) panel_size = panel_rows * step->m_col;
+	}
+
+	if (t_graph->m_register == 0) {
+		t_graph->m_register = MATRIX_F32_MALLOC(MATRIX_F32_GRAPH_REGISTERS * MATRIX_F32_GRAPH_BLOCK * sizeof(float));
+		if (t_graph->m_register == 0) return MatrixStatusErrNullPtr;
+	}
+
+	if (panel_size > t_graph->m_panelSize) {
+		MATRIX_F32_FREE(t_graph->m_panel);
+		t_graph->m_panel = MATRIX_F32_MALLOC(panel_size * sizeof(float));
+		t_graph->m_panelSize = t_graph->m_panel != 0 ? panel_size : 0;
+
+		if (t_graph->m_panel == 0) return MatrixStatusErrNullPtr;
+	}
+
+	t_graph->m_compiled = true;
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32GraphReplay(MatrixF32GraphPtr t_graph) {
+	if (t_graph == 0) return MatrixStatusErrNullPtr;
+
+	if (!t_graph->m_compiled) {
+		MatrixStatus ret_val = matrixf32GraphCompile(t_graph);
+		if (ret_val != MatrixStatusOK) return ret_val;
+	}
+
+	for (size_t s = 0; s < t_graph->m_stepCount; ++s) {
+		const GraphStepType *step = &t_graph->m_step[s];
+
+		for (size_t i = step->m_first; i < step->m_first + step->m_count; ++i) {
+			const GraphInstructionType *instr = &t_graph->m_instruction[i];
+
+			if (instr->m_type == GraphInstrStore) m_matrixf32Touch(instr->m_matrix);
+		}
+
+		if (step->m_gemmA == 0) {
+			m_matrixf32GraphRun(t_graph, step, 0, step->m_row * step->m_col, 0);
+			continue;
+		}
+
+		const size_t inner = step->m_gemmA->m_col;
+
+		for (size_t row = 0; row < step->m_row; row += MATRIX_F32_GRAPH_PANEL) {
+			const size_t rows =
+				(step->m_row - row) > MATRIX_F32_GRAPH_PANEL ? MATRIX_F32_GRAPH_PANEL : step->m_row - row;
+
+			m_matrixf32GemmKernel(rows, step->m_col, inner, step->m_alpha, step->m_gemmA->m_val + row * inner, inner,
+								  step->m_gemmB->m_val, step->m_col, false, t_graph->m_panel, step->m_col);
+			m_matrixf32GraphRun(t_graph, step, row * step->m_col, (row + rows) * step->m_col, t_graph->m_panel);
+		}
+	}
+
+	return MatrixStatusOK;
+}
+
+size_t matrixf32GraphGetStepNumber(MatrixF32GraphPtr t_graph) {
+	return t_graph == 0 || !t_graph->m_compiled ? 0 : t_graph->m_stepCount;
+}
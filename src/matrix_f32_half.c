@@ -0,0 +1,301 @@
+/**
+ * @Date:   2026-10-19T22:31:45+08:00
+ * @Last modified time: 2026-10-19T22:31:45+08:00
+ */
+
+#include "include/matrix_f32_half.h"
+#include "src/matrix_f32_private.h"
+
+#include <string.h>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+#ifndef MATRIX_F32_HALF_TILE_ROWS
+#define MATRIX_F32_HALF_TILE_ROWS 8
+#endif
+
+#ifndef MATRIX_F32_HALF_TILE_K
+#define MATRIX_F32_HALF_TILE_K 64
+#endif
+
+// floats converted at once by the elementwise functions
+#define MATRIX_F32_HALF_CHUNK 256
+
+struct MatrixHalf {
+	size_t m_row;
+	size_t m_col;
+
+	uint16_t *m_val;
+	MatrixHalfFormat m_format;
+};
+
+// private function
+static inline uint32_t m_matrixhalfFloatBits(float t_val) {
+	uint32_t bits;
+	memcpy(&bits, &t_val, sizeof(bits));
+
+	return bits;
+}
+
+static inline float m_matrixhalfBitsFloat(uint32_t t_bits) {
+	float val;
+	memcpy(&val, &t_bits, sizeof(val));
+
+	return val;
+}
+
+static inline float m_matrixhalfFp16ToF32(uint16_t t_half) {
+	const uint32_t sign = (uint32_t)(t_half & 0x8000u) << 16;
+	const uint32_t exponent = (t_half >> 10) & 0x1Fu;
+	const uint32_t mantissa = t_half & 0x3FFu;
+
+	if (exponent == 0) {
+		// zero or subnormal, mantissa * 2^-24 is exact in float
+		const float val = (float)mantissa * 5.9604644775390625e-8f;
+
+		return sign != 0 ? -val : val;
+	}
+
+	if (exponent == 31) return m_matrixhalfBitsFloat(sign | 0x7F800000u | (mantissa << 13));
+
+	return m_matrixhalfBitsFloat(sign | ((exponent + 112) << 23) | (mantissa << 13));
+}
+
+static inline uint16_t m_matrixhalfF32ToFp16(float t_val) {
+	uint32_t bits = m_matrixhalfFloatBits(t_val);
+	const uint16_t sign = (uint16_t)((bits >> 16) & 0x8000u);
+	bits &= 0x7FFFFFFFu;
+
+	// infinity and NaN, NaN stays quiet
+	if (bits >= 0x7F800000u) return sign | 0x7C00u | (bits > 0x7F800000u ? 0x200u : 0u);
+
+	// 65520 and above round to infinity
+	if (bits >= 0x477FF000u) return sign | 0x7C00u;
+
+	if (bits < 0x38800000u) {
+		// subnormal result, adding 0.5f lets the FPU round the mantissa to nearest even
+		const float rounded = m_matrixhalfBitsFloat(bits) + 0.5f;
+
+		return sign | (uint16_t)(m_matrixhalfFloatBits(rounded) - 0x3F000000u);
+	}
+
+	// rebias the exponent and round to nearest even on the 13 dropped bits
+	bits += ((uint32_t)(15 - 127) << 23) + 0xFFFu + ((bits >> 13) & 1u);
+
+	return sign | (uint16_t)(bits >> 13);
+}
+
+static inline float m_matrixhalfBf16ToF32(uint16_t t_half) { return m_matrixhalfBitsFloat((uint32_t)t_half << 16); }
+
+static inline uint16_t m_matrixhalfF32ToBf16(float t_val) {
+	const uint32_t bits = m_matrixhalfFloatBits(t_val);
+
+	if ((bits & 0x7FFFFFFFu) > 0x7F800000u) return (uint16_t)((bits >> 16) | 0x40u);
+
+	return (uint16_t)((bits + 0x7FFFu + ((bits >> 16) & 1u)) >> 16);
+}
+
+static void m_matrixhalfToF32Kernel(const uint16_t *t_src, float *t_dst, size_t t_count, MatrixHalfFormat t_format) {
+	size_t i = 0;
+
+	if (t_format == MatrixHalfBf16) {
+		for (; i < t_count; ++i) {
+			t_dst[i] = m_matrixhalfBf16ToF32(t_src[i]);
+		}
+
+		return;
+	}
+
+#if defined(__F16C__)
+	for (; i + 8 <= t_count; i += 8) {
+		_mm256_storeu_ps(t_dst + i, _mm256_cvtph_ps(_mm_loadu_si128((const __m128i *)(t_src + i))));
+	}
+#endif
+
+	for (; i < t_count; ++i) {
+#if defined(__ARM_FP16_FORMAT_IEEE)
+		__fp16 half;
+		memcpy(&half, t_src + i, sizeof(half));
+		t_dst[i] = half;
+#else
+		t_dst[i] = m_matrixhalfFp16ToF32(t_src[i]);
+#endif
+	}
+}
+
+static void m_matrixhalfFromF32Kernel(const float *t_src, uint16_t *t_dst, size_t t_count, MatrixHalfFormat t_format) {
+	size_t i = 0;
+
+	if (t_format == MatrixHalfBf16) {
+		for (; i < t_count; ++i) {
+			t_dst[i] = m_matrixhalfF32ToBf16(t_src[i]);
+		}
+
+		return;
+	}
+
+#if defined(__F16C__)
+	for (; i + 8 <= t_count; i += 8) {
+		const __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(t_src + i), _MM_FROUND_TO_NEAREST_INT);
+		_mm_storeu_si128((__m128i *)(t_dst + i), half);
+	}
+#endif
+
+	for (; i < t_count; ++i) {
+#if defined(__ARM_FP16_FORMAT_IEEE)
+		const __fp16 half = (__fp16)t_src[i];
+		memcpy(t_dst + i, &half, sizeof(half));
+#else
+		t_dst[i] = m_matrixhalfF32ToFp16(t_src[i]);
+#endif
+	}
+}
+
+static bool m_matrixhalfDimMatch(const MatrixHalfPtr t_half, const MatrixF32Ptr t_mat) {
+	return t_half->m_row == t_mat->m_row && t_half->m_col == t_mat->m_col;
+}
+
+MatrixHalfPtr matrixhalfCreate(MatrixDimType t_dim, MatrixHalfFormat t_format) {
+	if (t_format != MatrixHalfFp16 && t_format != MatrixHalfBf16) return 0;
+	if (t_dim.m_row == 0 || t_dim.m_col == 0 || t_dim.m_row > SIZE_MAX / sizeof(uint16_t) / t_dim.m_col) return 0;
+
+	MatrixHalfPtr mat = MATRIX_F32_MALLOC(sizeof(struct MatrixHalf));
+	if (mat == 0) return 0;
+
+	mat->m_row = t_dim.m_row;
+	mat->m_col = t_dim.m_col;
+	mat->m_format = t_format;
+	mat->m_val = MATRIX_F32_MALLOC(t_dim.m_row * t_dim.m_col * sizeof(uint16_t));
+
+	if (mat->m_val == 0) {
+		MATRIX_F32_FREE(mat);
+
+		return 0;
+	}
+
+	// +0 in both formats
+	memset(mat->m_val, 0, t_dim.m_row * t_dim.m_col * sizeof(uint16_t));
+
+	return mat;
+}
+
+MatrixStatus matrixhalfDestroy(MatrixHalfPtr *t_dest) {
+	if (t_dest == 0) return MatrixStatusErrNullPtr;
+
+	if (*t_dest != 0) MATRIX_F32_FREE((*t_dest)->m_val);
+
+	MATRIX_F32_FREE(*t_dest);
+	*t_dest = 0;
+
+	return MatrixStatusOK;
+}
+
+MatrixHalfFormat matrixhalfGetFormat(MatrixHalfPtr t_dest) { return t_dest == 0 ? MatrixHalfFp16 : t_dest->m_format; }
+
+uint16_t *matrixhalfGetBuffer(MatrixHalfPtr t_dest) { return t_dest == 0 ? 0 : t_dest->m_val; }
+
+MatrixStatus matrixhalfFromF32(const MatrixHalfPtr t_result, const MatrixF32Ptr t_source) {
+	if (t_result == 0 || t_source == 0 || t_source->m_val == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixhalfDimMatch(t_result, t_source)) return MatrixStatusErrDimMismatch;
+	if (!m_matrixf32RowMajorBuffer(t_source)) return MatrixStatusErrLayout;
+
+	m_matrixhalfFromF32Kernel(t_source->m_val, t_result->m_val, t_result->m_row * t_result->m_col, t_result->m_format);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixhalfToF32(const MatrixF32Ptr t_result, const MatrixHalfPtr t_source) {
+	if (t_result == 0 || t_source == 0 || t_result->m_val == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixhalfDimMatch(t_source, t_result)) return MatrixStatusErrDimMismatch;
+	if (!m_matrixf32RowMajorBuffer(t_result)) return MatrixStatusErrLayout;
+
+	m_matrixf32Touch(t_result);
+	m_matrixhalfToF32Kernel(t_source->m_val, t_result->m_val, t_source->m_row * t_source->m_col, t_source->m_format);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixhalfAdd(const MatrixF32Ptr t_result, const MatrixHalfPtr t_mat_b, const MatrixF32Ptr t_mat_c) {
+	if (t_result == 0 || t_mat_b == 0 || t_mat_c == 0) return MatrixStatusErrNullPtr;
+	if (t_result->m_val == 0 || t_mat_c->m_val == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixhalfDimMatch(t_mat_b, t_result) || !m_matrixhalfDimMatch(t_mat_b, t_mat_c)) {
+		return MatrixStatusErrDimMismatch;
+	}
+	if (!m_matrixf32RowMajorBuffer(t_result) || !m_matrixf32RowMajorBuffer(t_mat_c)) return MatrixStatusErrLayout;
+
+	m_matrixf32Touch(t_result);
+
+	const size_t total = t_mat_b->m_row * t_mat_b->m_col;
+	float chunk[MATRIX_F32_HALF_CHUNK];
+
+	for (size_t start = 0; start < total; start += MATRIX_F32_HALF_CHUNK) {
+		const size_t count = total - start < MATRIX_F32_HALF_CHUNK ? total - start : MATRIX_F32_HALF_CHUNK;
+		m_matrixhalfToF32Kernel(t_mat_b->m_val + start, chunk, count, t_mat_b->m_format);
+
+		for (size_t i = 0; i < count; ++i) {
+			t_result->m_val[start + i] = chunk[i] + t_mat_c->m_val[start + i];
+		}
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixhalfScale(const MatrixF32Ptr t_result, float t_val, const MatrixHalfPtr t_mat_b) {
+	if (t_result == 0 || t_mat_b == 0 || t_result->m_val == 0) return MatrixStatusErrNullPtr;
+	if (!m_matrixhalfDimMatch(t_mat_b, t_result)) return MatrixStatusErrDimMismatch;
+	if (!m_matrixf32RowMajorBuffer(t_result)) return MatrixStatusErrLayout;
+
+	m_matrixf32Touch(t_result);
+
+	const size_t total = t_mat_b->m_row * t_mat_b->m_col;
+
+	for (size_t start = 0; start < total; start += MATRIX_F32_HALF_CHUNK) {
+		const size_t count = total - start < MATRIX_F32_HALF_CHUNK ? total - start : MATRIX_F32_HALF_CHUNK;
+		float *out = t_result->m_val + start;
+
+		m_matrixhalfToF32Kernel(t_mat_b->m_val + start, out, count, t_mat_b->m_format);
+
+		for (size_t i = 0; i < count; ++i) {
+			out[i] *= t_val;
+		}
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixhalfMultiplication(const MatrixF32Ptr t_result, const MatrixHalfPtr t_mat_b,
+									  const MatrixF32Ptr t_mat_c) {
+	if (t_result == 0 || t_mat_b == 0 || t_mat_c == 0) return MatrixStatusErrNullPtr;
+	if (t_result->m_val == 0 || t_mat_c->m_val == 0) return MatrixStatusErrNullPtr;
+	if (t_mat_b->m_col != t_mat_c->m_row || t_result->m_row != t_mat_b->m_row || t_result->m_col != t_mat_c->m_col) {
+		return MatrixStatusErrDimMismatch;
+	}
+	if (!m_matrixf32RowMajorBuffer(t_result) || !m_matrixf32RowMajorBuffer(t_mat_c)) return MatrixStatusErrLayout;
+
+	m_matrixf32Touch(t_result);
+
+	const size_t inner = t_mat_b->m_col;
+	const size_t col = t_mat_c->m_col;
+	float tile[MATRIX_F32_HALF_TILE_ROWS * MATRIX_F32_HALF_TILE_K];
+
+	for (size_t i0 = 0; i0 < t_mat_b->m_row; i0 += MATRIX_F32_HALF_TILE_ROWS) {
+		const size_t rows =
+			t_mat_b->m_row - i0 < MATRIX_F32_HALF_TILE_ROWS ? t_mat_b->m_row - i0 : MATRIX_F32_HALF_TILE_ROWS;
+
+		for (size_t k0 = 0; k0 < inner; k0 += MATRIX_F32_HALF_TILE_K) {
+			const size_t depth = inner - k0 < MATRIX_F32_HALF_TILE_K ? inner - k0 : MATRIX_F32_HALF_TILE_K;
+
+			for (size_t i = 0; i < rows; ++i) {
+				m_matrixhalfToF32Kernel(t_mat_b->m_val + (i0 + i) * inner + k0, tile + i * depth, depth,
+										t_mat_b->m_format);
+			}
+
+			m_matrixf32GemmKernel(rows, col, depth, 1.0f, tile, depth, t_mat_c->m_val + k0 * col, col, k0 != 0,
+								  t_result->m_val + i0 * col, col);
+		}
+	}
+
+	return MatrixStatusOK;
+}
@@ -0,0 +1,68 @@
+/**
+ * @Date:   2026-10-19T09:41:17+08:00
+ * @Last modified time: 2026-10-19T13:20:31+08:00
+ */
+#ifndef MATRIX_F32_INSTRUMENT_H_
+#define MATRIX_F32_INSTRUMENT_H_
+
+#include "include/matrix_f32_stats.h"
+
+#ifdef MATRIX_F32_ENABLE_STATS
+
+#include "util/cycle_counter.h"
+
+void m_matrixf32StatsRecord(MatrixF32Op t_op, uint64_t t_cycles, uint64_t t_flops, uint64_t t_bytes);
+
+#define MATRIX_F32_STATS_BEGIN(op) const uint64_t probe_start_##op = cycleCounterRead()
+#define MATRIX_F32_STATS_END(op, flops, bytes) \
+	m_matrixf32StatsRecord(op, cycleCounterRead() - probe_start_##op, (uint64_t)(flops), (uint64_t)(bytes))
+
+#else
+
+#define MATRIX_F32_STATS_BEGIN(op) (void)0
+#define MATRIX_F32_STATS_END(op, flops, bytes) (void)0
+
+#endif
+
+#ifdef MATRIX_F32_ENABLE_TRACE
+
+uint64_t m_matrixf32TraceNow(void);
+void m_matrixf32TraceRecord(const char *t_name, uint64_t t_begin, uint64_t t_end);
+
+// t_name must outlive the trace buffer, i.e. a string literal
+#define MATRIX_F32_SPAN_BEGIN(span) const uint64_t span_start_##span = m_matrixf32TraceNow()
+#define MATRIX_F32_SPAN_END(span, name) m_matrixf32TraceRecord(name, span_start_##span, m_matrixf32TraceNow())
+
+#else
+
+#define MATRIX_F32_SPAN_BEGIN(span) (void)0
+#define MATRIX_F32_SPAN_END(span, name) (void)0
+
+#endif
+
+#ifdef MATRIX_F32_ENABLE_MEM_STATS
+
+void m_matrixf32MemTrack(MatrixF32Ptr t_mat, MatrixF32Op t_op, size_t t_bytes);
+void m_matrixf32MemUntrack(MatrixF32Ptr t_mat);
+
+#define MATRIX_F32_MEM_TRACK(mat, op, bytes) m_matrixf32MemTrack(mat, op, bytes)
+#define MATRIX_F32_MEM_UNTRACK(mat) m_matrixf32MemUntrack(mat)
+
+#else
+
+#define MATRIX_F32_MEM_TRACK(mat, op, bytes) (void)(op)
+#define MATRIX_F32_MEM_UNTRACK(mat) (void)0
+
+#endif
+
+// public entry points feed both the counters and the trace, internal phases only the trace
+#define MATRIX_F32_PROBE_BEGIN(op) \
+	MATRIX_F32_STATS_BEGIN(op);    \
+	MATRIX_F32_SPAN_BEGIN(op)
+#define MATRIX_F32_PROBE_END(op, flops, bytes)        \
+	do {                                              \
+		MATRIX_F32_STATS_END(op, flops, bytes);       \
+		MATRIX_F32_SPAN_END(op, matrixf32OpName(op)); \
+	} while (0)
+
+#endif	// MATRIX_F32_INSTRUMENT_H_
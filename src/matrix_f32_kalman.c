@@ -0,0 +1,286 @@
+/**
+ * @Date:   2026-10-19T19:48:51+08:00
+ * @Last modified time: 2026-10-19T19:48:51+08:00
+ */
+
+#include "include/matrix_f32_kalman.h"
+#include "src/matrix_f32_private.h"
+
+#include <string.h>
+
+struct MatrixF32Kalman {
+	size_t m_n;
+	size_t m_m;
+	bool m_joseph;
+
+	MatrixF32Ptr m_state;		// n x 1
+	MatrixF32Ptr m_covariance;	// n x n
+
+	// one block for all workspace
+	float *m_workspace;
+	float *m_hp;		  // H P, m x n
+	float *m_kt;		  // K^T, m x n
+	float *m_s;			  // S and its Cholesky factor, m x m
+	float *m_innovation;  // m
+	float *m_product;	  // F P or (I - KH) P, n x n
+	float *m_gainFactor;  // I - KH, n x n
+	float *m_kr;		  // K R, n x m
+	float *m_vector;	  // n
+};
+
+// private function
+/**
+ *	t_out = t_ap * A^T + t_add for t_ap = A P with P symmetric, rows x rows. Only the upper triangle is computed and
+ *	mirrored, so the result is exactly symmetric. t_add may be NULL.
+ */
+static void m_matrixf32KalmanSandwich(float *t_out, const float *t_ap, const float *t_a, size_t t_rows, size_t t_inner,
+									  const float *t_add) {
+	for (size_t i = 0; i < t_rows; ++i) {
+		const float *ap_row = t_ap + i * t_inner;
+
+		for (size_t j = i; j < t_rows; ++j) {
+			const float *a_row = t_a + j * t_inner;
+			float sum = t_add != 0 ? t_add[i * t_rows + j] : 0.0f;
+
+			for (size_t k = 0; k < t_inner; ++k) {
+				sum += ap_row[k] * a_row[k];
+			}
+
+			t_out[i * t_rows + j] = sum;
+			t_out[j * t_rows + i] = sum;
+		}
+	}
+}
+
+MatrixF32KalmanPtr matrixf32KalmanCreate(size_t t_n, size_t t_m) {
+	if (t_n == 0 || t_m == 0) return 0;
+
+	MatrixF32KalmanPtr kalman = MATRIX_F32_MALLOC(sizeof(struct MatrixF32Kalman));
+	if (kalman == 0) return 0;
+
+	const size_t workspace = 3 * t_m * t_n + t_m * t_m + t_m + 2 * t_n * t_n + t_n;
+
+	kalman->m_n = t_n;
+	kalman->m_m = t_m;
+	kalman->m_joseph = false;
+	kalman->m_state = m_matrixf32CreateFor((MatrixDimType){t_n, 1}, MatrixF32OpCreate);
+	kalman->m_covariance = m_matrixf32CreateFor((MatrixDimType){t_n, t_n}, MatrixF32OpCreate);
+	kalman->m_workspace = MATRIX_F32_MALLOC(workspace * sizeof(float));
+
+	bool allocated = kalman->m_state != 0 && kalman->m_state->m_val != 0 && kalman->m_covariance != 0 &&
+					 kalman->m_covariance->m_val != 0 && kalman->m_workspace != 0;
+
+	if (!allocated) {
+		matrixf32KalmanDestroy(&kalman);
+
+		return 0;
+	}
+
+	kalman->m_hp = kalman->m_workspace;
+	kalman->m_kt = kalman->m_hp + t_m * t_n;
+	kalman->m_s = kalman->m_kt + t_m * t_n;
+	kalman->m_innovation = kalman->m_s + t_m * t_m;
+	kalman->m_product = kalman->m_innovation + t_m;
+	kalman->m_gainFactor = kalman->m_product + t_n * t_n;
+	kalman->m_kr = kalman->m_gainFactor + t_n * t_n;
+	kalman->m_vector = kalman->m_kr + t_n * t_m;
+
+	for (size_t i = 0; i < t_n; ++i) {
+		kalman->m_covariance->m_val[i * t_n + i] = 1.0f;
+	}
+
+	return kalman;
+}
+
+MatrixStatus matrixf32KalmanDestroy(MatrixF32KalmanPtr *t_kalman) {
+	if (t_kalman == 0) return MatrixStatusErrNullPtr;
+
+	if (*t_kalman != 0) {
+		matrixf32Destroy(&(*t_kalman)->m_state);
+		matrixf32Destroy(&(*t_kalman)->m_covariance);
+		MATRIX_F32_FREE((*t_kalman)->m_workspace);
+	}
+
+	MATRIX_F32_FREE(*t_kalman);
+	*t_kalman = 0;
+
+	return MatrixStatusOK;
+}
+
+MatrixF32Ptr matrixf32KalmanGetState(MatrixF32KalmanPtr t_kalman) { return t_kalman == 0 ? 0 : t_kalman->m_state; }
+
+MatrixF32Ptr matrixf32KalmanGetCovariance(MatrixF32KalmanPtr t_kalman) {
+	return t_kalman == 0 ? 0 : t_kalman->m_covariance;
+}
+
+MatrixStatus matrixf32KalmanSetJoseph(MatrixF32KalmanPtr t_kalman, bool t_joseph) {
+	if (t_kalman == 0) return MatrixStatusErrNullPtr;
+
+	t_kalman->m_joseph = t_joseph;
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32KalmanPredict(MatrixF32KalmanPtr t_kalman, const MatrixF32Ptr t_jacobian,
+									const MatrixF32Ptr t_noise, const MatrixF32Ptr t_state) {
+	if (t_kalman == 0 || t_jacobian == 0 || t_noise == 0) return MatrixStatusErrNullPtr;
+	if (t_jacobian->m_val == 0 || t_noise->m_val == 0 || (t_state != 0 && t_state->m_val == 0)) {
+		return MatrixStatusErrNullPtr;
+	}
+
+	const size_t n = t_kalman->m_n;
+	bool dim_not_matched = t_jacobian->m_row != n || t_jacobian->m_col != n || t_noise->m_row != n ||
+						   t_noise->m_col != n || (t_state != 0 && (t_state->m_row != n || t_state->m_col != 1));
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+	bool row_major = m_matrixf32RowMajorBuffer(t_jacobian) && m_matrixf32RowMajorBuffer(t_noise) &&
+					 m_matrixf32RowMajorBuffer(t_state);
+	if (!row_major) return MatrixStatusErrLayout;
+
+	const float *f = t_jacobian->m_val;
+	float *x = t_kalman->m_state->m_val;
+	float *p = t_kalman->m_covariance->m_val;
+
+	m_matrixf32Touch(t_kalman->m_state);
+	m_matrixf32Touch(t_kalman->m_covariance);
+
+	if (t_state != 0) {
+		memcpy(x, t_state->m_val, n * sizeof(float));
+	} else {
+		m_matrixf32GemmKernel(n, 1, n, 1.0f, f, n, x, 1, false, t_kalman->m_vector, 1);
+		memcpy(x, t_kalman->m_vector, n * sizeof(float));
+	}
+
+	// P = (F P) F^T + Q
+	m_matrixf32GemmKernel(n, n, n, 1.0f, f, n, p, n, false, t_kalman->m_product, n);
+	m_matrixf32KalmanSandwich(p, t_kalman->m_product, f, n, n, t_noise->m_val);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32KalmanUpdate(MatrixF32KalmanPtr t_kalman, const MatrixF32Ptr t_measurement,
+								   const MatrixF32Ptr t_jacobian, const MatrixF32Ptr t_noise,
+								   const MatrixF32Ptr t_predicted) {
+	if (t_kalman == 0 || t_measurement == 0 || t_jacobian == 0 || t_noise == 0) return MatrixStatusErrNullPtr;
+	if (t_measurement->m_val == 0 || t_jacobian->m_val == 0 || t_noise->m_val == 0 ||
+		(t_predicted != 0 && t_predicted->m_val == 0)) {
+		return MatrixStatusErrNullPtr;
+	}
+
+	const size_t n = t_kalman->m_n;
+	const size_t m = t_kalman->m_m;
+	bool dim_not_matched = t_measurement->m_row != m || t_measurement->m_col != 1 || t_jacobian->m_row != m ||
+						   t_jacobian->m_col != n || t_noise->m_row != m || t_noise->m_col != m ||
+						   (t_predicted != 0 && (t_predicted->m_row != m || t_predicted->m_col != 1));
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+	bool row_major = m_matrixf32RowMajorBuffer(t_measurement) && m_matrixf32RowMajorBuffer(t_jacobian) &&
+					 m_matrixf32RowMajorBuffer(t_noise) && m_matrixf32RowMajorBuffer(t_predicted);
+	if (!row_major) return MatrixStatusErrLayout;
+
+	const float *h = t_jacobian->m_val;
+	const float *r = t_noise->m_val;
+	float *x = t_kalman->m_state->m_val;
+	float *p = t_kalman->m_covariance->m_val;
+	float *hp = t_kalman->m_hp;
+	float *kt = t_kalman->m_kt;
+	float *s = t_kalman->m_s;
+	float *y = t_kalman->m_innovation;
+
+	// y = z - h(x)
+	if (t_predicted != 0) {
+		memcpy(y, t_predicted->m_val, m * sizeof(float));
+	} else {
+		m_matrixf32GemmKernel(m, 1, n, 1.0f, h, n, x, 1, false, y, 1);
+	}
+
+	for (size_t i = 0; i < m; ++i) {
+		y[i] = t_measurement->m_val[i] - y[i];
+	}
+
+	// S = (H P) H^T + R = L L^T
+	m_matrixf32GemmKernel(m, n, n, 1.0f, h, n, p, n, false, hp, n);
+	m_matrixf32KalmanSandwich(s, hp, h, m, n, r);
+	if (!m_matrixf32CholeskyKernel(s, m, m)) return MatrixStatusErrSingular;
+
+	m_matrixf32Touch(t_kalman->m_state);
+	m_matrixf32Touch(t_kalman->m_covariance);
+
+	// K^T = S^-1 (H P), as P is symmetric (H P)^T = P H^T
+	memcpy(kt, hp, m * n * sizeof(float));
+	m_matrixf32CholeskySolveKernel(s, m, m, kt, n, n);
+
+	// x = x + K y
+	for (size_t k = 0; k < m; ++k) {
+		const float *kt_row = kt + k * n;
+
+		for (size_t i = 0; i < n; ++i) {
+			x[i] += kt_row[i] * y[k];
+		}
+	}
+
+	if (!t_kalman->m_joseph) {
+		// P = P - K (H P), symmetric
+		for (size_t i = 0; i < n; ++i) {
+			for (size_t j = i; j < n; ++j) {
+				float sum = p[i * n + j];
+
+				for (size_t k = 0; k < m; ++k) {
+					sum -= kt[k * n + i] * hp[k * n + j];
+				}
+
+				p[i * n + j] = sum;
+				p[j * n + i] = sum;
+			}
+		}
+
+		return MatrixStatusOK;
+	}
+
+	// A = I - K H
+	float *a = t_kalman->m_gainFactor;
+
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t j = 0; j < n; ++j) {
+			float sum = i == j ? 1.0f : 0.0f;
+
+			for (size_t k = 0; k < m; ++k) {
+				sum -= kt[k * n + i] * h[k * n + j];
+			}
+
+			a[i * n + j] = sum;
+		}
+	}
+
+	// K R, n x m
+	float *kr = t_kalman->m_kr;
+
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t c = 0; c < m; ++c) {
+			float sum = 0.0f;
+
+			for (size_t k = 0; k < m; ++k) {
+				sum += kt[k * n + i] * r[k * m + c];
+			}
+
+			kr[i * m + c] = sum;
+		}
+	}
+
+	// P = (A P) A^T + (K R) K^T
+	m_matrixf32GemmKernel(n, n, n, 1.0f, a, n, p, n, false, t_kalman->m_product, n);
+	m_matrixf32KalmanSandwich(p, t_kalman->m_product, a, n, n, 0);
+
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t j = i; j < n; ++j) {
+			float sum = 0.0f;
+
+			for (size_t k = 0; k < m; ++k) {
+				sum += kr[i * m + k] * kt[k * n + j];
+			}
+
+			p[i * n + j] += sum;
+			if (j != i) p[j * n + i] = p[i * n + j];
+		}
+	}
+
+	return MatrixStatusOK;
+}
@@ -0,0 +1,136 @@
+/**
+ * @Date:   2026-10-19T13:20:31+08:00
+ * @Last modified time: 2026-10-19T13:20:31+08:00
+ */
+
+#include "include/matrix_f32_memstats.h"
+#include "src/matrix_f32_instrument.h"
+#include "src/matrix_f32_private.h"
+
+#include <string.h>
+
+#ifdef MATRIX_F32_ENABLE_MEM_STATS
+
+#include <stdatomic.h>
+
+static MatrixF32MemStatsType stats;
+static uint32_t next_alloc_id = 0;
+
+// intrusive list of live matrices, oldest at the head
+static struct MatrixF32 *live_head = 0;
+static struct MatrixF32 *live_tail = 0;
+
+static atomic_flag lock = ATOMIC_FLAG_INIT;
+
+static inline void m_matrixf32MemLock(void) {
+	while (atomic_flag_test_and_set_explicit(&lock, memory_order_acquire)) {
+	}
+}
+
+static inline void m_matrixf32MemUnlock(void) { atomic_flag_clear_explicit(&lock, memory_order_release); }
+
+void m_matrixf32MemTrack(MatrixF32Ptr t_mat, MatrixF32Op t_op, size_t t_bytes) {
+	m_matrixf32MemLock();
+
+	t_mat->m_createdBy = t_op;
+	t_mat->m_allocBytes = t_bytes;
+	t_mat->m_allocId = next_alloc_id++;
+
+	t_mat->m_prevLive = live_tail;
+	t_mat->m_nextLive = 0;
+	if (live_tail != 0) {
+		live_tail->m_nextLive = t_mat;
+	} else {
+		live_head = t_mat;
+	}
+	live_tail = t_mat;
+
+	stats.m_liveMatrices++;
+	stats.m_liveBytes += t_bytes;
+	if (stats.m_liveBytes > stats.m_peakBytes) stats.m_peakBytes = stats.m_liveBytes;
+
+	stats.m_allocCount[t_op]++;
+	stats.m_allocBytes[t_op] += t_bytes;
+
+	m_matrixf32MemUnlock();
+}
+
+void m_matrixf32MemUntrack(MatrixF32Ptr t_mat) {
+	m_matrixf32MemLock();
+
+	if (t_mat->m_prevLive != 0) {
+		t_mat->m_prevLive->m_nextLive = t_mat->m_nextLive;
+	} else {
+		live_head = t_mat->m_nextLive;
+	}
+
+	if (t_mat->m_nextLive != 0) {
+		t_mat->m_nextLive->m_prevLive = t_mat->m_prevLive;
+	} else {
+		live_tail = t_mat->m_prevLive;
+	}
+
+	stats.m_liveMatrices--;
+	stats.m_liveBytes -= t_mat->m_allocBytes;
+
+	m_matrixf32MemUnlock();
+}
+
+MatrixStatus matrixf32MemStatsSnapshot(MatrixF32MemStatsType *t_snapshot) {
+	if (t_snapshot == 0) return MatrixStatusErrNullPtr;
+
+	m_matrixf32MemLock();
+	memcpy(t_snapshot, &stats, sizeof(stats));
+	m_matrixf32MemUnlock();
+
+	return MatrixStatusOK;
+}
+
+void matrixf32MemStatsReset(void) {
+	m_matrixf32MemLock();
+
+	memset(stats.m_allocCount, 0, sizeof(stats.m_allocCount));
+	memset(stats.m_allocBytes, 0, sizeof(stats.m_allocBytes));
+	stats.m_peakBytes = stats.m_liveBytes;
+
+	m_matrixf32MemUnlock();
+}
+
+size_t matrixf32MemReportLeaks(MatrixF32LeakCallback t_callback, void *t_context) {
+	m_matrixf32MemLock();
+
+	if (t_callback != 0) {
+		for (struct MatrixF32 *mat = live_head; mat != 0; mat = mat->m_nextLive) {
+			MatrixF32LeakInfoType leak = {mat, {mat->m_row, mat->m_col}, mat->m_allocBytes, mat->m_createdBy,
+										  mat->m_allocId};
+			t_callback(&leak, t_context);
+		}
+	}
+
+	size_t live_matrices = stats.m_liveMatrices;
+
+	m_matrixf32MemUnlock();
+
+	return live_matrices;
+}
+
+#else
+
+MatrixStatus matrixf32MemStatsSnapshot(MatrixF32MemStatsType *t_snapshot) {
+	if (t_snapshot == 0) return MatrixStatusErrNullPtr;
+
+	memset(t_snapshot, 0, sizeof(*t_snapshot));
+
+	return MatrixStatusOK;
+}
+
+void matrixf32MemStatsReset(void) {}
+
+size_t matrixf32MemReportLeaks(MatrixF32LeakCallback t_callback, void *t_context) {
+	(void)t_callback;
+	(void)t_context;
+
+	return 0;
+}
+
+#endif
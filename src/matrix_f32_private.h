@@ -0,0 +1,212 @@
+/**
+ * @Date:   2026-10-19T13:20:31+08:00
+ * @Last modified time: 2026-10-19T13:20:31+08:00
+ */
+#ifndef MATRIX_F32_PRIVATE_H_
+#define MATRIX_F32_PRIVATE_H_
+
+#include "include/matrix_f32.h"
+#include "include/matrix_f32_stats.h"
+
+// allows the library to allocate from an RTOS heap, e.g. -DMATRIX_F32_MALLOC=pvPortMalloc -DMATRIX_F32_FREE=vPortFree
+#ifndef MATRIX_F32_MALLOC
+#include <stdlib.h>
+#define MATRIX_F32_MALLOC malloc
+#define MATRIX_F32_FREE free
+#endif
+
+#ifndef MATRIX_F32_GEMM_BLOCK_K
+#define MATRIX_F32_GEMM_BLOCK_K 128
+#endif
+
+#ifndef MATRIX_F32_GEMM_BLOCK_N
+#define MATRIX_F32_GEMM_BLOCK_N 256
+#endif
+
+// opt-in factorization attached to a square matrix, valid while the version of the matrix is unchanged
+struct MatrixF32FactorCache {
+	struct MatrixF32 *m_lu;
+	struct MatrixF32 *m_permutation;
+	struct MatrixF32 *m_inverse;  // created by the first matrixf32Inverse
+
+	uint32_t m_luVersion;
+	uint32_t m_inverseVersion;
+	MatrixStatus m_luStatus;
+	bool m_luValid;
+	bool m_inverseValid;
+};
+
+struct MatrixF32 {
+	size_t m_row;
+	size_t m_col;
+
+	float *m_val;
+	AddrOwnerShip m_addrOwnerShip;
+	MatrixLayout m_layout;
+
+	uint32_t m_version;
+	struct MatrixF32FactorCache *m_cache;
+
+#ifdef MATRIX_F32_ENABLE_MEM_STATS
+	struct MatrixF32 *m_prevLive;
+	struct MatrixF32 *m_nextLive;
+
+	MatrixF32Op m_createdBy;
+	size_t m_allocBytes;
+	uint32_t m_allocId;
+#endif
+};
+
+/**
+ * @brief  Marks the content of t_dest as changed, every function writing to a matrix calls it on success
+ */
+static inline void m_matrixf32Touch(struct MatrixF32 *t_dest) { ++t_dest->m_version; }
+
+/**
+ * @brief  Distance in floats between two rows, likewise m_matrixf32ColStride between two columns, of the buffer
+ */
+static inline size_t m_matrixf32RowStride(const struct MatrixF32 *t_mat) {
+	return t_mat->m_layout == MatrixLayoutRowMajor ? t_mat->m_col : 1;
+}
+
+static inline size_t m_matrixf32ColStride(const struct MatrixF32 *t_mat) {
+	return t_mat->m_layout == MatrixLayoutRowMajor ? 1 : t_mat->m_row;
+}
+
+/**
+ * @brief  Whether the matrix is a row or a column vector
+ */
+static inline bool m_matrixf32IsVector(const struct MatrixF32 *t_mat) { return t_mat->m_row == 1 || t_mat->m_col == 1; }
+
+/**
+ * @brief  Whether the buffer can be indexed as row-major, true for row-major matrices and for vectors, which are
+ * 				 stored the same in both layouts, and for NULL so optional operands pass. The modules outside
+ * 				 matrix_f32.c index m_val row by row and return MatrixStatusErrLayout if this is false
+ */
+static inline bool m_matrixf32RowMajorBuffer(const struct MatrixF32 *t_mat) {
+	return t_mat == 0 || t_mat->m_layout == MatrixLayoutRowMajor || m_matrixf32IsVector(t_mat);
+}
+
+/**
+ * @brief  This function does the same thing as matrixf32Create, allocations are attributed to t_op so the memory
+ * 				 telemetry can tell which entry point the temporaries belong to
+ */
+MatrixF32Ptr m_matrixf32CreateFor(MatrixDimType t_dim, MatrixF32Op t_op);
+
+/**
+ * @brief  This function wraps t_val like matrixf32CreateContainer does, without the int buffer length limit. The
+ * 				 caller is responsible for t_dim being valid and t_val being large enough
+ */
+MatrixF32Ptr m_matrixf32CreateContainerFor(MatrixDimType t_dim, float *t_val, MatrixF32Op t_op);
+
+/**
+ * @brief  General matrix multiplication kernel on raw row-major buffers, C = alpha * A * B (+ C if t_accumulate).
+ * 				 This and the LU kernels below run on the backend selected in include/matrix_f32_backend.h
+ *
+ * @param  t_m, t_n, t_k Dimension of C (m x n), A is m x k and B is k x n
+ * @param  t_lda         Distance in floats between two rows of A, likewise t_ldb and t_ldc for B and C
+ */
+void m_matrixf32GemmKernel(size_t t_m, size_t t_n, size_t t_k, float t_alpha, const float *t_a, size_t t_lda,
+						   const float *t_b, size_t t_ldb, bool t_accumulate, float *t_c, size_t t_ldc);
+
+/**
+ * @brief  Solves L * Y = P * B for all k columns at once, row by row, on the result of matrixf32InPlaceLU. The unit
+ * 				 diagonal of L is not stored. B is the identity if t_b is NULL, t_y must not be the same as t_b
+ */
+void m_matrixf32LUForwardKernel(const float *t_lu, const float *t_permutation, size_t t_n, const float *t_b,
+								size_t t_k, float *t_y);
+
+/**
+ * @brief  Solves U * X = Y in place, from the last row upwards
+ *
+ * @return false if a diagonal entry of U is too small, see matrixf32BackwardSubstitution
+ */
+bool m_matrixf32LUBackwardKernel(const float *t_lu, size_t t_n, float *t_x, size_t t_k);
+
+/**
+ * @brief  In place LU decomposition with partial pivoting of a raw row-major n x n buffer, the elimination of
+ * 				 matrixf32InPlaceLU. Rows are interchanged in full, step k swaps row k with row t_pivot[k]
+ *
+ * @return false if a column has no nonzero pivot, t_pivot is left untouched from that step on
+ */
+bool m_matrixf32LUFactorKernel(float *t_a, size_t t_n, size_t *t_pivot);
+
+/**
+ * @brief  m_matrixf32LUFactorKernel of the native backend, whichever backend is selected. The reference elimination
+ * 				 divides by the pivot plus 1e-6, so its factors are off for matrices with small entries
+ */
+bool m_matrixf32LUFactorExactKernel(float *t_a, size_t t_n, size_t *t_pivot);
+
+// kernels of a backend, see matrix_f32_backend.c. Each has the contract of the m_matrixf32...Kernel above
+typedef struct {
+	void (*m_gemm)(size_t t_m, size_t t_n, size_t t_k, float t_alpha, const float *t_a, size_t t_lda,
+				   const float *t_b, size_t t_ldb, bool t_accumulate, float *t_c, size_t t_ldc);
+	bool (*m_getrf)(float *t_a, size_t t_n, size_t *t_pivot);
+	void (*m_luForward)(const float *t_lu, const float *t_permutation, size_t t_n, const float *t_b, size_t t_k,
+						float *t_y);
+	bool (*m_luBackward)(const float *t_lu, size_t t_n, float *t_x, size_t t_k);
+} MatrixF32BackendOps;
+
+#ifdef MATRIX_F32_ENABLE_CBLAS
+extern const MatrixF32BackendOps m_matrixf32CblasOps;
+#endif
+
+// level 1 and 2 kernels on contiguous vectors, see include/matrix_f32_blas.h. Not dispatched to a backend
+float m_matrixf32DotKernel(size_t t_n, const float *t_x, const float *t_y);
+float m_matrixf32Nrm2Kernel(size_t t_n, const float *t_x);
+void m_matrixf32AxpyKernel(size_t t_n, float t_alpha, const float *t_x, float *t_y);
+
+/**
+ * @brief  sqrt(t_squares) for t_squares the sum of the squares of t_x. If the sum overflowed or underflowed it is
+ * 				 computed again with the entries scaled by the largest magnitude, see matrix_f32_reduce.c
+ */
+float m_matrixf32Norm2FromSquares(float t_squares, size_t t_n, const float *t_x);
+
+/**
+ * @brief  y = alpha * A * x + beta * y for a row-major m x n A, likewise y = alpha * A^T * x + beta * y
+ * 				 for m_matrixf32GemvTransposedKernel and A = alpha * x * y^T + A for m_matrixf32GerKernel. y is not
+ * 				 read if t_beta is 0
+ */
+void m_matrixf32GemvKernel(size_t t_m, size_t t_n, float t_alpha, const float *t_a, size_t t_lda, const float *t_x,
+						   float t_beta, float *t_y);
+void m_matrixf32GemvTransposedKernel(size_t t_m, size_t t_n, float t_alpha, const float *t_a, size_t t_lda,
+									 const float *t_x, float t_beta, float *t_y);
+void m_matrixf32GerKernel(size_t t_m, size_t t_n, float t_alpha, const float *t_x, const float *t_y, float *t_a,
+						  size_t t_lda);
+
+/**
+ * @brief  Overwrites x (length m) with v such that (I - tau v v^T) x = beta e1 and v[0] = 1, returns tau. tau is 0
+ * 				 and beta is x[0] if x is already a multiple of e1
+ */
+float m_matrixf32HouseholderKernel(float *t_x, size_t t_m, float *t_beta);
+
+/**
+ * @brief  x = (I - tau v v^T) x for x of length m. v[0] = 1 is not stored, v[i] is t_v[(i - 1) * t_incv], the
+ * 				 layout of a reflector kept below the diagonal of a row-major factor
+ */
+void m_matrixf32HouseholderApplyKernel(size_t t_m, float t_tau, const float *t_v, size_t t_incv, float *t_x);
+
+/**
+ * @brief  In place Cholesky decomposition of a raw row-major n x n buffer, see matrixf32Cholesky
+ *
+ * @return false if the matrix is not positive definite
+ */
+bool m_matrixf32CholeskyKernel(float *t_a, size_t t_n, size_t t_lda);
+
+/**
+ * @brief  Solves L * L^T * X = B in place on raw row-major buffers, B is n x k
+ */
+void m_matrixf32CholeskySolveKernel(const float *t_l, size_t t_n, size_t t_ldl, float *t_b, size_t t_k,
+									size_t t_ldb);
+
+// binary matrix file helpers, see matrix_f32_file.c
+struct MatrixF32FileHeader;
+
+extern const char m_matrixf32FileMagic[4];
+bool m_matrixf32FileHostIsLittleEndian(void);
+bool m_matrixf32FileHeaderValid(const struct MatrixF32FileHeader *t_header, uint64_t t_file_size);
+
+// checksum of a payload split into several chunks: feed the result of the previous chunk as seed, start with 0
+uint64_t m_matrixf32FileChecksum(uint64_t t_seed, const float *t_val, size_t t_count);
+
+#endif	// MATRIX_F32_PRIVATE_H_
@@ -0,0 +1,468 @@
+/**
+ * @Date:   2026-10-19T21:12:40+08:00
+ * @Last modified time: 2026-10-19T21:12:40+08:00
+ */
+
+#include "include/matrix_f32_queue.h"
+#include "src/matrix_f32_private.h"
+
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <pthread.h>
+#define MATRIX_F32_QUEUE_HAVE_THREADS
+#endif
+
+typedef enum {
+	QueueOpCustom = 0,
+	QueueOpAdd,
+	QueueOpSubtract,
+	QueueOpMultiplication,
+	QueueOpInverse,
+	QueueOpSolve
+} QueueOpType;
+
+struct MatrixF32Future {
+	MatrixF32QueuePtr m_queue;
+
+	QueueOpType m_op;
+	MatrixF32Ptr m_result;
+	MatrixF32Ptr m_a;
+	MatrixF32Ptr m_b;
+	MatrixStatus (*m_function)(void *);
+	void *m_argument;
+
+	// futures to complete first, released once they are
+	struct MatrixF32Future **m_dep;
+	size_t m_depCount;
+
+	MatrixStatus m_status;
+	bool m_done;
+	unsigned m_reference;  // the handle, the queue until complete, and every waiting dependent
+
+	void (*m_callback)(void *, MatrixStatus);
+	void *m_context;
+
+	struct MatrixF32Future *m_next;	 // in the waiting or the ready list
+};
+
+struct MatrixF32Queue {
+#ifdef MATRIX_F32_QUEUE_HAVE_THREADS
+	pthread_mutex_t m_mutex;
+	pthread_cond_t m_wake;	// workers, a future is ready or the queue stops
+	pthread_cond_t m_done;	// waiters, a future is complete
+	pthread_t *m_worker;
+	size_t m_workerCount;
+#endif
+
+	struct MatrixF32Future *m_waiting;
+	struct MatrixF32Future *m_readyHead;
+	struct MatrixF32Future *m_readyTail;
+
+	size_t m_inFlight;	// submitted and not complete, callbacks included
+	bool m_stop;
+};
+
+// private function
+#ifdef MATRIX_F32_QUEUE_HAVE_THREADS
+static inline void m_matrixf32QueueLock(MatrixF32QueuePtr t_queue) { pthread_mutex_lock(&t_queue->m_mutex); }
+static inline void m_matrixf32QueueUnlock(MatrixF32QueuePtr t_queue) { pthread_mutex_unlock(&t_queue->m_mutex); }
+static inline void m_matrixf32QueueWake(MatrixF32QueuePtr t_queue) { pthread_cond_broadcast(&t_queue->m_wake); }
+static inline void m_matrixf32QueueSignalDone(MatrixF32QueuePtr t_queue) { pthread_cond_broadcast(&t_queue->m_done); }
+static inline void m_matrixf32QueueWaitDone(MatrixF32QueuePtr t_queue) {
+	pthread_cond_wait(&t_queue->m_done, &t_queue->m_mutex);
+}
+#else
+// operations run on the submitting thread, nothing is ever waited for
+static inline void m_matrixf32QueueLock(MatrixF32QueuePtr t_queue) { (void)t_queue; }
+static inline void m_matrixf32QueueUnlock(MatrixF32QueuePtr t_queue) { (void)t_queue; }
+static inline void m_matrixf32QueueWake(MatrixF32QueuePtr t_queue) { (void)t_queue; }
+static inline void m_matrixf32QueueSignalDone(MatrixF32QueuePtr t_queue) { (void)t_queue; }
+static inline void m_matrixf32QueueWaitDone(MatrixF32QueuePtr t_queue) { (void)t_queue; }
+#endif
+
+// called with the lock held
+static void m_matrixf32FutureUnref(struct MatrixF32Future *t_future) {
+	if (--t_future->m_reference != 0) return;
+
+	MATRIX_F32_FREE(t_future->m_dep);
+	MATRIX_F32_FREE(t_future);
+}
+
+// moves the waiting futures whose dependencies are complete to the ready list, called with the lock held
+static void m_matrixf32QueueResolve(MatrixF32QueuePtr t_queue) {
+	struct MatrixF32Future **link = &t_queue->m_waiting;
+
+	while (*link != 0) {
+		struct MatrixF32Future *future = *link;
+		bool ready = true;
+
+		for (size_t i = 0; i < future->m_depCount && ready; ++i) {
+			ready = future->m_dep[i]->m_done;
+		}
+
+		if (!ready) {
+			link = &future->m_next;
+			continue;
+		}
+
+		for (size_t i = 0; i < future->m_depCount; ++i) {
+			if (future->m_status == MatrixStatusOK) future->m_status = future->m_dep[i]->m_status;
+			m_matrixf32FutureUnref(future->m_dep[i]);
+		}
+
+		MATRIX_F32_FREE(future->m_dep);
+		future->m_dep = 0;
+		future->m_depCount = 0;
+
+		*link = future->m_next;
+		future->m_next = 0;
+
+		if (t_queue->m_readyTail != 0) {
+			t_queue->m_readyTail->m_next = future;
+		} else {
+			t_queue->m_readyHead = future;
+		}
+
+		t_queue->m_readyTail = future;
+	}
+}
+
+static MatrixStatus m_matrixf32FutureRun(struct MatrixF32Future *t_future) {
+	switch (t_future->m_op) {
+		case QueueOpCustom:
+			return t_future->m_function(t_future->m_argument);
+		case QueueOpAdd:
+			return matrixf32Add(t_future->m_result, t_future->m_a, t_future->m_b);
+		case QueueOpSubtract:
+			return matrixf32Subtract(t_future->m_result, t_future->m_a, t_future->m_b);
+		case QueueOpMultiplication:
+			return matrixf32Multiplication(t_future->m_result, t_future->m_a, t_future->m_b);
+		case QueueOpInverse:
+			return matrixf32Inverse(t_future->m_result, t_future->m_a);
+		case QueueOpSolve:
+			return matrixf32Solve(t_future->m_result, t_future->m_a, t_future->m_b);
+	}
+
+	return MatrixStatusErrUnknownOpt;
+}
+
+// pops and runs one ready future, called with the lock held, which is released while the operation runs
+static void m_matrixf32QueueExecute(MatrixF32QueuePtr t_queue) {
+	struct MatrixF32Future *future = t_queue->m_readyHead;
+
+	t_queue->m_readyHead = future->m_next;
+	if (t_queue->m_readyHead == 0) t_queue->m_readyTail = 0;
+	future->m_next = 0;
+
+	m_matrixf32QueueUnlock(t_queue);
+
+	// a failed dependency has set the status already
+	MatrixStatus status = future->m_status == MatrixStatusOK ? m_matrixf32FutureRun(future) : future->m_status;
+
+	m_matrixf32QueueLock(t_queue);
+
+	future->m_status = status;
+	future->m_done = true;
+
+	void (*callback)(void *, MatrixStatus) = future->m_callback;
+	void *context = future->m_context;
+
+	m_matrixf32QueueResolve(t_queue);
+	m_matrixf32QueueWake(t_queue);
+	m_matrixf32QueueSignalDone(t_queue);
+
+	if (callback != 0) {
+		m_matrixf32QueueUnlock(t_queue);
+		callback(context, status);
+		m_matrixf32QueueLock(t_queue);
+	}
+
+	--t_queue->m_inFlight;
+	m_matrixf32FutureUnref(future);
+	m_matrixf32QueueSignalDone(t_queue);
+}
+
+#ifdef MATRIX_F32_QUEUE_HAVE_THREADS
+static void *m_matrixf32QueueWorker(void *t_queue) {
+	MatrixF32QueuePtr queue = t_queue;
+
+	m_matrixf32QueueLock(queue);
+
+	while (true) {
+		while (queue->m_readyHead == 0 && !queue->m_stop) {
+			pthread_cond_wait(&queue->m_wake, &queue->m_mutex);
+		}
+
+		if (queue->m_readyHead == 0) break;
+
+		m_matrixf32QueueExecute(queue);
+	}
+
+	m_matrixf32QueueUnlock(queue);
+
+	return 0;
+}
+#endif
+
+static MatrixF32FuturePtr m_matrixf32QueueEnqueue(MatrixF32QueuePtr t_queue, struct MatrixF32Future t_task,
+												  const MatrixF32FuturePtr *t_deps, size_t t_dep_count) {
+	if (t_queue == 0 || (t_deps == 0 && t_dep_count != 0)) return 0;
+
+	for (size_t i = 0; i < t_dep_count; ++i) {
+		if (t_deps[i] == 0 || t_deps[i]->m_queue != t_queue) return 0;
+	}
+
+	MatrixF32FuturePtr future = MATRIX_F32_MALLOC(sizeof(struct MatrixF32Future));
+	if (future == 0) return 0;
+
+	*future = t_task;
+	future->m_queue = t_queue;
+	future->m_dep = 0;
+	future->m_depCount = t_dep_count;
+	future->m_status = MatrixStatusOK;
+	future->m_done = false;
+	future->m_reference = 2;
+	future->m_callback = 0;
+	future->m_context = 0;
+
+	if (t_dep_count != 0) {
+		future->m_dep = MATRIX_F32_MALLOC(t_dep_count * sizeof(struct MatrixF32Future *));
+
+		if (future->m_dep == 0) {
+			MATRIX_F32_FREE(future);
+
+			return 0;
+		}
+
+		memcpy(future->m_dep, t_deps, t_dep_count * sizeof(struct MatrixF32Future *));
+	}
+
+	m_matrixf32QueueLock(t_queue);
+
+	for (size_t i = 0; i < t_dep_count; ++i) {
+		++future->m_dep[i]->m_reference;
+	}
+
+	++t_queue->m_inFlight;
+	future->m_next = t_queue->m_waiting;
+	t_queue->m_waiting = future;
+
+	m_matrixf32QueueResolve(t_queue);
+
+#ifdef MATRIX_F32_QUEUE_HAVE_THREADS
+	m_matrixf32QueueWake(t_queue);
+#else
+	while (t_queue->m_readyHead != 0) {
+		m_matrixf32QueueExecute(t_queue);
+	}
+#endif
+
+	m_matrixf32QueueUnlock(t_queue);
+
+	return future;
+}
+
+static MatrixF32FuturePtr m_matrixf32QueueOp(MatrixF32QueuePtr t_queue, QueueOpType t_op, const MatrixF32Ptr t_result,
+											 const MatrixF32Ptr t_a, const MatrixF32Ptr t_b,
+											 const MatrixF32FuturePtr *t_deps, size_t t_dep_count) {
+	struct MatrixF32Future task = {0};
+
+	task.m_op = t_op;
+	task.m_result = t_result;
+	task.m_a = t_a;
+	task.m_b = t_b;
+
+	return m_matrixf32QueueEnqueue(t_queue, task, t_deps, t_dep_count);
+}
+
+MatrixF32QueuePtr matrixf32QueueCreate(size_t t_workers) {
+	if (t_workers == 0) return 0;
+
+	MatrixF32QueuePtr queue = MATRIX_F32_MALLOC(sizeof(struct MatrixF32Queue));
+	if (queue == 0) return 0;
+
+	memset(queue, 0, sizeof(struct MatrixF32Queue));
+
+#ifdef MATRIX_F32_QUEUE_HAVE_THREADS
+	queue->m_worker = MATRIX_F32_MALLOC(t_workers * sizeof(pthread_t));
+
+	if (queue->m_worker == 0) {
+		MATRIX_F32_FREE(queue);
+
+		return 0;
+	}
+
+	pthread_mutex_init(&queue->m_mutex, 0);
+	pthread_cond_init(&queue->m_wake, 0);
+	pthread_cond_init(&queue->m_done, 0);
+
+	for (; queue->m_workerCount < t_workers; ++queue->m_workerCount) {
+		if (pthread_create(&queue->m_worker[queue->m_workerCount], 0, m_matrixf32QueueWorker, queue) != 0) break;
+	}
+
+	if (queue->m_workerCount == 0) {
+		matrixf32QueueDestroy(&queue);
+	}
+#endif
+
+	return queue;
+}
+
+MatrixStatus matrixf32QueueDestroy(MatrixF32QueuePtr *t_queue) {
+	if (t_queue == 0) return MatrixStatusErrNullPtr;
+
+	if (*t_queue != 0) {
+		MatrixF32QueuePtr queue = *t_queue;
+
+		matrixf32QueueFinish(queue);
+
+#ifdef MATRIX_F32_QUEUE_HAVE_THREADS
+		m_matrixf32QueueLock(queue);
+		queue->m_stop = true;
+		m_matrixf32QueueWake(queue);
+		m_matrixf32QueueUnlock(queue);
+
+		for (size_t i = 0; i < queue->m_workerCount; ++i) {
+			pthread_join(queue->m_worker[i], 0);
+		}
+
+		pthread_cond_destroy(&queue->m_wake);
+		pthread_cond_destroy(&queue->m_done);
+		pthread_mutex_destroy(&queue->m_mutex);
+		MATRIX_F32_FREE(queue->m_worker);
+#endif
+	}
+
+	MATRIX_F32_FREE(*t_queue);
+	*t_queue = 0;
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32QueueFinish(MatrixF32QueuePtr t_queue) {
+	if (t_queue == 0) return MatrixStatusErrNullPtr;
+
+	m_matrixf32QueueLock(t_queue);
+
+	while (t_queue->m_inFlight != 0) {
+		m_matrixf32QueueWaitDone(t_queue);
+	}
+
+	m_matrixf32QueueUnlock(t_queue);
+
+	return MatrixStatusOK;
+}
+
+MatrixF32FuturePtr matrixf32QueueSubmit(MatrixF32QueuePtr t_queue, MatrixStatus (*t_function)(void *),
+										void *t_argument, const MatrixF32FuturePtr *t_deps, size_t t_dep_count) {
+	if (t_function == 0) return 0;
+
+	struct MatrixF32Future task = {0};
+
+	task.m_op = QueueOpCustom;
+	task.m_function = t_function;
+	task.m_argument = t_argument;
+
+	return m_matrixf32QueueEnqueue(t_queue, task, t_deps, t_dep_count);
+}
+
+MatrixF32FuturePtr matrixf32QueueAdd(MatrixF32QueuePtr t_queue, const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_b,
+									 const MatrixF32Ptr t_mat_c, const MatrixF32FuturePtr *t_deps, size_t t_dep_count) {
+	return m_matrixf32QueueOp(t_queue, QueueOpAdd, t_result, t_mat_b, t_mat_c, t_deps, t_dep_count);
+}
+
+MatrixF32FuturePtr matrixf32QueueSubtract(MatrixF32QueuePtr t_queue, const MatrixF32Ptr t_result,
+										  const MatrixF32Ptr t_mat_b, const MatrixF32Ptr t_mat_c,
+										  const MatrixF32FuturePtr *t_deps, size_t t_dep_count) {
+	return m_matrixf32QueueOp(t_queue, QueueOpSubtract, t_result, t_mat_b, t_mat_c, t_deps, t_dep_count);
+}
+
+MatrixF32FuturePtr matrixf32QueueMultiplication(MatrixF32QueuePtr t_queue, const MatrixF32Ptr t_result,
+												const MatrixF32Ptr t_mat_b, const MatrixF32Ptr t_mat_c,
+												const MatrixF32FuturePtr *t_deps, size_t t_dep_count) {
+	return m_matrixf32QueueOp(t_queue, QueueOpMultiplication, t_result, t_mat_b, t_mat_c, t_deps, t_dep_count);
+}
+
+MatrixF32FuturePtr matrixf32QueueInverse(MatrixF32QueuePtr t_queue, const MatrixF32Ptr t_result,
+										 const MatrixF32Ptr t_source, const MatrixF32FuturePtr *t_deps,
+										 size_t t_dep_count) {
+	return m_matrixf32QueueOp(t_queue, QueueOpInverse, t_result, t_source, 0, t_deps, t_dep_count);
+}
+
+MatrixF32FuturePtr matrixf32QueueSolve(MatrixF32QueuePtr t_queue, const MatrixF32Ptr t_result,
+									   const MatrixF32Ptr t_mat_a, const MatrixF32Ptr t_column,
+									   const MatrixF32FuturePtr *t_deps, size_t t_dep_count) {
+	return m_matrixf32QueueOp(t_queue, QueueOpSolve, t_result, t_mat_a, t_column, t_deps, t_dep_count);
+}
+
+bool matrixf32FutureIsReady(MatrixF32FuturePtr t_future) {
+	if (t_future == 0) return false;
+
+	m_matrixf32QueueLock(t_future->m_queue);
+	bool done = t_future->m_done;
+	m_matrixf32QueueUnlock(t_future->m_queue);
+
+	return done;
+}
+
+MatrixStatus matrixf32FutureWait(MatrixF32FuturePtr t_future) {
+	if (t_future == 0) return MatrixStatusErrNullPtr;
+
+	m_matrixf32QueueLock(t_future->m_queue);
+
+	while (!t_future->m_done) {
+		m_matrixf32QueueWaitDone(t_future->m_queue);
+	}
+
+	MatrixStatus status = t_future->m_status;
+	m_matrixf32QueueUnlock(t_future->m_queue);
+
+	return status;
+}
+
+MatrixStatus matrixf32FutureThen(MatrixF32FuturePtr t_future, void (*t_callback)(void *, MatrixStatus),
+								 void *t_context) {
+	if (t_future == 0 || t_callback == 0) return MatrixStatusErrNullPtr;
+
+	m_matrixf32QueueLock(t_future->m_queue);
+
+	if (t_future->m_callback != 0) {
+		m_matrixf32QueueUnlock(t_future->m_queue);
+
+		return MatrixStatusErrUnknownOpt;
+	}
+
+	if (!t_future->m_done) {
+		t_future->m_callback = t_callback;
+		t_future->m_context = t_context;
+		m_matrixf32QueueUnlock(t_future->m_queue);
+
+		return MatrixStatusOK;
+	}
+
+	// kept as a marker, a second callback is refused
+	t_future->m_callback = t_callback;
+	MatrixStatus status = t_future->m_status;
+	m_matrixf32QueueUnlock(t_future->m_queue);
+
+	t_callback(t_context, status);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32FutureRelease(MatrixF32FuturePtr *t_future) {
+	if (t_future == 0) return MatrixStatusErrNullPtr;
+
+	if (*t_future != 0) {
+		MatrixF32QueuePtr queue = (*t_future)->m_queue;
+
+		m_matrixf32QueueLock(queue);
+		m_matrixf32FutureUnref(*t_future);
+		m_matrixf32QueueUnlock(queue);
+	}
+
+	*t_future = 0;
+
+	return MatrixStatusOK;
+}
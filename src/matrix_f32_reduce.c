@@ -0,0 +1,462 @@
+/**
+ * @Date:   2026-10-20T14:52:40+08:00
+ * @Last modified time: 2026-10-20T14:52:40+08:00
+ */
+
+#include "include/matrix_f32_reduce.h"
+#include "src/matrix_f32_private.h"
+
+#include <float.h>
+#include <math.h>
+
+#if defined(__SSE__)
+#include <xmmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+// entries summed by the vector accumulators before the block sums are added pairwise
+#ifndef MATRIX_F32_REDUCE_BLOCK
+#define MATRIX_F32_REDUCE_BLOCK 256
+#endif
+
+// rows added one after the other before the partial column sums are added pairwise
+#ifndef MATRIX_F32_REDUCE_ROWS
+#define MATRIX_F32_REDUCE_ROWS 32
+#endif
+
+// columns summed side by side, one cache line
+#define MATRIX_F32_REDUCE_COLS 16
+
+// subtrees of a pairwise sum, or ranges of rows, reduced by one thread each and combined in a fixed order
+#define MATRIX_F32_REDUCE_SPLIT 16
+
+#ifndef MATRIX_F32_REDUCE_PARALLEL_MIN
+#define MATRIX_F32_REDUCE_PARALLEL_MIN 65536
+#endif
+
+typedef enum {
+	MatrixF32ReduceSum = 0,
+	MatrixF32ReduceAbsSum,
+	MatrixF32ReduceSquares,
+	MatrixF32ReduceMax,
+	MatrixF32ReduceAbsMax,
+} MatrixF32ReduceOp;
+
+// private function
+/**
+ *	Larger of two values, NaN if either is
+ */
+static inline float m_matrixf32ReduceLarger(float t_a, float t_b) { return (t_a > t_b || isnan(t_a)) ? t_a : t_b; }
+
+static inline float m_matrixf32ReduceCombine(MatrixF32ReduceOp t_op, float t_a, float t_b) {
+	return t_op >= MatrixF32ReduceMax ? m_matrixf32ReduceLarger(t_a, t_b) : t_a + t_b;
+}
+
+static float m_matrixf32ReduceSumKernel(size_t t_n, const float *t_x, bool t_absolute) {
+	size_t i = 0;
+	float sum = 0.0f;
+
+#if defined(__SSE__)
+	// clearing the sign bit takes the magnitude
+	const __m128 sign = t_absolute ? _mm_set1_ps(-0.0f) : _mm_setzero_ps();
+	__m128 acc0 = _mm_setzero_ps(), acc1 = _mm_setzero_ps();
+
+	for (; i + 8 <= t_n; i += 8) {
+		acc0 = _mm_add_ps(acc0, _mm_andnot_ps(sign, _mm_loadu_ps(t_x + i)));
+		acc1 = _mm_add_ps(acc1, _mm_andnot_ps(sign, _mm_loadu_ps(t_x + i + 4)));
+	}
+
+	float lane[4];
+	_mm_storeu_ps(lane, _mm_add_ps(acc0, acc1));
+	sum = (lane[0] + lane[1]) + (lane[2] + lane[3]);
+#elif defined(__ARM_NEON)
+	const uint32x4_t mask = vdupq_n_u32(t_absolute ? 0x7fffffffu : 0xffffffffu);
+	float32x4_t acc0 = vdupq_n_f32(0.0f), acc1 = vdupq_n_f32(0.0f);
+
+	for (; i + 8 <= t_n; i += 8) {
+		acc0 = vaddq_f32(acc0, vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(vld1q_f32(t_x + i)), mask)));
+		acc1 = vaddq_f32(acc1, vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(vld1q_f32(t_x + i + 4)), mask)));
+	}
+
+	const float32x4_t acc = vaddq_f32(acc0, acc1);
+	sum = (vgetq_lane_f32(acc, 0) + vgetq_lane_f32(acc, 1)) + (vgetq_lane_f32(acc, 2) + vgetq_lane_f32(acc, 3));
+#else
+	float acc0 = 0.0f, acc1 = 0.0f, acc2 = 0.0f, acc3 = 0.0f;
+
+	for (; i + 4 <= t_n; i += 4) {
+		acc0 += t_absolute ? fabsf(t_x[i]) : t_x[i];
+		acc1 += t_absolute ? fabsf(t_x[i + 1]) : t_x[i + 1];
+		acc2 += t_absolute ? fabsf(t_x[i + 2]) : t_x[i + 2];
+		acc3 += t_absolute ? fabsf(t_x[i + 3]) : t_x[i + 3];
+	}
+
+	sum = (acc0 + acc1) + (acc2 + acc3);
+#endif
+
+	for (; i < t_n; ++i) {
+		sum += t_absolute ? fabsf(t_x[i]) : t_x[i];
+	}
+
+	return sum;
+}
+
+static float m_matrixf32ReduceMaxKernel(size_t t_n, const float *t_x, bool t_absolute) {
+	size_t i = 0;
+	float largest = -INFINITY;
+
+#if defined(__SSE__)
+	const __m128 sign = t_absolute ? _mm_set1_ps(-0.0f) : _mm_setzero_ps();
+	__m128 max0 = _mm_set1_ps(-INFINITY), max1 = _mm_set1_ps(-INFINITY), unordered = _mm_setzero_ps();
+
+	for (; i + 8 <= t_n; i += 8) {
+		const __m128 x0 = _mm_andnot_ps(sign, _mm_loadu_ps(t_x + i));
+		const __m128 x1 = _mm_andnot_ps(sign, _mm_loadu_ps(t_x + i + 4));
+
+		// maxps does not propagate NaN, so they are recorded apart
+		max0 = _mm_max_ps(max0, x0);
+		max1 = _mm_max_ps(max1, x1);
+		unordered = _mm_or_ps(unordered, _mm_or_ps(_mm_cmpunord_ps(x0, x0), _mm_cmpunord_ps(x1, x1)));
+	}
+
+	if (_mm_movemask_ps(unordered) != 0) return NAN;
+
+	float lane[4];
+	_mm_storeu_ps(lane, _mm_max_ps(max0, max1));
+	largest = m_matrixf32ReduceLarger(m_matrixf32ReduceLarger(lane[0], lane[1]),
+									  m_matrixf32ReduceLarger(lane[2], lane[3]));
+#elif defined(__ARM_NEON)
+	const uint32x4_t mask = vdupq_n_u32(t_absolute ? 0x7fffffffu : 0xffffffffu);
+	float32x4_t max0 = vdupq_n_f32(-INFINITY), max1 = vdupq_n_f32(-INFINITY);
+
+	// vmaxq propagates NaN
+	for (; i + 8 <= t_n; i += 8) {
+		max0 = vmaxq_f32(max0, vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(vld1q_f32(t_x + i)), mask)));
+		max1 = vmaxq_f32(max1, vreinterpretq_f32_u32(vandq_u32(vreinterpretq_u32_f32(vld1q_f32(t_x + i + 4)), mask)));
+	}
+
+	const float32x4_t max = vmaxq_f32(max0, max1);
+	largest = m_matrixf32ReduceLarger(m_matrixf32ReduceLarger(vgetq_lane_f32(max, 0), vgetq_lane_f32(max, 1)),
+									  m_matrixf32ReduceLarger(vgetq_lane_f32(max, 2), vgetq_lane_f32(max, 3)));
+#else
+	float max0 = -INFINITY, max1 = -INFINITY;
+
+	for (; i + 2 <= t_n; i += 2) {
+		max0 = m_matrixf32ReduceLarger(max0, t_absolute ? fabsf(t_x[i]) : t_x[i]);
+		max1 = m_matrixf32ReduceLarger(max1, t_absolute ? fabsf(t_x[i + 1]) : t_x[i + 1]);
+	}
+
+	largest = m_matrixf32ReduceLarger(max0, max1);
+#endif
+
+	for (; i < t_n; ++i) {
+		largest = m_matrixf32ReduceLarger(largest, t_absolute ? fabsf(t_x[i]) : t_x[i]);
+	}
+
+	return largest;
+}
+
+static float m_matrixf32ReduceLeaf(MatrixF32ReduceOp t_op, float t_scale, size_t t_n, const float *t_x) {
+	float sum = 0.0f;
+
+	switch (t_op) {
+		case MatrixF32ReduceSum:
+			return m_matrixf32ReduceSumKernel(t_n, t_x, false);
+		case MatrixF32ReduceAbsSum:
+			return m_matrixf32ReduceSumKernel(t_n, t_x, true);
+		case MatrixF32ReduceSquares:
+			if (t_scale == 1.0f) return m_matrixf32DotKernel(t_n, t_x, t_x);
+
+			// only taken when the plain squares overflow or underflow
+			for (size_t i = 0; i < t_n; ++i) {
+				const float ratio = t_x[i] / t_scale;
+				sum += ratio * ratio;
+			}
+
+			return sum;
+		case MatrixF32ReduceMax:
+			return m_matrixf32ReduceMaxKernel(t_n, t_x, false);
+		case MatrixF32ReduceAbsMax:
+			return m_matrixf32ReduceMaxKernel(t_n, t_x, true);
+	}
+
+	return sum;
+}
+
+/**
+ *	Reduces the blocks t_first to t_last - 1 of t_x, halving the range until a single block is left
+ */
+static float m_matrixf32ReducePairwise(MatrixF32ReduceOp t_op, float t_scale, size_t t_n, const float *t_x,
+									   size_t t_first, size_t t_last) {
+	if (t_last - t_first == 1) {
+		const size_t begin = t_first * MATRIX_F32_REDUCE_BLOCK;
+		const size_t len = t_n - begin < MATRIX_F32_REDUCE_BLOCK ? t_n - begin : MATRIX_F32_REDUCE_BLOCK;
+
+		return m_matrixf32ReduceLeaf(t_op, t_scale, len, t_x + begin);
+	}
+
+	const size_t middle = t_first + (t_last - t_first) / 2;
+
+	return m_matrixf32ReduceCombine(t_op, m_matrixf32ReducePairwise(t_op, t_scale, t_n, t_x, t_first, middle),
+									m_matrixf32ReducePairwise(t_op, t_scale, t_n, t_x, middle, t_last));
+}
+
+/**
+ *	Combines t_partial[0] to t_partial[t_n - 1] pairwise
+ */
+static float m_matrixf32ReduceTree(MatrixF32ReduceOp t_op, float *t_partial, size_t t_n) {
+	for (size_t width = 1; width < t_n; width *= 2) {
+		for (size_t k = 0; k + width < t_n; k += 2 * width) {
+			t_partial[k] = m_matrixf32ReduceCombine(t_op, t_partial[k], t_partial[k + width]);
+		}
+	}
+
+	return t_partial[0];
+}
+
+/**
+ *	Reduces the t_n contiguous entries of t_x. Long vectors are cut into MATRIX_F32_REDUCE_SPLIT subtrees, the
+ *	boundaries only depend on t_n, so running them on several threads does not change the result
+ */
+static float m_matrixf32ReduceVector(MatrixF32ReduceOp t_op, float t_scale, size_t t_n, const float *t_x) {
+	const size_t blocks = (t_n + MATRIX_F32_REDUCE_BLOCK - 1) / MATRIX_F32_REDUCE_BLOCK;
+
+	if (blocks <= MATRIX_F32_REDUCE_SPLIT) return m_matrixf32ReducePairwise(t_op, t_scale, t_n, t_x, 0, blocks);
+
+	float partial[MATRIX_F32_REDUCE_SPLIT];
+
+#ifdef _OPENMP
+#pragma omp parallel for if (t_n > MATRIX_F32_REDUCE_PARALLEL_MIN)
+#endif
+	for (size_t k = 0; k < MATRIX_F32_REDUCE_SPLIT; ++k) {
+		const size_t first = blocks * k / MATRIX_F32_REDUCE_SPLIT;
+		const size_t last = blocks * (k + 1) / MATRIX_F32_REDUCE_SPLIT;
+
+		partial[k] = m_matrixf32ReducePairwise(t_op, t_scale, t_n, t_x, first, last);
+	}
+
+	return m_matrixf32ReduceTree(t_op, partial, MATRIX_F32_REDUCE_SPLIT);
+}
+
+/**
+ *	Reduces every line of a row-major t_lines x t_len buffer with t_op into t_out, if not NULL, and returns the
+ *	largest result
+ */
+static float m_matrixf32ReduceLines(MatrixF32ReduceOp t_op, size_t t_lines, size_t t_len, const float *t_a,
+									float *t_out) {
+	const size_t chunks = t_lines < MATRIX_F32_REDUCE_SPLIT ? t_lines : MATRIX_F32_REDUCE_SPLIT;
+	float partial[MATRIX_F32_REDUCE_SPLIT];
+
+#ifdef _OPENMP
+#pragma omp parallel for if (chunks > 1 && t_lines * t_len > MATRIX_F32_REDUCE_PARALLEL_MIN)
+#endif
+	for (size_t k = 0; k < chunks; ++k) {
+		float largest = -INFINITY;
+
+		for (size_t i = t_lines * k / chunks; i < t_lines * (k + 1) / chunks; ++i) {
+			const float value = m_matrixf32ReduceVector(t_op, 1.0f, t_len, t_a + i * t_len);
+
+			if (t_out != 0) t_out[i] = value;
+			largest = m_matrixf32ReduceLarger(largest, value);
+		}
+
+		partial[k] = largest;
+	}
+
+	return m_matrixf32ReduceTree(MatrixF32ReduceMax, partial, chunks);
+}
+
+/**
+ *	Sums rows t_first to t_last - 1 of t_width columns of a row-major buffer into t_out, halving the range of rows
+ *	until MATRIX_F32_REDUCE_ROWS are left
+ */
+static void m_matrixf32ReduceColumnBlock(bool t_absolute, const float *t_a, size_t t_lda, size_t t_first,
+										 size_t t_last, size_t t_width, float *t_out) {
+	if (t_last - t_first <= MATRIX_F32_REDUCE_ROWS) {
+		for (size_t j = 0; j < t_width; ++j) {
+			t_out[j] = 0.0f;
+		}
+
+		for (size_t i = t_first; i < t_last; ++i) {
+			const float *row = t_a + i * t_lda;
+
+			if (t_absolute) {
+				for (size_t j = 0; j < t_width; ++j) t_out[j] += fabsf(row[j]);
+			} else {
+				for (size_t j = 0; j < t_width; ++j) t_out[j] += row[j];
+			}
+		}
+
+		return;
+	}
+
+	const size_t middle = t_first + (t_last - t_first) / 2;
+	float right[MATRIX_F32_REDUCE_COLS];
+
+	m_matrixf32ReduceColumnBlock(t_absolute, t_a, t_lda, t_first, middle, t_width, t_out);
+	m_matrixf32ReduceColumnBlock(t_absolute, t_a, t_lda, middle, t_last, t_width, right);
+
+	for (size_t j = 0; j < t_width; ++j) {
+		t_out[j] += right[j];
+	}
+}
+
+/**
+ *	Sums every column of a row-major t_rows x t_cols buffer into t_out, if not NULL, and returns the largest sum.
+ *	The rows are read contiguously, MATRIX_F32_REDUCE_COLS columns at a time
+ */
+static float m_matrixf32ReduceColumns(bool t_absolute, size_t t_rows, size_t t_cols, const float *t_a, float *t_out) {
+	const size_t blocks = (t_cols + MATRIX_F32_REDUCE_COLS - 1) / MATRIX_F32_REDUCE_COLS;
+	const size_t chunks = blocks < MATRIX_F32_REDUCE_SPLIT ? blocks : MATRIX_F32_REDUCE_SPLIT;
+	float partial[MATRIX_F32_REDUCE_SPLIT];
+
+#ifdef _OPENMP
+#pragma omp parallel for if (chunks > 1 && t_rows * t_cols > MATRIX_F32_REDUCE_PARALLEL_MIN)
+#endif
+	for (size_t k = 0; k < chunks; ++k) {
+		float largest = -INFINITY;
+
+		for (size_t b = blocks * k / chunks; b < blocks * (k + 1) / chunks; ++b) {
+			const size_t first = b * MATRIX_F32_REDUCE_COLS;
+			const size_t width = t_cols - first < MATRIX_F32_REDUCE_COLS ? t_cols - first : MATRIX_F32_REDUCE_COLS;
+			float sum[MATRIX_F32_REDUCE_COLS];
+
+			m_matrixf32ReduceColumnBlock(t_absolute, t_a + first, t_cols, 0, t_rows, width, sum);
+
+			for (size_t j = 0; j < width; ++j) {
+				if (t_out != 0) t_out[first + j] = sum[j];
+				largest = m_matrixf32ReduceLarger(largest, sum[j]);
+			}
+		}
+
+		partial[k] = largest;
+	}
+
+	return m_matrixf32ReduceTree(MatrixF32ReduceMax, partial, chunks);
+}
+
+/**
+ *	Sums of the rows, or of the columns, of t_mat into t_out, if not NULL, returns the largest. The rows of the
+ *	buffer are the rows of a row-major matrix and the columns of a column-major one
+ */
+static float m_matrixf32ReduceSums(const MatrixF32Ptr t_mat, bool t_columns, bool t_absolute, float *t_out) {
+	const bool row_major = t_mat->m_layout == MatrixLayoutRowMajor;
+	const size_t lines = row_major ? t_mat->m_row : t_mat->m_col;
+	const size_t len = row_major ? t_mat->m_col : t_mat->m_row;
+
+	if (row_major != t_columns) {
+		const MatrixF32ReduceOp op = t_absolute ? MatrixF32ReduceAbsSum : MatrixF32ReduceSum;
+
+		return m_matrixf32ReduceLines(op, lines, len, t_mat->m_val, t_out);
+	}
+
+	return m_matrixf32ReduceColumns(t_absolute, lines, len, t_mat->m_val, t_out);
+}
+
+float m_matrixf32Norm2FromSquares(float t_squares, size_t t_n, const float *t_x) {
+	if (isnan(t_squares) || (t_squares >= FLT_MIN && t_squares <= FLT_MAX)) return sqrtf(t_squares);
+
+	// the squares overflowed or underflowed, scale by the largest magnitude first
+	const float scale = m_matrixf32ReduceVector(MatrixF32ReduceAbsMax, 1.0f, t_n, t_x);
+
+	if (scale == 0.0f || isinf(scale)) return scale;
+
+	return scale * sqrtf(m_matrixf32ReduceVector(MatrixF32ReduceSquares, scale, t_n, t_x));
+}
+
+static MatrixStatus m_matrixf32ReduceSumsInto(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat,
+											  bool t_columns) {
+	if (t_result == 0 || t_mat == 0 || t_result->m_val == 0 || t_mat->m_val == 0) return MatrixStatusErrNullPtr;
+
+	const size_t len = t_columns ? t_mat->m_col : t_mat->m_row;
+	bool dim_not_matched = !m_matrixf32IsVector(t_result) || t_result->m_row * t_result->m_col != len;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+
+	m_matrixf32Touch(t_result);
+
+	m_matrixf32ReduceSums(t_mat, t_columns, false, t_result->m_val);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32Norm(float *t_result, const MatrixF32Ptr t_mat, MatrixNormType t_type) {
+	if (t_result == 0 || t_mat == 0 || t_mat->m_val == 0) return MatrixStatusErrNullPtr;
+
+	const size_t total = t_mat->m_row * t_mat->m_col;
+
+	switch (t_type) {
+		case MatrixNormFrobenius:
+			*t_result = m_matrixf32Norm2FromSquares(
+				m_matrixf32ReduceVector(MatrixF32ReduceSquares, 1.0f, total, t_mat->m_val), total, t_mat->m_val);
+			return MatrixStatusOK;
+		case MatrixNormOne:
+			*t_result = m_matrixf32ReduceSums(t_mat, true, true, 0);
+			return MatrixStatusOK;
+		case MatrixNormInf:
+			*t_result = m_matrixf32ReduceSums(t_mat, false, true, 0);
+			return MatrixStatusOK;
+		case MatrixNormMax:
+			*t_result = m_matrixf32ReduceVector(MatrixF32ReduceAbsMax, 1.0f, total, t_mat->m_val);
+			return MatrixStatusOK;
+	}
+
+	return MatrixStatusErrUnknownOpt;
+}
+
+MatrixStatus matrixf32Sum(float *t_result, const MatrixF32Ptr t_mat) {
+	if (t_result == 0 || t_mat == 0 || t_mat->m_val == 0) return MatrixStatusErrNullPtr;
+
+	*t_result = m_matrixf32ReduceVector(MatrixF32ReduceSum, 1.0f, t_mat->m_row * t_mat->m_col, t_mat->m_val);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32Trace(float *t_result, const MatrixF32Ptr t_mat) {
+	if (t_result == 0 || t_mat == 0 || t_mat->m_val == 0) return MatrixStatusErrNullPtr;
+	if (t_mat->m_row != t_mat->m_col) return MatrixStatusErrDimMismatch;
+
+	// the diagonal is at the same offsets in both layouts
+	const size_t n = t_mat->m_row;
+	float sum = 0.0f;
+
+	for (size_t i = 0; i < n; ++i) {
+		sum += t_mat->m_val[i * (n + 1)];
+	}
+
+	*t_result = sum;
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32RowSums(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat) {
+	return m_matrixf32ReduceSumsInto(t_result, t_mat, false);
+}
+
+MatrixStatus matrixf32ColSums(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat) {
+	return m_matrixf32ReduceSumsInto(t_result, t_mat, true);
+}
+
+MatrixStatus matrixf32ArgMax(MatrixDimType *t_index, const MatrixF32Ptr t_mat, bool t_absolute) {
+	if (t_index == 0 || t_mat == 0 || t_mat->m_val == 0) return MatrixStatusErrNullPtr;
+
+	const MatrixF32ReduceOp op = t_absolute ? MatrixF32ReduceAbsMax : MatrixF32ReduceMax;
+	const float largest = m_matrixf32ReduceVector(op, 1.0f, t_mat->m_row * t_mat->m_col, t_mat->m_val);
+	const size_t row_stride = m_matrixf32RowStride(t_mat), col_stride = m_matrixf32ColStride(t_mat);
+
+	// the vectorized maximum first, then the first entry equal to it in row-major order
+	for (size_t i = 0; i < t_mat->m_row; ++i) {
+		for (size_t j = 0; j < t_mat->m_col; ++j) {
+			const float entry = t_mat->m_val[i * row_stride + j * col_stride];
+			const float value = t_absolute ? fabsf(entry) : entry;
+
+			if (value == largest || (isnan(largest) && isnan(value))) {
+				t_index->m_row = i;
+				t_index->m_col = j;
+
+				return MatrixStatusOK;
+			}
+		}
+	}
+
+	return MatrixStatusOK;
+}
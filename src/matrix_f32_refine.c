@@ -0,0 +1,365 @@
+/**
+ * @Date:   2026-10-19T23:04:26+08:00
+ * @Last modified time: 2026-10-19T23:04:26+08:00
+ */
+
+#include "include/matrix_f32_refine.h"
+#include "src/matrix_f32_private.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+#ifndef MATRIX_F32_REFINE_MAX_ITERATIONS
+#define MATRIX_F32_REFINE_MAX_ITERATIONS 30
+#endif
+
+// private function
+static double m_matrixf32RefineNormInf(const MatrixF32Ptr t_mat) {
+	double norm = 0.0;
+
+	for (size_t i = 0; i < t_mat->m_row; ++i) {
+		double sum = 0.0;
+
+		for (size_t j = 0; j < t_mat->m_col; ++j) {
+			sum += fabs((double)t_mat->m_val[i * t_mat->m_col + j]);
+		}
+
+		if (sum > norm) norm = sum;
+	}
+
+	return norm;
+}
+
+// t_r = B - A * X in double, B and X are n x k
+static void m_matrixf32RefineResidual(const MatrixF32Ptr t_mat_a, const MatrixF32Ptr t_column, const double *t_x,
+									  double *t_r) {
+	const size_t n = t_mat_a->m_row;
+	const size_t k = t_column->m_col;
+
+	for (size_t i = 0; i < n * k; ++i) {
+		t_r[i] = t_column->m_val[i];
+	}
+
+	for (size_t i = 0; i < n; ++i) {
+		const float *a_row = t_mat_a->m_val + i * n;
+		double *r_row = t_r + i * k;
+
+		for (size_t c = 0; c < n; ++c) {
+			const double a_ic = a_row[c];
+			const double *x_row = t_x + c * k;
+
+			for (size_t j = 0; j < k; ++j) {
+				r_row[j] -= a_ic * x_row[j];
+			}
+		}
+	}
+}
+
+/**
+ *	Updates the backward error of the report and returns whether every column has ||r|| <= sqrt(n) eps ||A|| ||x||,
+ *	the stopping criterion of LAPACK dsgesv
+ */
+static bool m_matrixf32RefineConverged(const MatrixF32Ptr t_column, double t_norm_a, const double *t_x,
+									   const double *t_r, MatrixF32RefineReport *t_report) {
+	const size_t n = t_column->m_row;
+	const size_t k = t_column->m_col;
+	const double tolerance = sqrt((double)n) * DBL_EPSILON * t_norm_a;
+	bool converged = true;
+
+	t_report->m_backwardError = 0.0;
+
+	for (size_t j = 0; j < k; ++j) {
+		double norm_r = 0.0, norm_x = 0.0, norm_b = 0.0;
+
+		for (size_t i = 0; i < n; ++i) {
+			norm_r = fmax(norm_r, fabs(t_r[i * k + j]));
+			norm_x = fmax(norm_x, fabs(t_x[i * k + j]));
+			norm_b = fmax(norm_b, fabs((double)t_column->m_val[i * k + j]));
+		}
+
+		if (norm_r > tolerance * norm_x) converged = false;
+
+		const double scale = t_norm_a * norm_x + norm_b;
+		const double backward_error = scale > 0.0 ? norm_r / scale : 0.0;
+
+		if (backward_error > t_report->m_backwardError) t_report->m_backwardError = backward_error;
+	}
+
+	return converged;
+}
+
+/**
+ *	Factorizes A in float into t_lu and t_permutation, in the form of matrixf32OutPlaceLU. Returns false if a pivot is
+ *	at most n eps ||A||, relative to A so that the outcome does not depend on its scale
+ */
+static bool m_matrixf32RefineFactor(const MatrixF32Ptr t_mat_a, double t_norm_a, float *t_lu, float *t_permutation,
+									size_t *t_pivot) {
+	const size_t n = t_mat_a->m_row;
+
+	memcpy(t_lu, t_mat_a->m_val, n * n * sizeof(float));
+
+	for (size_t i = 0; i < n; ++i) {
+		t_pivot[i] = i;
+		t_permutation[i] = (float)i;
+	}
+
+	if (!m_matrixf32LUFactorExactKernel(t_lu, n, t_pivot)) return false;
+
+	for (size_t i = 0; i < n; ++i) {
+		const float temp = t_permutation[i];
+		t_permutation[i] = t_permutation[t_pivot[i]];
+		t_permutation[t_pivot[i]] = temp;
+	}
+
+	const double tolerance = (double)n * FLT_EPSILON * t_norm_a;
+
+	for (size_t i = 0; i < n; ++i) {
+		if (fabs((double)t_lu[i * n + i]) <= tolerance) return false;
+	}
+
+	return true;
+}
+
+// U * X = Y in place, without the absolute pivot threshold of m_matrixf32LUBackwardKernel
+static void m_matrixf32RefineBackward(const float *t_lu, size_t t_n, float *t_x, size_t t_k) {
+	for (size_t i = t_n; i-- > 0;) {
+		float *x_row = t_x + i * t_k;
+
+		for (size_t c = i + 1; c < t_n; ++c) {
+			m_matrixf32AxpyKernel(t_k, -t_lu[i * t_n + c], t_x + c * t_k, x_row);
+		}
+
+		for (size_t j = 0; j < t_k; ++j) {
+			x_row[j] /= t_lu[i * t_n + i];
+		}
+	}
+}
+
+/**
+ *	Solves A * X = B with a double precision LU decomposition with partial pivoting and one refinement step. t_r is
+ *	n x k scratch.
+ */
+static MatrixStatus m_matrixf32RefineSolveF64(const MatrixF32Ptr t_mat_a, const MatrixF32Ptr t_column, double *t_x,
+											  double *t_r) {
+	const size_t n = t_mat_a->m_row;
+	const size_t k = t_column->m_col;
+
+	double *lu = MATRIX_F32_MALLOC(n * n * sizeof(double));
+	size_t *pivots = MATRIX_F32_MALLOC(n * sizeof(size_t));
+
+	if (lu == 0 || pivots == 0) {
+		MATRIX_F32_FREE(lu);
+		MATRIX_F32_FREE(pivots);
+
+		return MatrixStatusErrNullPtr;
+	}
+
+	for (size_t i = 0; i < n * n; ++i) {
+		lu[i] = t_mat_a->m_val[i];
+	}
+
+	MatrixStatus status = MatrixStatusOK;
+
+	for (size_t p = 0; p < n && status == MatrixStatusOK; ++p) {
+		size_t pivot = p;
+
+		for (size_t i = p + 1; i < n; ++i) {
+			if (fabs(lu[i * n + p]) > fabs(lu[pivot * n + p])) pivot = i;
+		}
+
+		pivots[p] = pivot;
+
+		if (lu[pivot * n + p] == 0.0) {
+			status = MatrixStatusErrSingular;
+			break;
+		}
+
+		for (size_t j = 0; pivot != p && j < n; ++j) {
+			const double swap = lu[p * n + j];
+			lu[p * n + j] = lu[pivot * n + j];
+			lu[pivot * n + j] = swap;
+		}
+
+		for (size_t i = p + 1; i < n; ++i) {
+			const double l = lu[i * n + p] /= lu[p * n + p];
+
+			for (size_t j = p + 1; j < n; ++j) {
+				lu[i * n + j] -= l * lu[p * n + j];
+			}
+		}
+	}
+
+	// the first pass solves from X = 0, the second refines
+	for (size_t i = 0; i < n * k && status == MatrixStatusOK; ++i) {
+		t_x[i] = 0.0;
+	}
+
+	for (size_t pass = 0; pass < 2 && status == MatrixStatusOK; ++pass) {
+		m_matrixf32RefineResidual(t_mat_a, t_column, t_x, t_r);
+
+		for (size_t p = 0; p < n; ++p) {
+			for (size_t j = 0; pivots[p] != p && j < k; ++j) {
+				const double swap = t_r[p * k + j];
+				t_r[p * k + j] = t_r[pivots[p] * k + j];
+				t_r[pivots[p] * k + j] = swap;
+			}
+		}
+
+		for (size_t i = 1; i < n; ++i) {
+			for (size_t c = 0; c < i; ++c) {
+				for (size_t j = 0; j < k; ++j) {
+					t_r[i * k + j] -= lu[i * n + c] * t_r[c * k + j];
+				}
+			}
+		}
+
+		for (size_t i = n; i-- > 0;) {
+			for (size_t c = i + 1; c < n; ++c) {
+				for (size_t j = 0; j < k; ++j) {
+					t_r[i * k + j] -= lu[i * n + c] * t_r[c * k + j];
+				}
+			}
+
+			for (size_t j = 0; j < k; ++j) {
+				t_r[i * k + j] /= lu[i * n + i];
+			}
+		}
+
+		for (size_t i = 0; i < n * k; ++i) {
+			t_x[i] += t_r[i];
+		}
+	}
+
+	MATRIX_F32_FREE(lu);
+	MATRIX_F32_FREE(pivots);
+
+	return status;
+}
+
+MatrixStatus matrixf32SolveRefined(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_a,
+								   const MatrixF32Ptr t_column, double *t_solution, MatrixF32RefineReport *t_report) {
+	if (t_result == 0 || t_mat_a == 0 || t_column == 0) return MatrixStatusErrNullPtr;
+	if (t_result->m_val == 0 || t_mat_a->m_val == 0 || t_column->m_val == 0) return MatrixStatusErrNullPtr;
+
+	const size_t n = t_mat_a->m_row;
+	const size_t k = t_column->m_col;
+	bool dim_not_matched = t_mat_a->m_col != n || t_column->m_row != n || t_result->m_row != n || t_result->m_col != k;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+	bool row_major = m_matrixf32RowMajorBuffer(t_result) && m_matrixf32RowMajorBuffer(t_mat_a) &&
+					 m_matrixf32RowMajorBuffer(t_column);
+	if (!row_major) return MatrixStatusErrLayout;
+
+	MatrixF32RefineReport report = {0, 0.0, false, false};
+
+	double *x = MATRIX_F32_MALLOC(2 * n * k * sizeof(double));
+	float *correction = MATRIX_F32_MALLOC(2 * n * k * sizeof(float));
+	size_t *pivot = MATRIX_F32_MALLOC(n * sizeof(size_t));
+	MatrixF32Ptr lu = m_matrixf32CreateFor((MatrixDimType){n, n}, MatrixF32OpSolve);
+	MatrixF32Ptr permutation = m_matrixf32CreateFor((MatrixDimType){n, 1}, MatrixF32OpSolve);
+
+	bool allocated = x != 0 && correction != 0 && pivot != 0 && lu != 0 && lu->m_val != 0 && permutation != 0 &&
+					 permutation->m_val != 0;
+
+	if (!allocated) {
+		MATRIX_F32_FREE(x);
+		MATRIX_F32_FREE(correction);
+		MATRIX_F32_FREE(pivot);
+		matrixf32Destroy(&lu);
+		matrixf32Destroy(&permutation);
+
+		return MatrixStatusErrNullPtr;
+	}
+
+	double *residual = x + n * k;
+	float *residual_f32 = correction + n * k;
+	const double norm_a = m_matrixf32RefineNormInf(t_mat_a);
+
+	bool fallback = !m_matrixf32RefineFactor(t_mat_a, norm_a, lu->m_val, permutation->m_val, pivot);
+
+	if (!fallback) {
+		m_matrixf32LUForwardKernel(lu->m_val, permutation->m_val, n, t_column->m_val, k, correction);
+		m_matrixf32RefineBackward(lu->m_val, n, correction, k);
+
+		for (size_t i = 0; i < n * k; ++i) {
+			x[i] = correction[i];
+		}
+	}
+
+	double previous_step = HUGE_VAL;
+
+	while (!fallback) {
+		m_matrixf32RefineResidual(t_mat_a, t_column, x, residual);
+
+		if (m_matrixf32RefineConverged(t_column, norm_a, x, residual, &report)) {
+			report.m_converged = true;
+			break;
+		}
+
+		if (report.m_iterations == MATRIX_F32_REFINE_MAX_ITERATIONS) {
+			fallback = true;
+			break;
+		}
+
+		for (size_t i = 0; i < n * k; ++i) {
+			residual_f32[i] = (float)residual[i];
+		}
+
+		m_matrixf32LUForwardKernel(lu->m_val, permutation->m_val, n, residual_f32, k, correction);
+		m_matrixf32RefineBackward(lu->m_val, n, correction, k);
+
+		double step = 0.0;
+
+		for (size_t i = 0; i < n * k; ++i) {
+			step = fmax(step, fabs((double)correction[i]));
+		}
+
+		// the corrections stopped contracting, the float factors are not accurate enough for A
+		if (step > 0.5 * previous_step) {
+			fallback = true;
+			break;
+		}
+
+		previous_step = step;
+
+		for (size_t i = 0; i < n * k; ++i) {
+			x[i] += correction[i];
+		}
+
+		++report.m_iterations;
+	}
+
+	MatrixStatus status = MatrixStatusOK;
+
+	if (fallback) {
+		report.m_fallback = true;
+		status = m_matrixf32RefineSolveF64(t_mat_a, t_column, x, residual);
+
+		if (status == MatrixStatusOK) {
+			m_matrixf32RefineResidual(t_mat_a, t_column, x, residual);
+			report.m_converged = m_matrixf32RefineConverged(t_column, norm_a, x, residual, &report);
+		}
+	}
+
+	if (status == MatrixStatusOK) {
+		m_matrixf32Touch(t_result);
+
+		for (size_t i = 0; i < n * k; ++i) {
+			t_result->m_val[i] = (float)x[i];
+		}
+
+		for (size_t i = 0; t_solution != 0 && i < n * k; ++i) {
+			t_solution[i] = x[i];
+		}
+	}
+
+	MATRIX_F32_FREE(x);
+	MATRIX_F32_FREE(correction);
+	MATRIX_F32_FREE(pivot);
+	matrixf32Destroy(&lu);
+	matrixf32Destroy(&permutation);
+
+	if (t_report != 0) *t_report = report;
+
+	return status;
+}
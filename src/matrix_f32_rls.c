@@ -0,0 +1,231 @@
+/**
+ * @Date:   2026-10-19T19:02:16+08:00
+ * @Last modified time: 2026-10-19T19:02:16+08:00
+ */
+
+#include "include/matrix_f32_rls.h"
+#include "src/matrix_f32_private.h"
+
+#include <math.h>
+
+struct MatrixF32Rls {
+	MatrixF32Ptr m_theta;
+	MatrixF32Ptr m_covariance;
+	MatrixF32Ptr m_work;  // n x 2
+
+	float m_forgetting;
+};
+
+// private function
+/**
+ *	First half of A^-1 = t_scale * A^-1 - (A^-1 u)(v^T A^-1) / (1 + v^T A^-1 u) on raw buffers, u and v may be strided
+ *	columns. t_au and t_va receive t_scale * A^-1 u and t_scale * v^T A^-1, nothing is written to t_inverse, so a
+ *	singular update leaves it unchanged.
+ */
+static bool m_matrixf32ShermanMorrisonPrepare(const float *t_inverse, size_t t_n, const float *t_u, size_t t_u_stride,
+											  const float *t_v, size_t t_v_stride, float t_scale, float *t_au,
+											  float *t_va, float *t_denominator) {
+	for (size_t i = 0; i < t_n; ++i) {
+		t_va[i] = 0.0f;
+	}
+
+	for (size_t i = 0; i < t_n; ++i) {
+		const float *row = t_inverse + i * t_n;
+		const float v_i = t_v[i * t_v_stride] * t_scale;
+		float sum = 0.0f;
+
+		for (size_t j = 0; j < t_n; ++j) {
+			sum += row[j] * t_u[j * t_u_stride];
+			t_va[j] += v_i * row[j];
+		}
+
+		t_au[i] = sum * t_scale;
+	}
+
+	float denominator = 1.0f;
+
+	for (size_t i = 0; i < t_n; ++i) {
+		denominator += t_v[i * t_v_stride] * t_au[i];
+	}
+
+	*t_denominator = denominator;
+
+	return fabsf(denominator) > 1e-6f;
+}
+
+/**
+ *	Second half, applies the update prepared by m_matrixf32ShermanMorrisonPrepare
+ */
+static void m_matrixf32ShermanMorrisonApply(float *t_inverse, size_t t_n, float t_scale, const float *t_au,
+											const float *t_va, float t_denominator) {
+	const float inv_denominator = 1.0f / t_denominator;
+
+	for (size_t i = 0; i < t_n; ++i) {
+		float *row = t_inverse + i * t_n;
+		const float scale = t_au[i] * inv_denominator;
+
+		if (t_scale != 1.0f) {
+			for (size_t j = 0; j < t_n; ++j) {
+				row[j] = row[j] * t_scale - scale * t_va[j];
+			}
+		} else {
+			for (size_t j = 0; j < t_n; ++j) {
+				row[j] -= scale * t_va[j];
+			}
+		}
+	}
+}
+
+static MatrixStatus m_matrixf32InverseUpdateCheck(const MatrixF32Ptr t_inverse, const MatrixF32Ptr t_u,
+												  const MatrixF32Ptr t_v, const MatrixF32Ptr t_work) {
+	if (t_inverse == 0 || t_u == 0 || t_v == 0 || t_work == 0) return MatrixStatusErrNullPtr;
+	if (t_inverse->m_val == 0 || t_u->m_val == 0 || t_v->m_val == 0 || t_work->m_val == 0) {
+		return MatrixStatusErrNullPtr;
+	}
+
+	const size_t n = t_inverse->m_row;
+	bool dim_not_matched = t_inverse->m_col != n || t_u->m_row != n || t_v->m_row != n || t_u->m_col != t_v->m_col ||
+						   t_work->m_row * t_work->m_col < 2 * n;
+
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+
+	bool row_major = m_matrixf32RowMajorBuffer(t_inverse) && m_matrixf32RowMajorBuffer(t_u) &&
+					 m_matrixf32RowMajorBuffer(t_v);
+
+	return row_major ? MatrixStatusOK : MatrixStatusErrLayout;
+}
+
+MatrixStatus matrixf32ShermanMorrison(const MatrixF32Ptr t_inverse, const MatrixF32Ptr t_u, const MatrixF32Ptr t_v,
+									  const MatrixF32Ptr t_work) {
+	MatrixStatus ret_val = m_matrixf32InverseUpdateCheck(t_inverse, t_u, t_v, t_work);
+	if (ret_val != MatrixStatusOK) return ret_val;
+	if (t_u->m_col != 1) return MatrixStatusErrDimMismatch;
+
+	const size_t n = t_inverse->m_row;
+	float *au = t_work->m_val, *va = t_work->m_val + n;
+	float denominator;
+
+	if (!m_matrixf32ShermanMorrisonPrepare(t_inverse->m_val, n, t_u->m_val, 1, t_v->m_val, 1, 1.0f, au, va,
+										   &denominator)) {
+		return MatrixStatusErrSingular;
+	}
+
+	m_matrixf32Touch(t_inverse);
+	m_matrixf32ShermanMorrisonApply(t_inverse->m_val, n, 1.0f, au, va, denominator);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32Woodbury(const MatrixF32Ptr t_inverse, const MatrixF32Ptr t_u, const MatrixF32Ptr t_v,
+							   const MatrixF32Ptr t_work) {
+	MatrixStatus ret_val = m_matrixf32InverseUpdateCheck(t_inverse, t_u, t_v, t_work);
+	if (ret_val != MatrixStatusOK) return ret_val;
+
+	const size_t n = t_inverse->m_row;
+	const size_t k = t_u->m_col;
+	float *au = t_work->m_val, *va = t_work->m_val + n;
+
+	// A + U V^T = A + sum of u_c v_c^T
+	for (size_t c = 0; c < k; ++c) {
+		float denominator;
+
+		if (!m_matrixf32ShermanMorrisonPrepare(t_inverse->m_val, n, t_u->m_val + c, k, t_v->m_val + c, k, 1.0f, au, va,
+											   &denominator)) {
+			return MatrixStatusErrSingular;
+		}
+
+		if (c == 0) m_matrixf32Touch(t_inverse);
+		m_matrixf32ShermanMorrisonApply(t_inverse->m_val, n, 1.0f, au, va, denominator);
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixF32RlsPtr matrixf32RlsCreate(size_t t_n, float t_forgetting, float t_delta) {
+	if (t_n == 0 || !(t_forgetting > 0.0f && t_forgetting <= 1.0f) || !(t_delta > 0.0f)) return 0;
+
+	MatrixF32RlsPtr rls = MATRIX_F32_MALLOC(sizeof(struct MatrixF32Rls));
+	if (rls == 0) return 0;
+
+	rls->m_forgetting = t_forgetting;
+	rls->m_theta = m_matrixf32CreateFor((MatrixDimType){t_n, 1}, MatrixF32OpCreate);
+	rls->m_covariance = m_matrixf32CreateFor((MatrixDimType){t_n, t_n}, MatrixF32OpCreate);
+	rls->m_work = m_matrixf32CreateFor((MatrixDimType){t_n, 2}, MatrixF32OpCreate);
+
+	bool allocated = rls->m_theta != 0 && rls->m_theta->m_val != 0 && rls->m_covariance != 0 &&
+					 rls->m_covariance->m_val != 0 && rls->m_work != 0 && rls->m_work->m_val != 0;
+
+	if (!allocated) {
+		matrixf32RlsDestroy(&rls);
+
+		return 0;
+	}
+
+	for (size_t i = 0; i < t_n; ++i) {
+		rls->m_covariance->m_val[i * t_n + i] = t_delta;
+	}
+
+	return rls;
+}
+
+MatrixStatus matrixf32RlsDestroy(MatrixF32RlsPtr *t_rls) {
+	if (t_rls == 0) return MatrixStatusErrNullPtr;
+
+	if (*t_rls != 0) {
+		matrixf32Destroy(&(*t_rls)->m_theta);
+		matrixf32Destroy(&(*t_rls)->m_covariance);
+		matrixf32Destroy(&(*t_rls)->m_work);
+	}
+
+	MATRIX_F32_FREE(*t_rls);
+	*t_rls = 0;
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32RlsUpdate(MatrixF32RlsPtr t_rls, const MatrixF32Ptr t_regressor, float t_measurement,
+								float *t_error) {
+	if (t_rls == 0 || t_regressor == 0 || t_regressor->m_val == 0) return MatrixStatusErrNullPtr;
+
+	const size_t n = t_rls->m_theta->m_row;
+	if (t_regressor->m_row != n || t_regressor->m_col != 1) return MatrixStatusErrDimMismatch;
+
+	const float *phi = t_regressor->m_val;
+	float *theta = t_rls->m_theta->m_val;
+	float *p = t_rls->m_covariance->m_val;
+	float *p_phi = t_rls->m_work->m_val;
+
+	float error = t_measurement;
+
+	for (size_t i = 0; i < n; ++i) {
+		error -= phi[i] * theta[i];
+	}
+
+	// P = (lambda * P^-1 + phi * phi^T)^-1, a Sherman-Morrison update of P / lambda. The 1 / lambda scaling is folded
+	// into both passes, so P is left as it was if the update is singular
+	const float scale_p = 1.0f / t_rls->m_forgetting;
+	float denominator;
+
+	if (!m_matrixf32ShermanMorrisonPrepare(p, n, phi, 1, phi, 1, scale_p, p_phi, p_phi + n, &denominator)) {
+		return MatrixStatusErrSingular;
+	}
+
+	m_matrixf32Touch(t_rls->m_theta);
+	m_matrixf32Touch(t_rls->m_covariance);
+	m_matrixf32ShermanMorrisonApply(p, n, scale_p, p_phi, p_phi + n, denominator);
+
+	// gain = P_new * phi = (P / lambda) * phi / denominator
+	const float scale = error / denominator;
+
+	for (size_t i = 0; i < n; ++i) {
+		theta[i] += p_phi[i] * scale;
+	}
+
+	if (t_error != 0) *t_error = error;
+
+	return MatrixStatusOK;
+}
+
+MatrixF32Ptr matrixf32RlsGetParameter(MatrixF32RlsPtr t_rls) { return t_rls == 0 ? 0 : t_rls->m_theta; }
+
+MatrixF32Ptr matrixf32RlsGetCovariance(MatrixF32RlsPtr t_rls) { return t_rls == 0 ? 0 : t_rls->m_covariance; }
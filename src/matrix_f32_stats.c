@@ -0,0 +1,86 @@
+/**
+ * @Date:   2026-10-19T09:41:17+08:00
+ * @Last modified time: 2026-10-19T09:41:17+08:00
+ */
+
+#include "src/matrix_f32_instrument.h"
+
+#include <string.h>
+
+static const char *const op_name[MatrixF32OpCount] = {
+	"Create",
+	"CreateContainer",
+	"Destroy",
+	"GetColNumber",
+	"GetRowNumber",
+	"GetOwnership",
+	"GetValueAt",
+	"GetBuffer",
+	"SetValueAt",
+	"SetAllEntriesTo",
+	"TwoMatEqual",
+	"Add",
+	"Scale",
+	"Subtract",
+	"Multiplication",
+	"Copy",
+	"Swap",
+	"InPlaceLU",
+	"OutPlaceLU",
+	"ForwardSubstitution",
+	"BackwardSubstitution",
+	"Inverse",
+	"GetVersion",
+	"SetFactorCache",
+	"Solve",
+	"GetLayout",
+};
+
+const char *matrixf32OpName(MatrixF32Op t_op) {
+	if ((unsigned)t_op >= MatrixF32OpCount) return "Unknown";
+
+	return op_name[t_op];
+}
+
+#ifdef MATRIX_F32_ENABLE_STATS
+
+static MatrixF32StatsType stats;
+
+void m_matrixf32StatsRecord(MatrixF32Op t_op, uint64_t t_cycles, uint64_t t_flops, uint64_t t_bytes) {
+	MatrixF32OpStatsType *op_stats = &stats.m_op[t_op];
+
+	if (op_stats->m_callCount == 0 || t_cycles < op_stats->m_minCycles) op_stats->m_minCycles = t_cycles;
+	if (t_cycles > op_stats->m_maxCycles) op_stats->m_maxCycles = t_cycles;
+
+	op_stats->m_callCount++;
+	op_stats->m_totalCycles += t_cycles;
+	op_stats->m_flops += t_flops;
+	op_stats->m_bytes += t_bytes;
+}
+
+MatrixStatus matrixf32StatsSnapshot(MatrixF32StatsType *t_snapshot) {
+	if (t_snapshot == 0) return MatrixStatusErrNullPtr;
+
+	memcpy(t_snapshot, &stats, sizeof(stats));
+
+	return MatrixStatusOK;
+}
+
+void matrixf32StatsReset(void) {
+	cycleCounterInit();
+	memset(&stats, 0, sizeof(stats));
+}
+
+#else
+
+MatrixStatus matrixf32StatsSnapshot(MatrixF32StatsType *t_snapshot) {
+	if (t_snapshot == 0) return MatrixStatusErrNullPtr;
+
+	memset(t_snapshot, 0, sizeof(*t_snapshot));
+
+	return MatrixStatusOK;
+}
+
+void matrixf32StatsReset(void) {}
+
+#endif
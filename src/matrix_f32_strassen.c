@@ -0,0 +1,124 @@
+/**
+ * @Date:   2026-10-20T01:02:47+08:00
+ * @Last modified time: 2026-10-20T01:02:47+08:00
+ */
+
+#include "include/matrix_f32_strassen.h"
+#include "src/matrix_f32_private.h"
+
+// private function
+static size_t m_matrixf32StrassenCutoff(size_t t_cutoff) {
+	return t_cutoff == 0 ? MATRIX_F32_STRASSEN_CUTOFF : t_cutoff;
+}
+
+// z = x + y, or x - y if t_subtract, for h x h blocks. z may be x or y
+static void m_matrixf32StrassenAdd(size_t t_h, const float *t_x, size_t t_ldx, const float *t_y, size_t t_ldy,
+								   bool t_subtract, float *t_z, size_t t_ldz) {
+	for (size_t i = 0; i < t_h; ++i) {
+		const float *x = t_x + i * t_ldx;
+		const float *y = t_y + i * t_ldy;
+		float *z = t_z + i * t_ldz;
+
+		if (t_subtract) {
+			for (size_t j = 0; j < t_h; ++j) {
+				z[j] = x[j] - y[j];
+			}
+		} else {
+			for (size_t j = 0; j < t_h; ++j) {
+				z[j] = x[j] + y[j];
+			}
+		}
+	}
+}
+
+/**
+ *	C = A * B for n x n blocks. Uses the schedule of Boyer, Dumas, Pernet and Zhou, which keeps the 7 products in the
+ *	quadrants of C and two h x h temporaries X and Y, so each level needs 2h^2 floats of t_workspace.
+ */
+static void m_matrixf32StrassenRecurse(size_t t_n, const float *t_a, size_t t_lda, const float *t_b, size_t t_ldb,
+									   float *t_c, size_t t_ldc, size_t t_cutoff, float *t_workspace) {
+	if (t_n <= t_cutoff) {
+		m_matrixf32GemmKernel(t_n, t_n, t_n, 1.0f, t_a, t_lda, t_b, t_ldb, false, t_c, t_ldc);
+
+		return;
+	}
+
+	const size_t h = t_n / 2;
+	const size_t even = 2 * h;
+
+	const float *a11 = t_a, *a12 = t_a + h, *a21 = t_a + h * t_lda, *a22 = t_a + h * t_lda + h;
+	const float *b11 = t_b, *b12 = t_b + h, *b21 = t_b + h * t_ldb, *b22 = t_b + h * t_ldb + h;
+	float *c11 = t_c, *c12 = t_c + h, *c21 = t_c + h * t_ldc, *c22 = t_c + h * t_ldc + h;
+	float *x = t_workspace;
+	float *y = t_workspace + h * h;
+	float *next = t_workspace + 2 * h * h;
+
+	m_matrixf32StrassenAdd(h, a11, t_lda, a21, t_lda, true, x, h);						// S3 = A11 - A21
+	m_matrixf32StrassenAdd(h, b22, t_ldb, b12, t_ldb, true, y, h);						// T3 = B22 - B12
+	m_matrixf32StrassenRecurse(h, x, h, y, h, c21, t_ldc, t_cutoff, next);				// P7 = S3 T3
+	m_matrixf32StrassenAdd(h, a21, t_lda, a22, t_lda, false, x, h);						// S1 = A21 + A22
+	m_matrixf32StrassenAdd(h, b12, t_ldb, b11, t_ldb, true, y, h);						// T1 = B12 - B11
+	m_matrixf32StrassenRecurse(h, x, h, y, h, c22, t_ldc, t_cutoff, next);				// P5 = S1 T1
+	m_matrixf32StrassenAdd(h, x, h, a11, t_lda, true, x, h);							// S2 = S1 - A11
+	m_matrixf32StrassenAdd(h, b22, t_ldb, y, h, true, y, h);							// T2 = B22 - T1
+	m_matrixf32StrassenRecurse(h, x, h, y, h, c12, t_ldc, t_cutoff, next);				// P6 = S2 T2
+	m_matrixf32StrassenAdd(h, a12, t_lda, x, h, true, x, h);							// S4 = A12 - S2
+	m_matrixf32StrassenRecurse(h, x, h, b22, t_ldb, c11, t_ldc, t_cutoff, next);		// P3 = S4 B22
+	m_matrixf32StrassenRecurse(h, a11, t_lda, b11, t_ldb, x, h, t_cutoff, next);		// P1 = A11 B11
+	m_matrixf32StrassenAdd(h, x, h, c12, t_ldc, false, c12, t_ldc);						// U2 = P1 + P6
+	m_matrixf32StrassenAdd(h, c12, t_ldc, c21, t_ldc, false, c21, t_ldc);				// U3 = U2 + P7
+	m_matrixf32StrassenAdd(h, c12, t_ldc, c22, t_ldc, false, c12, t_ldc);				// U4 = U2 + P5
+	m_matrixf32StrassenAdd(h, c21, t_ldc, c22, t_ldc, false, c22, t_ldc);				// U7 = U3 + P5
+	m_matrixf32StrassenAdd(h, c12, t_ldc, c11, t_ldc, false, c12, t_ldc);				// U5 = U4 + P3
+	m_matrixf32StrassenAdd(h, y, h, b21, t_ldb, true, y, h);							// T4 = T2 - B21
+	m_matrixf32StrassenRecurse(h, a22, t_lda, y, h, c11, t_ldc, t_cutoff, next);		// P4 = A22 T4
+	m_matrixf32StrassenAdd(h, c21, t_ldc, c11, t_ldc, true, c21, t_ldc);				// U6 = U3 - P4
+	m_matrixf32StrassenRecurse(h, a12, t_lda, b21, t_ldb, c11, t_ldc, t_cutoff, next);	// P2 = A12 B21
+	m_matrixf32StrassenAdd(h, x, h, c11, t_ldc, false, c11, t_ldc);						// U1 = P1 + P2
+
+	if (even == t_n) return;
+
+	// odd n: C[:e, :e] += A[:e, e] B[e, :e], then the last column and the last row in full
+	const size_t e = even;
+
+	m_matrixf32GemmKernel(e, e, 1, 1.0f, t_a + e, t_lda, t_b + e * t_ldb, t_ldb, true, t_c, t_ldc);
+	m_matrixf32GemmKernel(e, 1, t_n, 1.0f, t_a, t_lda, t_b + e, t_ldb, false, t_c + e, t_ldc);
+	m_matrixf32GemmKernel(1, t_n, t_n, 1.0f, t_a + e * t_lda, t_lda, t_b, t_ldb, false, t_c + e * t_ldc, t_ldc);
+}
+
+size_t matrixf32StrassenWorkspaceLen(size_t t_n, size_t t_cutoff) {
+	const size_t cutoff = m_matrixf32StrassenCutoff(t_cutoff);
+	size_t len = 0;
+
+	for (size_t n = t_n; n > cutoff; n /= 2) {
+		len += 2 * (n / 2) * (n / 2);
+	}
+
+	return len;
+}
+
+MatrixStatus matrixf32StrassenMultiplication(const MatrixF32Ptr t_dest, const MatrixF32Ptr t_mat_b,
+											 const MatrixF32Ptr t_mat_c, size_t t_cutoff, float *t_workspace,
+											 size_t t_workspace_len) {
+	if (t_dest == 0 || t_mat_b == 0 || t_mat_c == 0) return MatrixStatusErrNullPtr;
+	if (t_dest->m_val == 0 || t_mat_b->m_val == 0 || t_mat_c->m_val == 0) return MatrixStatusErrNullPtr;
+
+	const size_t n = t_mat_b->m_row;
+	bool dim_not_matched = t_mat_b->m_col != n || t_mat_c->m_row != n || t_mat_c->m_col != n || t_dest->m_row != n ||
+						   t_dest->m_col != n;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+	bool row_major = m_matrixf32RowMajorBuffer(t_dest) && m_matrixf32RowMajorBuffer(t_mat_b) &&
+					 m_matrixf32RowMajorBuffer(t_mat_c);
+	if (!row_major) return MatrixStatusErrLayout;
+
+	const size_t required = matrixf32StrassenWorkspaceLen(n, t_cutoff);
+	if (t_workspace_len < required) return MatrixStatusErrOutOfBound;
+	if (required != 0 && t_workspace == 0) return MatrixStatusErrNullPtr;
+
+	m_matrixf32Touch(t_dest);
+
+	m_matrixf32StrassenRecurse(n, t_mat_b->m_val, n, t_mat_c->m_val, n, t_dest->m_val, n,
+							   m_matrixf32StrassenCutoff(t_cutoff), t_workspace);
+
+	return MatrixStatusOK;
+}
@@ -0,0 +1,409 @@
+/**
+ * @Date:   2026-10-19T17:30:05+08:00
+ * @Last modified time: 2026-10-19T17:30:05+08:00
+ */
+
+#include "include/matrix_f32_stream.h"
+#include "src/matrix_f32_private.h"
+
+#include <float.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#endif
+
+// size of each of the two CSV read buffers, a line must fit into one
+#ifndef MATRIX_F32_STREAM_CHUNK
+#define MATRIX_F32_STREAM_CHUNK (1u << 16)
+#endif
+
+struct MatrixF32Stream {
+	FILE *m_file;
+	MatrixF32StreamFormat m_format;
+	size_t m_col;
+
+	// CSV only: the unparsed bytes [m_begin, m_end) live in m_buffer[m_current], the other buffer receives the next
+	// chunk together with the partial line left over
+	char *m_buffer[2];
+	int m_current;
+	char *m_begin;
+	char *m_end;
+	uint64_t m_offset;
+	bool m_eof;
+	bool m_firstLine;
+};
+
+static const float m_matrixf32StreamPow10[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+
+static inline bool m_matrixf32StreamIsDigit(char t_char) { return t_char >= '0' && t_char <= '9'; }
+
+/**
+ *	Parses one float at *t_cursor and advances it. Decimal numbers with at most 7 significant digits and a decimal
+ *	exponent within +-10 (the bulk of sensor logs) are converted with one exact float multiplication or division,
+ *	which is correctly rounded. Everything else, including nan and inf, goes through strtof.
+ */
+static bool m_matrixf32StreamParseFloat(const char **t_cursor, float *t_value) {
+	const char *start = *t_cursor;
+	const char *p = start;
+
+	bool negative = false;
+	if (*p == '-' || *p == '+') negative = *p++ == '-';
+
+	uint32_t mantissa = 0;
+	int exponent = 0;
+	bool any_digit = false;
+	bool exact = true;
+
+	for (; m_matrixf32StreamIsDigit(*p); ++p) {
+		any_digit = true;
+
+		if (mantissa < (1u << 24) / 10) {
+			mantissa = mantissa * 10 + (uint32_t)(*p - '0');
+		} else {
+			exact = false;
+		}
+	}
+
+	if (*p == '.') {
+		for (++p; m_matrixf32StreamIsDigit(*p); ++p) {
+			any_digit = true;
+
+			if (mantissa < (1u << 24) / 10) {
+				mantissa = mantissa * 10 + (uint32_t)(*p - '0');
+				exponent--;
+			} else {
+				exact = false;
+			}
+		}
+	}
+
+	if (any_digit && (*p == 'e' || *p == 'E')) {
+		const char *exp_start = p++;
+		bool exp_negative = false;
+		int exp_value = 0;
+
+		if (*p == '-' || *p == '+') exp_negative = *p++ == '-';
+
+		if (!m_matrixf32StreamIsDigit(*p)) {
+			p = exp_start;
+		} else {
+			for (; m_matrixf32StreamIsDigit(*p); ++p) {
+				if (exp_value < 10000) exp_value = exp_value * 10 + (*p - '0');
+			}
+
+			exponent += exp_negative ? -exp_value : exp_value;
+		}
+	}
+
+#if defined(FLT_EVAL_METHOD) && FLT_EVAL_METHOD == 0
+	if (any_digit && exact && exponent >= -10 && exponent <= 10) {
+		float value = (float)mantissa;
+		value = exponent < 0 ? value / m_matrixf32StreamPow10[-exponent] : value * m_matrixf32StreamPow10[exponent];
+
+		*t_value = negative ? -value : value;
+		*t_cursor = p;
+
+		return true;
+	}
+#else
+	(void)exact;
+#endif
+
+	// strtof would skip whitespace, including the end of the line, and parse the next one
+	if (*start == ' ' || *start == '\t' || *start == '\r' || *start == '\n') return false;
+
+	char *end;
+	*t_value = strtof(start, &end);
+	if (end == start) return false;
+
+	*t_cursor = end;
+
+	return true;
+}
+
+static bool m_matrixf32StreamParseRow(const char *t_line, const char *t_end, float *t_row, size_t t_col) {
+	const char *p = t_line;
+
+	for (size_t i = 0; i < t_col; ++i) {
+		while (*p == ' ' || *p == '\t') ++p;
+		if (!m_matrixf32StreamParseFloat(&p, &t_row[i])) return false;
+		while (*p == ' ' || *p == '\t') ++p;
+
+		if (i + 1 < t_col) {
+			if (*p != ',') return false;
+			++p;
+		}
+	}
+
+	if (*p == '\r') ++p;
+
+	return p == t_end;
+}
+
+// moves the partial line left over into the other buffer and appends the next chunk of the file to it
+static bool m_matrixf32StreamFill(MatrixF32StreamPtr t_stream) {
+	const size_t tail = (size_t)(t_stream->m_end - t_stream->m_begin);
+	if (tail == MATRIX_F32_STREAM_CHUNK) return false;	// line does not fit into a buffer
+
+	char *next = t_stream->m_buffer[!t_stream->m_current];
+	memcpy(next, t_stream->m_begin, tail);
+
+	const size_t request = MATRIX_F32_STREAM_CHUNK - tail;
+	const size_t got = fread(next + tail, 1, request, t_stream->m_file);
+
+	if (got < request) {
+		if (ferror(t_stream->m_file)) return false;
+		t_stream->m_eof = true;
+	}
+
+	t_stream->m_current = !t_stream->m_current;
+	t_stream->m_begin = next;
+	t_stream->m_end = next + tail + got;
+	t_stream->m_offset += got;
+
+#ifdef POSIX_FADV_WILLNEED
+	// the kernel reads the following chunk while this one is being parsed
+	if (!t_stream->m_eof) {
+		posix_fadvise(fileno(t_stream->m_file), (off_t)t_stream->m_offset, MATRIX_F32_STREAM_CHUNK,
+					  POSIX_FADV_WILLNEED);
+	}
+#endif
+
+	return true;
+}
+
+/**
+ *	Finds the next data line [*t_line, *t_end), *t_end points at its '\n'. Returns 1 for a line, 0 at the end of the
+ *	file and -1 on a read error or a line longer than a buffer.
+ */
+static int m_matrixf32StreamNextLine(MatrixF32StreamPtr t_stream, const char **t_line, const char **t_end) {
+	for (;;) {
+		char *begin = t_stream->m_begin;
+		char *newline = memchr(begin, '\n', (size_t)(t_stream->m_end - begin));
+
+		if (newline == 0) {
+			if (!t_stream->m_eof) {
+				if (!m_matrixf32StreamFill(t_stream)) return -1;
+				continue;
+			}
+
+			if (begin == t_stream->m_end) return 0;
+
+			// last line without a line break, the buffers have room for one extra byte
+			newline = t_stream->m_end;
+			*newline = '\n';
+			t_stream->m_end = newline + 1;
+		}
+
+		const char *p = begin;
+		while (*p == ' ' || *p == '\t' || *p == '\r') ++p;
+
+		bool skip = p == newline || *p == '#';
+
+		if (!skip && t_stream->m_firstLine) {
+			skip = !(m_matrixf32StreamIsDigit(*p) || *p == '-' || *p == '+' || *p == '.');
+		}
+
+		if (!skip) {
+			t_stream->m_firstLine = false;
+			*t_line = begin;
+			*t_end = newline;
+
+			return 1;
+		}
+
+		if (p != newline) t_stream->m_firstLine = false;
+		t_stream->m_begin = newline + 1;
+	}
+}
+
+static MatrixStatus m_matrixf32StreamReadCSV(MatrixF32StreamPtr t_stream, float *t_dest, size_t t_max_rows,
+											 size_t *t_rows_read) {
+	for (*t_rows_read = 0; *t_rows_read < t_max_rows; ++*t_rows_read) {
+		const char *line, *end;
+		int found = m_matrixf32StreamNextLine(t_stream, &line, &end);
+
+		if (found == 0) break;
+		if (found < 0) return MatrixStatusErrIO;
+
+		if (!m_matrixf32StreamParseRow(line, end, t_dest + *t_rows_read * t_stream->m_col, t_stream->m_col)) {
+			return MatrixStatusErrIO;
+		}
+
+		t_stream->m_begin = (char *)end + 1;
+	}
+
+	return MatrixStatusOK;
+}
+
+static MatrixStatus m_matrixf32StreamReadRaw(MatrixF32StreamPtr t_stream, float *t_dest, size_t t_max_rows,
+											 size_t *t_rows_read) {
+	const size_t count = t_max_rows * t_stream->m_col;
+	const size_t got = fread(t_dest, sizeof(float), count, t_stream->m_file);
+
+	*t_rows_read = got / t_stream->m_col;
+
+	if (!m_matrixf32FileHostIsLittleEndian()) {
+		uint32_t *word = (uint32_t *)t_dest;
+
+		for (size_t i = 0; i < got; ++i) {
+			word[i] = (word[i] >> 24) | ((word[i] >> 8) & 0xFF00u) | ((word[i] << 8) & 0xFF0000u) | (word[i] << 24);
+		}
+	}
+
+	// a truncated last row or a read error
+	if (got < count && (ferror(t_stream->m_file) || got % t_stream->m_col != 0)) return MatrixStatusErrIO;
+
+	return MatrixStatusOK;
+}
+
+static MatrixStatus m_matrixf32StreamReadRows(MatrixF32StreamPtr t_stream, float *t_dest, size_t t_max_rows,
+											  size_t *t_rows_read) {
+	if (t_stream->m_format == MatrixF32StreamCSV) {
+		return m_matrixf32StreamReadCSV(t_stream, t_dest, t_max_rows, t_rows_read);
+	}
+
+	return m_matrixf32StreamReadRaw(t_stream, t_dest, t_max_rows, t_rows_read);
+}
+
+MatrixF32StreamPtr matrixf32StreamOpen(const char *t_path, MatrixF32StreamFormat t_format, size_t t_col) {
+	if (t_path == 0) return 0;
+	if (t_format != MatrixF32StreamCSV && t_format != MatrixF32StreamRaw) return 0;
+	if (t_format == MatrixF32StreamRaw && t_col == 0) return 0;
+
+	MatrixF32StreamPtr stream = MATRIX_F32_MALLOC(sizeof(struct MatrixF32Stream));
+	if (stream == 0) return 0;
+
+	memset(stream, 0, sizeof(*stream));
+	stream->m_format = t_format;
+	stream->m_col = t_col;
+	stream->m_firstLine = true;
+	stream->m_file = fopen(t_path, "rb");
+
+	bool success = stream->m_file != 0;
+
+	if (success && t_format == MatrixF32StreamCSV) {
+		// the buffers replace the stdio buffer, one spare byte terminates a last line without a line break
+		setvbuf(stream->m_file, 0, _IONBF, 0);
+		stream->m_buffer[0] = MATRIX_F32_MALLOC(MATRIX_F32_STREAM_CHUNK + 1);
+		stream->m_buffer[1] = MATRIX_F32_MALLOC(MATRIX_F32_STREAM_CHUNK + 1);
+		stream->m_begin = stream->m_end = stream->m_buffer[0];
+
+		success = stream->m_buffer[0] != 0 && stream->m_buffer[1] != 0;
+
+#ifdef POSIX_FADV_SEQUENTIAL
+		if (success) posix_fadvise(fileno(stream->m_file), 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
+
+		if (success && t_col == 0) {
+			const char *line, *end;
+			success = m_matrixf32StreamNextLine(stream, &line, &end) == 1;
+
+			if (success) {
+				stream->m_col = 1;
+
+				for (const char *p = line; p != end; ++p) {
+					if (*p == ',') stream->m_col++;
+				}
+			}
+		}
+	}
+
+	if (!success) matrixf32StreamClose(&stream);
+
+	return stream;
+}
+
+MatrixStatus matrixf32StreamClose(MatrixF32StreamPtr *t_stream) {
+	if (t_stream == 0 || *t_stream == 0) return MatrixStatusErrNullPtr;
+
+	MatrixF32StreamPtr stream = *t_stream;
+	bool success = stream->m_file == 0 || fclose(stream->m_file) == 0;
+
+	MATRIX_F32_FREE(stream->m_buffer[0]);
+	MATRIX_F32_FREE(stream->m_buffer[1]);
+	MATRIX_F32_FREE(stream);
+	*t_stream = 0;
+
+	return success ? MatrixStatusOK : MatrixStatusErrIO;
+}
+
+size_t matrixf32StreamGetColNumber(MatrixF32StreamPtr t_stream) { return t_stream == 0 ? 0 : t_stream->m_col; }
+
+MatrixStatus matrixf32StreamRead(MatrixF32StreamPtr t_stream, const MatrixF32Ptr t_dest, size_t t_first_row,
+								 size_t *t_rows_read) {
+	size_t rows_read = 0;
+	if (t_rows_read != 0) *t_rows_read = 0;
+
+	if (t_stream == 0 || t_dest == 0 || t_dest->m_val == 0) return MatrixStatusErrNullPtr;
+	if (t_dest->m_col != t_stream->m_col) return MatrixStatusErrDimMismatch;
+	if (!m_matrixf32RowMajorBuffer(t_dest)) return MatrixStatusErrLayout;
+	if (t_first_row > t_dest->m_row) return MatrixStatusErrOutOfBound;
+
+	m_matrixf32Touch(t_dest);
+
+	MatrixStatus ret_val = m_matrixf32StreamReadRows(t_stream, t_dest->m_val + t_first_row * t_dest->m_col,
+													 t_dest->m_row - t_first_row, &rows_read);
+
+	if (t_rows_read != 0) *t_rows_read = rows_read;
+
+	return ret_val;
+}
+
+MatrixStatus matrixf32StreamReadAll(MatrixF32StreamPtr t_stream, MatrixF32Ptr *t_dest) {
+	if (t_dest != 0) *t_dest = 0;
+	if (t_stream == 0 || t_dest == 0) return MatrixStatusErrNullPtr;
+
+	const size_t col = t_stream->m_col;
+	size_t capacity = MATRIX_F32_STREAM_CHUNK / (col * sizeof(float));
+	if (capacity < 16) capacity = 16;
+
+	size_t rows = 0;
+	float *buffer = MATRIX_F32_MALLOC(capacity * col * sizeof(float));
+	MatrixStatus ret_val = buffer != 0 ? MatrixStatusOK : MatrixStatusErrNullPtr;
+
+	while (ret_val == MatrixStatusOK) {
+		if (rows == capacity) {
+			float *grown = MATRIX_F32_MALLOC(2 * capacity * col * sizeof(float));
+
+			if (grown == 0) {
+				ret_val = MatrixStatusErrNullPtr;
+				break;
+			}
+
+			memcpy(grown, buffer, rows * col * sizeof(float));
+			MATRIX_F32_FREE(buffer);
+			buffer = grown;
+			capacity *= 2;
+		}
+
+		size_t rows_read = 0;
+		ret_val = m_matrixf32StreamReadRows(t_stream, buffer + rows * col, capacity - rows, &rows_read);
+		rows += rows_read;
+
+		if (rows < capacity) break;
+	}
+
+	if (ret_val == MatrixStatusOK && rows == 0) ret_val = MatrixStatusErrDimMismatch;
+
+	if (ret_val == MatrixStatusOK) {
+		*t_dest = m_matrixf32CreateContainerFor((MatrixDimType){rows, col}, buffer, MatrixF32OpCreate);
+
+		if (*t_dest != 0) {
+			// the matrix takes over the buffer
+			(*t_dest)->m_addrOwnerShip = OwnerShipSelf;
+
+			return MatrixStatusOK;
+		}
+
+		ret_val = MatrixStatusErrNullPtr;
+	}
+
+	MATRIX_F32_FREE(buffer);
+
+	return ret_val;
+}
@@ -0,0 +1,535 @@
+/**
+ * @Date:   2026-10-20T00:18:33+08:00
+ * @Last modified time: 2026-10-20T00:18:33+08:00
+ */
+
+#include "include/matrix_f32_svd.h"
+#include "src/matrix_f32_private.h"
+
+#include <float.h>
+#include <math.h>
+#include <string.h>
+
+// matrices with at least this many times more rows than columns are reduced by QR first
+#define MATRIX_F32_SVD_QR_RATIO 2
+
+#define MATRIX_F32_SVD_MAX_SWEEPS 40
+
+// entries rotated per round below which the round stays on one thread
+#ifndef MATRIX_F32_SVD_PARALLEL_MIN
+#define MATRIX_F32_SVD_PARALLEL_MIN 16384
+#endif
+
+/**
+ *	Layout of the workspace. The rotations orthogonalize the r rows of m_g, of length m_len: the columns of A, the
+ *	rows of A if it is wide (m_transposed) or the columns of its triangular factor (m_qr). The rows of m_w accumulate
+ *	the same rotations starting from the identity.
+ */
+struct MatrixF32SvdWork {
+	size_t m_row;
+	size_t m_col;
+	size_t m_rank;	// r = min(m, n)
+	size_t m_len;
+	bool m_transposed;
+	bool m_qr;
+
+	float *m_qrFactor;	// m x n, reflectors below the diagonal
+	float *m_tau;		// n
+	float *m_g;			// r x len
+	float *m_w;			// r x r
+	float *m_sigma;		// r
+	float *m_temp;		// max(m, n)
+	float *m_coef;		// r
+};
+
+// private function
+static bool m_matrixf32SvdUseQR(size_t t_row, size_t t_col) { return t_row >= MATRIX_F32_SVD_QR_RATIO * t_col; }
+
+static void m_matrixf32SvdLayout(struct MatrixF32SvdWork *t_work, size_t t_row, size_t t_col, float *t_workspace) {
+	t_work->m_row = t_row;
+	t_work->m_col = t_col;
+	t_work->m_rank = t_row < t_col ? t_row : t_col;
+	t_work->m_transposed = t_row < t_col;
+	t_work->m_qr = m_matrixf32SvdUseQR(t_row, t_col);
+	t_work->m_len = t_work->m_qr ? t_col : (t_row > t_col ? t_row : t_col);
+
+	const size_t r = t_work->m_rank;
+	float *next = t_workspace;
+
+	t_work->m_qrFactor = 0;
+	t_work->m_tau = 0;
+
+	if (t_work->m_qr) {
+		t_work->m_qrFactor = next;
+		t_work->m_tau = next + t_row * t_col;
+		next = t_work->m_tau + t_col;
+	}
+
+	t_work->m_g = next;
+	t_work->m_w = t_work->m_g + r * t_work->m_len;
+	t_work->m_sigma = t_work->m_w + r * r;
+	t_work->m_temp = t_work->m_sigma + r;
+	t_work->m_coef = t_work->m_temp + (t_row > t_col ? t_row : t_col);
+}
+
+/**
+ *	Applies the reflector j of the QR factor to x (length m), H_j = I - tau_j v_j v_j^T
+ */
+static void m_matrixf32SvdReflect(const struct MatrixF32SvdWork *t_work, size_t t_j, float *t_x) {
+	const size_t n = t_work->m_col;
+
+	m_matrixf32HouseholderApplyKernel(t_work->m_row - t_j, t_work->m_tau[t_j], t_work->m_qrFactor + (t_j + 1) * n + t_j,
+									  n, t_x + t_j);
+}
+
+// x = Q x for x of length m, Q = H_0 H_1 ... H_n-1
+static void m_matrixf32SvdApplyQ(const struct MatrixF32SvdWork *t_work, float *t_x) {
+	for (size_t j = t_work->m_col; j-- > 0;) {
+		m_matrixf32SvdReflect(t_work, j, t_x);
+	}
+}
+
+// x = Q^T x for x of length m
+static void m_matrixf32SvdApplyQT(const struct MatrixF32SvdWork *t_work, float *t_x) {
+	for (size_t j = 0; j < t_work->m_col; ++j) {
+		m_matrixf32SvdReflect(t_work, j, t_x);
+	}
+}
+
+// Householder QR of t_source into the workspace, then G = R^T
+static void m_matrixf32SvdQR(struct MatrixF32SvdWork *t_work, const MatrixF32Ptr t_source) {
+	const size_t m = t_work->m_row;
+	const size_t n = t_work->m_col;
+	float *qr = t_work->m_qrFactor;
+	float *column = t_work->m_temp;
+	float *dots = t_work->m_coef;
+
+	memcpy(qr, t_source->m_val, m * n * sizeof(float));
+
+	for (size_t j = 0; j < n; ++j) {
+		for (size_t r = j; r < m; ++r) {
+			column[r] = qr[r * n + j];
+		}
+
+		float beta;
+		const float tau = m_matrixf32HouseholderKernel(column + j, m - j, &beta);
+		t_work->m_tau[j] = tau;
+
+		// dots[c] = v^T A[j:, c] row by row, then A[j:, c] -= tau v dots[c]
+		for (size_t c = j + 1; c < n; ++c) {
+			dots[c] = 0.0f;
+		}
+
+		for (size_t r = j; r < m && tau != 0.0f; ++r) {
+			const float *row = qr + r * n;
+
+			for (size_t c = j + 1; c < n; ++c) {
+				dots[c] += column[r] * row[c];
+			}
+		}
+
+		for (size_t r = j; r < m && tau != 0.0f; ++r) {
+			float *row = qr + r * n;
+			const float scale = tau * column[r];
+
+			for (size_t c = j + 1; c < n; ++c) {
+				row[c] -= scale * dots[c];
+			}
+		}
+
+		qr[j * n + j] = beta;
+
+		for (size_t r = j + 1; r < m; ++r) {
+			qr[r * n + j] = column[r];
+		}
+	}
+
+	for (size_t k = 0; k < n; ++k) {
+		float *g = t_work->m_g + k * n;
+
+		for (size_t i = 0; i < n; ++i) {
+			g[i] = i <= k ? qr[i * n + k] : 0.0f;
+		}
+	}
+}
+
+/**
+ *	Rotates rows i and j of G and W so that they become orthogonal, returns whether a rotation was needed
+ */
+static bool m_matrixf32SvdRotate(const struct MatrixF32SvdWork *t_work, size_t t_i, size_t t_j, float t_tolerance) {
+	const size_t len = t_work->m_len;
+	const size_t r = t_work->m_rank;
+	float *g_i = t_work->m_g + t_i * len;
+	float *g_j = t_work->m_g + t_j * len;
+	float alpha = 0.0f, beta = 0.0f, gamma = 0.0f;
+
+	for (size_t k = 0; k < len; ++k) {
+		alpha += g_i[k] * g_i[k];
+		beta += g_j[k] * g_j[k];
+		gamma += g_i[k] * g_j[k];
+	}
+
+	if (gamma == 0.0f || fabsf(gamma) <= t_tolerance * sqrtf(alpha) * sqrtf(beta)) return false;
+
+	const float zeta = (beta - alpha) / (2.0f * gamma);
+	const float t = copysignf(1.0f, zeta) / (fabsf(zeta) + sqrtf(1.0f + zeta * zeta));
+	const float c = 1.0f / sqrtf(1.0f + t * t);
+	const float s = c * t;
+
+	for (size_t k = 0; k < len; ++k) {
+		const float x = g_i[k];
+		const float y = g_j[k];
+		g_i[k] = c * x - s * y;
+		g_j[k] = s * x + c * y;
+	}
+
+	float *w_i = t_work->m_w + t_i * r;
+	float *w_j = t_work->m_w + t_j * r;
+
+	for (size_t k = 0; k < r; ++k) {
+		const float x = w_i[k];
+		const float y = w_j[k];
+		w_i[k] = c * x - s * y;
+		w_j[k] = s * x + c * y;
+	}
+
+	return true;
+}
+
+/**
+ *	Sweeps over all pairs in round-robin order until no pair needs a rotation. Position p - 1 stays fixed while the
+ *	others rotate, so every round is a set of disjoint pairs, an odd r gets a dummy position.
+ */
+static bool m_matrixf32SvdJacobi(const struct MatrixF32SvdWork *t_work) {
+	const size_t r = t_work->m_rank;
+	const size_t players = r + (r & 1);
+	const float tolerance = sqrtf((float)t_work->m_len) * FLT_EPSILON;
+
+	if (r < 2) return true;
+
+	for (size_t sweep = 0; sweep < MATRIX_F32_SVD_MAX_SWEEPS; ++sweep) {
+		int rotated = 0;
+
+		for (size_t round = 0; round + 1 < players; ++round) {
+			const size_t pairs = players / 2;
+
+#ifdef _OPENMP
+#pragma omp parallel for reduction(| : rotated) if (pairs * t_work->m_len > MATRIX_F32_SVD_PARALLEL_MIN)
+#endif
+			for (size_t q = 0; q < pairs; ++q) {
+				size_t first = q == 0 ? players - 1 : (round + q) % (players - 1);
+				size_t second = q == 0 ? round : (round + players - 1 - q) % (players - 1);
+
+				if (first >= r || second >= r) continue;
+
+				if (first > second) {
+					const size_t swap = first;
+					first = second;
+					second = swap;
+				}
+
+				rotated |= m_matrixf32SvdRotate(t_work, first, second, tolerance);
+			}
+		}
+
+		if (!rotated) return true;
+	}
+
+	return false;
+}
+
+/**
+ *	Computes G, W and the singular values in descending order, G and W rows permuted alike
+ */
+static MatrixStatus m_matrixf32SvdFactor(struct MatrixF32SvdWork *t_work, const MatrixF32Ptr t_source) {
+	const size_t m = t_work->m_row;
+	const size_t n = t_work->m_col;
+	const size_t r = t_work->m_rank;
+	const size_t len = t_work->m_len;
+	float *g = t_work->m_g;
+	float *w = t_work->m_w;
+	float *sigma = t_work->m_sigma;
+
+	if (t_work->m_qr) {
+		m_matrixf32SvdQR(t_work, t_source);
+	} else if (t_work->m_transposed) {
+		memcpy(g, t_source->m_val, m * n * sizeof(float));
+	} else {
+		for (size_t k = 0; k < n; ++k) {
+			for (size_t i = 0; i < m; ++i) {
+				g[k * m + i] = t_source->m_val[i * n + k];
+			}
+		}
+	}
+
+	memset(w, 0, r * r * sizeof(float));
+
+	for (size_t k = 0; k < r; ++k) {
+		w[k * r + k] = 1.0f;
+	}
+
+	if (!m_matrixf32SvdJacobi(t_work)) return MatrixStatusErrSingular;
+
+	for (size_t k = 0; k < r; ++k) {
+		float norm = 0.0f;
+
+		for (size_t i = 0; i < len; ++i) {
+			norm += g[k * len + i] * g[k * len + i];
+		}
+
+		sigma[k] = sqrtf(norm);
+	}
+
+	for (size_t k = 0; k < r; ++k) {
+		size_t largest = k;
+
+		for (size_t i = k + 1; i < r; ++i) {
+			if (sigma[i] > sigma[largest]) largest = i;
+		}
+
+		if (largest == k) continue;
+
+		const float swap = sigma[k];
+		sigma[k] = sigma[largest];
+		sigma[largest] = swap;
+
+		for (size_t i = 0; i < len; ++i) {
+			const float swap_g = g[k * len + i];
+			g[k * len + i] = g[largest * len + i];
+			g[largest * len + i] = swap_g;
+		}
+
+		for (size_t i = 0; i < r; ++i) {
+			const float swap_w = w[k * r + i];
+			w[k * r + i] = w[largest * r + i];
+			w[largest * r + i] = swap_w;
+		}
+	}
+
+	return MatrixStatusOK;
+}
+
+// 1 / sigma^2 of the kept singular values, 0 for the truncated ones, into m_coef
+static void m_matrixf32SvdInverseSquares(const struct MatrixF32SvdWork *t_work, float t_tolerance) {
+	const size_t r = t_work->m_rank;
+	const size_t longest = t_work->m_row > t_work->m_col ? t_work->m_row : t_work->m_col;
+	const float relative = t_tolerance > 0.0f ? t_tolerance : (float)longest * FLT_EPSILON;
+	const float cutoff = relative * t_work->m_sigma[0];
+
+	for (size_t k = 0; k < r; ++k) {
+		const float sigma = t_work->m_sigma[k];
+
+		t_work->m_coef[k] = sigma > cutoff && sigma > 0.0f ? 1.0f / (sigma * sigma) : 0.0f;
+	}
+}
+
+static MatrixStatus m_matrixf32SvdBegin(struct MatrixF32SvdWork *t_work, const MatrixF32Ptr t_source,
+										float *t_workspace, size_t t_workspace_len) {
+	if (t_source->m_val == 0) return MatrixStatusErrNullPtr;
+	if (t_workspace_len < matrixf32SvdWorkspaceLen(t_source->m_row, t_source->m_col)) {
+		return MatrixStatusErrOutOfBound;
+	}
+
+	m_matrixf32SvdLayout(t_work, t_source->m_row, t_source->m_col, t_workspace);
+
+	return m_matrixf32SvdFactor(t_work, t_source);
+}
+
+size_t matrixf32SvdWorkspaceLen(size_t t_row, size_t t_col) {
+	if (t_row == 0 || t_col == 0) return 0;
+
+	const size_t r = t_row < t_col ? t_row : t_col;
+	const size_t longest = t_row > t_col ? t_row : t_col;
+
+	if (m_matrixf32SvdUseQR(t_row, t_col)) return t_row * t_col + t_col + 2 * t_col * t_col + 2 * t_col + t_row;
+
+	return r * longest + r * r + 2 * r + longest;
+}
+
+MatrixStatus matrixf32Svd(const MatrixF32Ptr t_u, const MatrixF32Ptr t_s, const MatrixF32Ptr t_v,
+						  const MatrixF32Ptr t_source, float *t_workspace, size_t t_workspace_len) {
+	if (t_s == 0 || t_source == 0 || t_workspace == 0) return MatrixStatusErrNullPtr;
+	if (t_s->m_val == 0 || (t_u != 0 && t_u->m_val == 0) || (t_v != 0 && t_v->m_val == 0)) {
+		return MatrixStatusErrNullPtr;
+	}
+
+	const size_t m = t_source->m_row;
+	const size_t n = t_source->m_col;
+	const size_t r = m < n ? m : n;
+	bool dim_not_matched = t_s->m_row != r || t_s->m_col != 1 || (t_u != 0 && (t_u->m_row != m || t_u->m_col != r)) ||
+						   (t_v != 0 && (t_v->m_row != n || t_v->m_col != r));
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+	bool row_major = m_matrixf32RowMajorBuffer(t_u) && m_matrixf32RowMajorBuffer(t_v) &&
+					 m_matrixf32RowMajorBuffer(t_source);
+	if (!row_major) return MatrixStatusErrLayout;
+
+	struct MatrixF32SvdWork work;
+	MatrixStatus status = m_matrixf32SvdBegin(&work, t_source, t_workspace, t_workspace_len);
+	if (status != MatrixStatusOK) return status;
+
+	const size_t len = work.m_len;
+
+	m_matrixf32Touch(t_s);
+	memcpy(t_s->m_val, work.m_sigma, r * sizeof(float));
+
+	// the normalized rows of G are the singular vectors on the long side, the rows of W those on the short side
+	const MatrixF32Ptr long_side = work.m_transposed ? t_v : t_u;
+	const MatrixF32Ptr short_side = work.m_transposed ? t_u : t_v;
+
+	if (short_side != 0) {
+		m_matrixf32Touch(short_side);
+
+		for (size_t k = 0; k < r; ++k) {
+			for (size_t i = 0; i < r; ++i) {
+				short_side->m_val[i * r + k] = work.m_w[k * r + i];
+			}
+		}
+	}
+
+	if (long_side != 0) {
+		m_matrixf32Touch(long_side);
+
+		const size_t rows = long_side->m_row;
+		float *vector = work.m_temp;
+
+		for (size_t k = 0; k < r; ++k) {
+			const float scale = work.m_sigma[k] > 0.0f ? 1.0f / work.m_sigma[k] : 0.0f;
+
+			for (size_t i = 0; i < rows; ++i) {
+				vector[i] = i < len ? scale * work.m_g[k * len + i] : 0.0f;
+			}
+
+			if (work.m_qr && scale != 0.0f) m_matrixf32SvdApplyQ(&work, vector);
+
+			for (size_t i = 0; i < rows; ++i) {
+				long_side->m_val[i * r + k] = vector[i];
+			}
+		}
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32PseudoInverse(const MatrixF32Ptr t_result, const MatrixF32Ptr t_source, float t_tolerance,
+									float *t_workspace, size_t t_workspace_len) {
+	if (t_result == 0 || t_source == 0 || t_workspace == 0 || t_result->m_val == 0) return MatrixStatusErrNullPtr;
+
+	const size_t m = t_source->m_row;
+	const size_t n = t_source->m_col;
+	if (t_result->m_row != n || t_result->m_col != m) return MatrixStatusErrDimMismatch;
+	if (!m_matrixf32RowMajorBuffer(t_result) || !m_matrixf32RowMajorBuffer(t_source)) return MatrixStatusErrLayout;
+
+	struct MatrixF32SvdWork work;
+	MatrixStatus status = m_matrixf32SvdBegin(&work, t_source, t_workspace, t_workspace_len);
+	if (status != MatrixStatusOK) return status;
+
+	m_matrixf32Touch(t_result);
+	m_matrixf32SvdInverseSquares(&work, t_tolerance);
+	memset(t_result->m_val, 0, n * m * sizeof(float));
+
+	const size_t r = work.m_rank;
+	const size_t len = work.m_len;
+
+	// sum over k of the outer products of a_k = W row k and b_k = g_k / sigma_k^2, or the other way round if wide
+	for (size_t k = 0; k < r; ++k) {
+		const float coef = work.m_coef[k];
+		if (coef == 0.0f) continue;
+
+		const float *g = work.m_g + k * len;
+		const float *w = work.m_w + k * r;
+
+		for (size_t i = 0; i < n; ++i) {
+			float *row = t_result->m_val + i * m;
+
+			if (work.m_transposed) {
+				const float scale = coef * g[i];
+
+				for (size_t l = 0; l < m; ++l) {
+					row[l] += scale * w[l];
+				}
+			} else {
+				const float scale = coef * w[i];
+
+				for (size_t l = 0; l < len; ++l) {
+					row[l] += scale * g[l];
+				}
+			}
+		}
+	}
+
+	// rows of [V S^+ U_R^T, 0] Q^T are Q times the rows
+	for (size_t i = 0; work.m_qr && i < n; ++i) {
+		m_matrixf32SvdApplyQ(&work, t_result->m_val + i * m);
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32LeastSquares(const MatrixF32Ptr t_result, const MatrixF32Ptr t_mat_a,
+								   const MatrixF32Ptr t_column, float t_tolerance, float *t_workspace,
+								   size_t t_workspace_len) {
+	if (t_result == 0 || t_mat_a == 0 || t_column == 0 || t_workspace == 0) return MatrixStatusErrNullPtr;
+	if (t_result->m_val == 0 || t_column->m_val == 0) return MatrixStatusErrNullPtr;
+
+	const size_t m = t_mat_a->m_row;
+	const size_t n = t_mat_a->m_col;
+	const size_t columns = t_column->m_col;
+	bool dim_not_matched = t_column->m_row != m || t_result->m_row != n || t_result->m_col != columns;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+	bool row_major = m_matrixf32RowMajorBuffer(t_result) && m_matrixf32RowMajorBuffer(t_mat_a) &&
+					 m_matrixf32RowMajorBuffer(t_column);
+	if (!row_major) return MatrixStatusErrLayout;
+
+	struct MatrixF32SvdWork work;
+	MatrixStatus status = m_matrixf32SvdBegin(&work, t_mat_a, t_workspace, t_workspace_len);
+	if (status != MatrixStatusOK) return status;
+
+	m_matrixf32Touch(t_result);
+	m_matrixf32SvdInverseSquares(&work, t_tolerance);
+
+	const size_t r = work.m_rank;
+	const size_t len = work.m_len;
+	float *b = work.m_temp;
+
+	for (size_t c = 0; c < columns; ++c) {
+		for (size_t i = 0; i < m; ++i) {
+			b[i] = t_column->m_val[i * columns + c];
+		}
+
+		if (work.m_qr) m_matrixf32SvdApplyQT(&work, b);
+
+		for (size_t i = 0; i < n; ++i) {
+			t_result->m_val[i * columns + c] = 0.0f;
+		}
+
+		for (size_t k = 0; k < r; ++k) {
+			const float coef = work.m_coef[k];
+			if (coef == 0.0f) continue;
+
+			const float *g = work.m_g + k * len;
+			const float *w = work.m_w + k * r;
+			float dot = 0.0f;
+
+			// x = sum of W_k (g_k . b) / sigma_k^2, or g_k (W_k . b) / sigma_k^2 if wide
+			if (work.m_transposed) {
+				for (size_t l = 0; l < m; ++l) {
+					dot += w[l] * b[l];
+				}
+
+				for (size_t i = 0; i < n; ++i) {
+					t_result->m_val[i * columns + c] += coef * dot * g[i];
+				}
+			} else {
+				for (size_t l = 0; l < len; ++l) {
+					dot += g[l] * b[l];
+				}
+
+				for (size_t i = 0; i < n; ++i) {
+					t_result->m_val[i * columns + c] += coef * dot * w[i];
+				}
+			}
+		}
+	}
+
+	return MatrixStatusOK;
+}
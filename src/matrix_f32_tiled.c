@@ -0,0 +1,650 @@
+/**
+ * @Date:   2026-10-19T16:45:37+08:00
+ * @Last modified time: 2026-10-19T16:45:37+08:00
+ */
+
+#include "include/matrix_f32_file.h"
+#include "include/matrix_f32_tiled.h"
+#include "src/matrix_f32_private.h"
+
+#include <math.h>
+#include <string.h>
+
+size_t matrixf32TiledSuggestTileSize(size_t t_memory_bytes) {
+	size_t tile = (size_t)sqrt((double)t_memory_bytes / (3.0 * sizeof(float)));
+	tile -= tile % 16;
+
+	return tile < 16 ? 16 : tile;
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+typedef struct TileSlot {
+	size_t m_tileRow;
+	size_t m_tileCol;
+	size_t m_rows;
+	size_t m_cols;
+
+	float *m_val;  // m_rows x m_cols, contiguous
+
+	uint64_t m_lastUse;
+	unsigned m_pin;
+	bool m_valid;
+	bool m_dirty;
+} TileSlotType;
+
+struct MatrixF32Tiled {
+	int m_fd;
+	MatrixF32FileHeaderType m_header;
+
+	size_t m_row;
+	size_t m_col;
+	size_t m_tile;
+
+	TileSlotType *m_slot;
+	size_t m_slotCount;
+	float *m_slotBuffer;
+	uint64_t m_clock;
+
+	bool m_modified;
+	MatrixF32TiledIOType m_io;
+};
+
+// private function
+static bool m_matrixf32TiledPread(MatrixF32TiledPtr t_tiled, void *t_buf, size_t t_len, uint64_t t_offset) {
+	char *buf = t_buf;
+
+	while (t_len > 0) {
+		ssize_t done = pread(t_tiled->m_fd, buf, t_len, (off_t)t_offset);
+		if (done <= 0) return false;
+
+		buf += done;
+		t_len -= (size_t)done;
+		t_offset += (uint64_t)done;
+		t_tiled->m_io.m_bytesRead += (uint64_t)done;
+	}
+
+	return true;
+}
+
+static bool m_matrixf32TiledPwrite(MatrixF32TiledPtr t_tiled, const void *t_buf, size_t t_len, uint64_t t_offset) {
+	const char *buf = t_buf;
+
+	while (t_len > 0) {
+		ssize_t done = pwrite(t_tiled->m_fd, buf, t_len, (off_t)t_offset);
+		if (done <= 0) return false;
+
+		buf += done;
+		t_len -= (size_t)done;
+		t_offset += (uint64_t)done;
+		t_tiled->m_io.m_bytesWritten += (uint64_t)done;
+	}
+
+	return true;
+}
+
+static inline uint64_t m_matrixf32TiledOffset(MatrixF32TiledPtr t_tiled, size_t t_row, size_t t_col) {
+	return t_tiled->m_header.m_payloadOffset + ((uint64_t)t_row * t_tiled->m_col + t_col) * sizeof(float);
+}
+
+// rows of a file block are contiguous in the file, a block is transferred one row segment at a time
+static bool m_matrixf32TiledReadBlock(MatrixF32TiledPtr t_tiled, size_t t_row, size_t t_col, size_t t_rows,
+									  size_t t_cols, float *t_buf, size_t t_ld) {
+	for (size_t i = 0; i < t_rows; ++i) {
+		if (!m_matrixf32TiledPread(t_tiled, t_buf + i * t_ld, t_cols * sizeof(float),
+								   m_matrixf32TiledOffset(t_tiled, t_row + i, t_col))) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static bool m_matrixf32TiledWriteBlock(MatrixF32TiledPtr t_tiled, size_t t_row, size_t t_col, size_t t_rows,
+									   size_t t_cols, const float *t_buf, size_t t_ld) {
+	for (size_t i = 0; i < t_rows; ++i) {
+		if (!m_matrixf32TiledPwrite(t_tiled, t_buf + i * t_ld, t_cols * sizeof(float),
+									m_matrixf32TiledOffset(t_tiled, t_row + i, t_col))) {
+			return false;
+		}
+	}
+
+	t_tiled->m_modified = true;
+
+	return true;
+}
+
+static inline size_t m_matrixf32TiledExtent(size_t t_total, size_t t_tile, size_t t_index) {
+	size_t begin = t_index * t_tile;
+
+	return (t_total - begin) < t_tile ? t_total - begin : t_tile;
+}
+
+static inline size_t m_matrixf32TiledCount(size_t t_total, size_t t_tile) { return (t_total + t_tile - 1) / t_tile; }
+
+static bool m_matrixf32TiledWriteBack(MatrixF32TiledPtr t_tiled, TileSlotType *t_slot) {
+	if (!t_slot->m_valid || !t_slot->m_dirty) return true;
+
+	if (!m_matrixf32TiledWriteBlock(t_tiled, t_slot->m_tileRow * t_tiled->m_tile, t_slot->m_tileCol * t_tiled->m_tile,
+									t_slot->m_rows, t_slot->m_cols, t_slot->m_val, t_slot->m_cols)) {
+		return false;
+	}
+
+	t_slot->m_dirty = false;
+
+	return true;
+}
+
+/**
+ *	Returns the pinned slot holding the tile, the least recently used unpinned slot is evicted (and written back if it
+ *	is dirty) on a miss. Without t_load the tile is zero filled instead of read, cached or not, for tiles that are
+ *	about to be overwritten.
+ */
+static TileSlotType *m_matrixf32TiledAcquire(MatrixF32TiledPtr t_tiled, size_t t_tile_row, size_t t_tile_col,
+											 bool t_load) {
+	TileSlotType *victim = 0;
+
+	for (size_t i = 0; i < t_tiled->m_slotCount; ++i) {
+		TileSlotType *slot = &t_tiled->m_slot[i];
+
+		if (slot->m_valid && slot->m_tileRow == t_tile_row && slot->m_tileCol == t_tile_col) {
+			if (!t_load) {
+				memset(slot->m_val, 0, slot->m_rows * slot->m_cols * sizeof(float));
+				slot->m_dirty = true;
+			}
+
+			slot->m_pin++;
+			slot->m_lastUse = ++t_tiled->m_clock;
+
+			return slot;
+		}
+
+		if (slot->m_pin == 0) {
+			bool better = victim == 0 || (victim->m_valid && !slot->m_valid) ||
+						  (victim->m_valid == slot->m_valid && slot->m_lastUse < victim->m_lastUse);
+			if (better) victim = slot;
+		}
+	}
+
+	if (victim == 0 || !m_matrixf32TiledWriteBack(t_tiled, victim)) return 0;
+
+	victim->m_valid = false;
+	victim->m_tileRow = t_tile_row;
+	victim->m_tileCol = t_tile_col;
+	victim->m_rows = m_matrixf32TiledExtent(t_tiled->m_row, t_tiled->m_tile, t_tile_row);
+	victim->m_cols = m_matrixf32TiledExtent(t_tiled->m_col, t_tiled->m_tile, t_tile_col);
+
+	if (t_load) {
+		if (!m_matrixf32TiledReadBlock(t_tiled, t_tile_row * t_tiled->m_tile, t_tile_col * t_tiled->m_tile,
+									   victim->m_rows, victim->m_cols, victim->m_val, victim->m_cols)) {
+			return 0;
+		}
+	} else {
+		memset(victim->m_val, 0, victim->m_rows * victim->m_cols * sizeof(float));
+	}
+
+	victim->m_valid = true;
+	victim->m_dirty = !t_load;
+	victim->m_pin = 1;
+	victim->m_lastUse = ++t_tiled->m_clock;
+
+	return victim;
+}
+
+static inline void m_matrixf32TiledRelease(TileSlotType *t_slot, bool t_dirty) {
+	t_slot->m_pin--;
+	t_slot->m_dirty |= t_dirty;
+}
+
+// read-ahead, asks the kernel to start reading the tile while the current one is being computed
+static void m_matrixf32TiledPrefetch(MatrixF32TiledPtr t_tiled, size_t t_tile_row, size_t t_tile_col) {
+#ifdef POSIX_FADV_WILLNEED
+	for (size_t i = 0; i < t_tiled->m_slotCount; ++i) {
+		const TileSlotType *slot = &t_tiled->m_slot[i];
+		if (slot->m_valid && slot->m_tileRow == t_tile_row && slot->m_tileCol == t_tile_col) return;
+	}
+
+	const size_t rows = m_matrixf32TiledExtent(t_tiled->m_row, t_tiled->m_tile, t_tile_row);
+	const size_t cols = m_matrixf32TiledExtent(t_tiled->m_col, t_tiled->m_tile, t_tile_col);
+
+	for (size_t i = 0; i < rows; ++i) {
+		const uint64_t offset =
+			m_matrixf32TiledOffset(t_tiled, t_tile_row * t_tiled->m_tile + i, t_tile_col * t_tiled->m_tile);
+		posix_fadvise(t_tiled->m_fd, (off_t)offset, (off_t)(cols * sizeof(float)), POSIX_FADV_WILLNEED);
+	}
+#else
+	(void)t_tiled;
+	(void)t_tile_row;
+	(void)t_tile_col;
+#endif
+}
+
+static bool m_matrixf32TiledFlush(MatrixF32TiledPtr t_tiled) {
+	for (size_t i = 0; i < t_tiled->m_slotCount; ++i) {
+		if (!m_matrixf32TiledWriteBack(t_tiled, &t_tiled->m_slot[i])) return false;
+	}
+
+	return true;
+}
+
+static bool m_matrixf32TiledInvalidate(MatrixF32TiledPtr t_tiled) {
+	if (!m_matrixf32TiledFlush(t_tiled)) return false;
+
+	for (size_t i = 0; i < t_tiled->m_slotCount; ++i) {
+		t_tiled->m_slot[i].m_valid = false;
+	}
+
+	return true;
+}
+
+static MatrixF32TiledPtr m_matrixf32TiledInit(int t_fd, const MatrixF32FileHeaderType *t_header, size_t t_tile,
+											  size_t t_cache_tiles) {
+	MatrixF32TiledPtr tiled = MATRIX_F32_MALLOC(sizeof(struct MatrixF32Tiled));
+	if (tiled == 0) return 0;
+
+	memset(tiled, 0, sizeof(*tiled));
+	tiled->m_fd = t_fd;
+	tiled->m_header = *t_header;
+	tiled->m_row = t_header->m_row;
+	tiled->m_col = t_header->m_col;
+	tiled->m_tile = t_tile;
+	tiled->m_slotCount = t_cache_tiles;
+	tiled->m_slot = MATRIX_F32_MALLOC(t_cache_tiles * sizeof(TileSlotType));
+	tiled->m_slotBuffer = MATRIX_F32_MALLOC(t_cache_tiles * t_tile * t_tile * sizeof(float));
+
+	if (tiled->m_slot == 0 || tiled->m_slotBuffer == 0) {
+		MATRIX_F32_FREE(tiled->m_slot);
+		MATRIX_F32_FREE(tiled->m_slotBuffer);
+		MATRIX_F32_FREE(tiled);
+
+		return 0;
+	}
+
+	memset(tiled->m_slot, 0, t_cache_tiles * sizeof(TileSlotType));
+	for (size_t i = 0; i < t_cache_tiles; ++i) {
+		tiled->m_slot[i].m_val = tiled->m_slotBuffer + i * t_tile * t_tile;
+	}
+
+	return tiled;
+}
+
+MatrixF32TiledPtr matrixf32TiledCreate(const char *t_path, MatrixDimType t_dim, size_t t_tile, size_t t_cache_tiles) {
+	if (t_path == 0 || t_dim.m_row == 0 || t_dim.m_col == 0 || t_tile == 0 || t_cache_tiles < 2) return 0;
+	if (!m_matrixf32FileHostIsLittleEndian()) return 0;
+
+	MatrixF32FileHeaderType header;
+	memset(&header, 0, sizeof(header));
+	memcpy(header.m_magic, m_matrixf32FileMagic, sizeof(header.m_magic));
+	header.m_version = MATRIX_F32_FILE_VERSION;
+	header.m_headerSize = sizeof(header);
+	header.m_alignment = MATRIX_F32_FILE_ALIGNMENT;
+	header.m_row = t_dim.m_row;
+	header.m_col = t_dim.m_col;
+	header.m_stride = t_dim.m_col;
+	header.m_payloadOffset = sizeof(header);
+	header.m_checksum = 0;	// checksum of an all zero payload
+
+	int fd = open(t_path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0) return 0;
+
+	const uint64_t file_size = header.m_payloadOffset + (uint64_t)t_dim.m_row * t_dim.m_col * sizeof(float);
+	MatrixF32TiledPtr tiled = 0;
+
+	// the payload is left sparse, unwritten blocks read as zero
+	if (ftruncate(fd, (off_t)file_size) == 0 && pwrite(fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header)) {
+		tiled = m_matrixf32TiledInit(fd, &header, t_tile, t_cache_tiles);
+	}
+
+	if (tiled == 0) close(fd);
+
+	return tiled;
+}
+
+MatrixF32TiledPtr matrixf32TiledOpen(const char *t_path, size_t t_tile, size_t t_cache_tiles) {
+	if (t_path == 0 || t_tile == 0 || t_cache_tiles < 2) return 0;
+	if (!m_matrixf32FileHostIsLittleEndian()) return 0;
+
+	int fd = open(t_path, O_RDWR);
+	if (fd < 0) return 0;
+
+	MatrixF32FileHeaderType header;
+	struct stat file_stat;
+	MatrixF32TiledPtr tiled = 0;
+
+	if (pread(fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header) && fstat(fd, &file_stat) == 0 &&
+		m_matrixf32FileHeaderValid(&header, (uint64_t)file_stat.st_size)) {
+		tiled = m_matrixf32TiledInit(fd, &header, t_tile, t_cache_tiles);
+	}
+
+	if (tiled == 0) close(fd);
+
+	return tiled;
+}
+
+// streams the payload through the tile cache buffer to recompute the checksum
+static bool m_matrixf32TiledUpdateChecksum(MatrixF32TiledPtr t_tiled) {
+	const size_t chunk = t_tiled->m_slotCount * t_tiled->m_tile * t_tiled->m_tile;
+	const uint64_t total = (uint64_t)t_tiled->m_row * t_tiled->m_col;
+	uint64_t checksum = 0;
+
+	for (uint64_t begin = 0; begin < total; begin += chunk) {
+		const size_t count = (total - begin) < chunk ? (size_t)(total - begin) : chunk;
+
+		if (!m_matrixf32TiledPread(t_tiled, t_tiled->m_slotBuffer, count * sizeof(float),
+								   t_tiled->m_header.m_payloadOffset + begin * sizeof(float))) {
+			return false;
+		}
+
+		checksum = m_matrixf32FileChecksum(checksum, t_tiled->m_slotBuffer, count);
+	}
+
+	t_tiled->m_header.m_checksum = checksum;
+
+	return pwrite(t_tiled->m_fd, &t_tiled->m_header, sizeof(t_tiled->m_header), 0) ==
+		   (ssize_t)sizeof(t_tiled->m_header);
+}
+
+MatrixStatus matrixf32TiledClose(MatrixF32TiledPtr *t_tiled) {
+	if (t_tiled == 0 || *t_tiled == 0) return MatrixStatusErrNullPtr;
+
+	MatrixF32TiledPtr tiled = *t_tiled;
+	bool success = m_matrixf32TiledInvalidate(tiled);
+
+	if (success && tiled->m_modified) success = m_matrixf32TiledUpdateChecksum(tiled);
+	if (close(tiled->m_fd) != 0) success = false;
+
+	MATRIX_F32_FREE(tiled->m_slot);
+	MATRIX_F32_FREE(tiled->m_slotBuffer);
+	MATRIX_F32_FREE(tiled);
+	*t_tiled = 0;
+
+	return success ? MatrixStatusOK : MatrixStatusErrIO;
+}
+
+MatrixDimType matrixf32TiledGetDim(MatrixF32TiledPtr t_tiled) {
+	if (t_tiled == 0) return (MatrixDimType){0, 0};
+
+	return (MatrixDimType){t_tiled->m_row, t_tiled->m_col};
+}
+
+MatrixF32TiledIOType matrixf32TiledGetIO(MatrixF32TiledPtr t_tiled) {
+	if (t_tiled == 0) return (MatrixF32TiledIOType){0, 0};
+
+	return t_tiled->m_io;
+}
+
+MatrixStatus matrixf32TiledMultiplication(const MatrixF32TiledPtr t_result, const MatrixF32TiledPtr t_mat_b,
+										  const MatrixF32TiledPtr t_mat_c) {
+	if (t_result == 0 || t_mat_b == 0 || t_mat_c == 0) return MatrixStatusErrNullPtr;
+
+	bool dim_not_matched = t_mat_b->m_col != t_mat_c->m_row || t_result->m_row != t_mat_b->m_row ||
+						   t_result->m_col != t_mat_c->m_col || t_result->m_tile != t_mat_b->m_tile ||
+						   t_result->m_tile != t_mat_c->m_tile;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+	if (t_result == t_mat_b || t_result == t_mat_c) return MatrixStatusErrUnknownOpt;
+
+	const size_t tile = t_result->m_tile;
+	const size_t tiles_m = m_matrixf32TiledCount(t_result->m_row, tile);
+	const size_t tiles_n = m_matrixf32TiledCount(t_result->m_col, tile);
+	const size_t tiles_k = m_matrixf32TiledCount(t_mat_b->m_col, tile);
+
+	for (size_t i = 0; i < tiles_m; ++i) {
+		for (size_t j = 0; j < tiles_n; ++j) {
+			// the result tile starts from zero, even when it is still cached from an earlier call, and is never read
+			TileSlotType *c_tile = m_matrixf32TiledAcquire(t_result, i, j, false);
+			if (c_tile == 0) return MatrixStatusErrIO;
+
+			for (size_t k = 0; k < tiles_k; ++k) {
+				if (k + 1 < tiles_k) {
+					m_matrixf32TiledPrefetch(t_mat_b, i, k + 1);
+					m_matrixf32TiledPrefetch(t_mat_c, k + 1, j);
+				}
+
+				TileSlotType *a_tile = m_matrixf32TiledAcquire(t_mat_b, i, k, true);
+				TileSlotType *b_tile = a_tile != 0 ? m_matrixf32TiledAcquire(t_mat_c, k, j, true) : 0;
+
+				if (b_tile == 0) {
+					if (a_tile != 0) m_matrixf32TiledRelease(a_tile, false);
+					m_matrixf32TiledRelease(c_tile, true);
+
+					return MatrixStatusErrIO;
+				}
+
+				m_matrixf32GemmKernel(c_tile->m_rows, c_tile->m_cols, a_tile->m_cols, 1.0f, a_tile->m_val,
+									  a_tile->m_cols, b_tile->m_val, b_tile->m_cols, true, c_tile->m_val,
+									  c_tile->m_cols);
+
+				m_matrixf32TiledRelease(a_tile, false);
+				m_matrixf32TiledRelease(b_tile, false);
+			}
+
+			// write-behind, the finished tile stays cached until it is evicted
+			m_matrixf32TiledRelease(c_tile, true);
+		}
+	}
+
+	return m_matrixf32TiledFlush(t_result) ? MatrixStatusOK : MatrixStatusErrIO;
+}
+
+static inline void m_matrixf32TiledSwapRows(float *t_buf, size_t t_ld, size_t t_cols, size_t t_a, size_t t_b) {
+	float *row_a = t_buf + t_a * t_ld;
+	float *row_b = t_buf + t_b * t_ld;
+
+	for (size_t i = 0; i < t_cols; ++i) {
+		float temp = row_a[i];
+		row_a[i] = row_b[i];
+		row_b[i] = temp;
+	}
+}
+
+// applies the interchanges of the block column to the columns left of it, directly on the file
+static bool m_matrixf32TiledSwapLeft(MatrixF32TiledPtr t_tiled, const size_t *t_pivot, size_t t_first, size_t t_count,
+									 float *t_row_buffer) {
+	const size_t cols = t_first;
+
+	for (size_t j = t_first; j < t_first + t_count; ++j) {
+		if (t_pivot[j] == j) continue;
+
+		bool success = m_matrixf32TiledReadBlock(t_tiled, j, 0, 1, cols, t_row_buffer, cols) &&
+					   m_matrixf32TiledReadBlock(t_tiled, t_pivot[j], 0, 1, cols, t_row_buffer + cols, cols) &&
+					   m_matrixf32TiledWriteBlock(t_tiled, t_pivot[j], 0, 1, cols, t_row_buffer, cols) &&
+					   m_matrixf32TiledWriteBlock(t_tiled, j, 0, 1, cols, t_row_buffer + cols, cols);
+		if (!success) return false;
+	}
+
+	return true;
+}
+
+/**
+ *	Left-looking blocked LU. Block column p is loaded as a whole, updated with the factors of the block columns
+ *	left of it, which are streamed through the tile cache, then factored in memory and written back.
+ */
+static MatrixStatus m_matrixf32TiledFactor(MatrixF32TiledPtr t_tiled, size_t *t_pivot, float *t_panel,
+										   float *t_row_buffer) {
+	const size_t n = t_tiled->m_row;
+	const size_t tile = t_tiled->m_tile;
+	const size_t tiles = m_matrixf32TiledCount(n, tile);
+
+	for (size_t p = 0; p < tiles; ++p) {
+		const size_t first = p * tile;
+		const size_t width = m_matrixf32TiledExtent(n, tile, p);
+
+		if (!m_matrixf32TiledReadBlock(t_tiled, 0, first, n, width, t_panel, width)) return MatrixStatusErrIO;
+
+		for (size_t j = 0; j < first; ++j) {
+			if (t_pivot[j] != j) m_matrixf32TiledSwapRows(t_panel, width, width, j, t_pivot[j]);
+		}
+
+		for (size_t q = 0; q < p; ++q) {
+			const size_t top = q * tile;
+
+			// U(q, p) = L(q, q)^-1 A(q, p), L has a unit diagonal
+			TileSlotType *l_diag = m_matrixf32TiledAcquire(t_tiled, q, q, true);
+			if (l_diag == 0) return MatrixStatusErrIO;
+
+			for (size_t i = 1; i < l_diag->m_rows; ++i) {
+				float *row = t_panel + (top + i) * width;
+
+				for (size_t k = 0; k < i; ++k) {
+					const float l_ik = l_diag->m_val[i * l_diag->m_cols + k];
+					const float *row_k = t_panel + (top + k) * width;
+
+					for (size_t c = 0; c < width; ++c) {
+						row[c] -= l_ik * row_k[c];
+					}
+				}
+			}
+
+			m_matrixf32TiledRelease(l_diag, false);
+
+			// A(r, p) -= L(r, q) U(q, p)
+			for (size_t r = q + 1; r < tiles; ++r) {
+				if (r + 1 < tiles) m_matrixf32TiledPrefetch(t_tiled, r + 1, q);
+
+				TileSlotType *l_tile = m_matrixf32TiledAcquire(t_tiled, r, q, true);
+				if (l_tile == 0) return MatrixStatusErrIO;
+
+				m_matrixf32GemmKernel(l_tile->m_rows, width, l_tile->m_cols, -1.0f, l_tile->m_val, l_tile->m_cols,
+									  t_panel + top * width, width, true, t_panel + r * tile * width, width);
+
+				m_matrixf32TiledRelease(l_tile, false);
+			}
+		}
+
+		// partial pivoting within the block column, rows first ... n - 1
+		for (size_t c = 0; c < width; ++c) {
+			const size_t j = first + c;
+			size_t biggest_index = j;
+			float biggest = 0.0f;
+
+			for (size_t i = j; i < n; ++i) {
+				float temp = fabsf(t_panel[i * width + c]);
+
+				if (temp > biggest) {
+					biggest = temp;
+					biggest_index = i;
+				}
+			}
+
+			if (biggest == 0.0f) return MatrixStatusErrSingular;
+
+			t_pivot[j] = biggest_index;
+			if (biggest_index != j) m_matrixf32TiledSwapRows(t_panel, width, width, j, biggest_index);
+
+			const float *pivot_row = t_panel + j * width;
+
+			for (size_t i = j + 1; i < n; ++i) {
+				float *row = t_panel + i * width;
+				row[c] /= pivot_row[c];
+
+				for (size_t k = c + 1; k < width; ++k) {
+					row[k] -= row[c] * pivot_row[k];
+				}
+			}
+		}
+
+		if (!m_matrixf32TiledWriteBlock(t_tiled, 0, first, n, width, t_panel, width)) return MatrixStatusErrIO;
+
+		// cached L tiles of the left block columns are stale once their rows are swapped
+		if (!m_matrixf32TiledInvalidate(t_tiled)) return MatrixStatusErrIO;
+		if (!m_matrixf32TiledSwapLeft(t_tiled, t_pivot, first, width, t_row_buffer)) return MatrixStatusErrIO;
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32TiledLU(const MatrixF32TiledPtr t_dest_and_source, const MatrixF32Ptr t_permutation) {
+	if (t_dest_and_source == 0 || t_permutation == 0 || t_permutation->m_val == 0) return MatrixStatusErrNullPtr;
+	if (t_dest_and_source->m_row != t_dest_and_source->m_col) return MatrixStatusErrDimMismatch;
+	if (t_dest_and_source->m_row != t_permutation->m_row) return MatrixStatusErrDimMismatch;
+	if (!m_matrixf32RowMajorBuffer(t_permutation)) return MatrixStatusErrLayout;
+
+	const size_t n = t_dest_and_source->m_row;
+
+	size_t *pivot = MATRIX_F32_MALLOC(n * sizeof(size_t));
+	float *panel = MATRIX_F32_MALLOC(n * t_dest_and_source->m_tile * sizeof(float));
+	float *row_buffer = MATRIX_F32_MALLOC(2 * n * sizeof(float));
+
+	MatrixStatus ret_val = MatrixStatusErrNullPtr;
+
+	if (pivot != 0 && panel != 0 && row_buffer != 0) {
+		ret_val = m_matrixf32TiledInvalidate(t_dest_and_source)
+					  ? m_matrixf32TiledFactor(t_dest_and_source, pivot, panel, row_buffer)
+					  : MatrixStatusErrIO;
+	}
+
+	if (ret_val == MatrixStatusOK) {
+		m_matrixf32Touch(t_permutation);
+
+		for (size_t i = 0; i < n; ++i) {
+			t_permutation->m_val[i * t_permutation->m_col] = (float)i;
+		}
+
+		for (size_t j = 0; j < n; ++j) {
+			matrixf32Swap(t_permutation, pivot[j], j, SwapOptRow);
+		}
+	}
+
+	MATRIX_F32_FREE(pivot);
+	MATRIX_F32_FREE(panel);
+	MATRIX_F32_FREE(row_buffer);
+
+	return ret_val;
+}
+
+#else
+
+MatrixF32TiledPtr matrixf32TiledCreate(const char *t_path, MatrixDimType t_dim, size_t t_tile, size_t t_cache_tiles) {
+	(void)t_path;
+	(void)t_dim;
+	(void)t_tile;
+	(void)t_cache_tiles;
+
+	return 0;
+}
+
+MatrixF32TiledPtr matrixf32TiledOpen(const char *t_path, size_t t_tile, size_t t_cache_tiles) {
+	(void)t_path;
+	(void)t_tile;
+	(void)t_cache_tiles;
+
+	return 0;
+}
+
+MatrixStatus matrixf32TiledClose(MatrixF32TiledPtr *t_tiled) {
+	return t_tiled == 0 || *t_tiled == 0 ? MatrixStatusErrNullPtr : MatrixStatusErrIO;
+}
+
+MatrixDimType matrixf32TiledGetDim(MatrixF32TiledPtr t_tiled) {
+	(void)t_tiled;
+
+	return (MatrixDimType){0, 0};
+}
+
+MatrixF32TiledIOType matrixf32TiledGetIO(MatrixF32TiledPtr t_tiled) {
+	(void)t_tiled;
+
+	return (MatrixF32TiledIOType){0, 0};
+}
+
+MatrixStatus matrixf32TiledMultiplication(const MatrixF32TiledPtr t_result, const MatrixF32TiledPtr t_mat_b,
+										  const MatrixF32TiledPtr t_mat_c) {
+	(void)t_result;
+	(void)t_mat_b;
+	(void)t_mat_c;
+
+	return MatrixStatusErrIO;
+}
+
+MatrixStatus matrixf32TiledLU(const MatrixF32TiledPtr t_dest_and_source, const MatrixF32Ptr t_permutation) {
+	(void)t_dest_and_source;
+	(void)t_permutation;
+
+	return MatrixStatusErrIO;
+}
+
+#endif
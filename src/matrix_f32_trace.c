@@ -0,0 +1,131 @@
+/**
+ * @Date:   2026-10-19T11:05:48+08:00
+ * @Last modified time: 2026-10-19T11:05:48+08:00
+ */
+
+#include "include/matrix_f32_trace.h"
+#include "src/matrix_f32_instrument.h"
+
+#ifdef MATRIX_F32_ENABLE_TRACE
+
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#ifndef MATRIX_F32_TRACE_CAPACITY
+#define MATRIX_F32_TRACE_CAPACITY 4096
+#endif
+
+typedef struct TraceSpan {
+	const char *m_name;
+	uint64_t m_begin;
+	uint64_t m_end;
+} TraceSpanType;
+
+/**
+ *	Single producer ring buffer, only the owning thread writes m_span and m_head, the flushing thread only reads them
+ */
+typedef struct TraceBuffer {
+	struct TraceBuffer *m_next;
+	unsigned m_threadId;
+
+	atomic_size_t m_head;
+	TraceSpanType m_span[MATRIX_F32_TRACE_CAPACITY];
+} TraceBufferType;
+
+static _Atomic(TraceBufferType *) buffer_list = NULL;
+static atomic_uint thread_count = 0;
+static _Thread_local TraceBufferType *thread_buffer = NULL;
+
+static TraceBufferType *m_matrixf32TraceRegisterThread(void) {
+	TraceBufferType *buffer = malloc(sizeof(TraceBufferType));
+
+	if (buffer != 0) {
+		buffer->m_threadId = atomic_fetch_add_explicit(&thread_count, 1, memory_order_relaxed);
+		atomic_init(&buffer->m_head, 0);
+
+		// buffers are never unlinked, so the spans of finished threads can still be flushed
+		buffer->m_next = atomic_load_explicit(&buffer_list, memory_order_relaxed);
+		while (!atomic_compare_exchange_weak_explicit(&buffer_list, &buffer->m_next, buffer, memory_order_release,
+													  memory_order_relaxed)) {
+		}
+	}
+
+	return buffer;
+}
+
+uint64_t m_matrixf32TraceNow(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+void m_matrixf32TraceRecord(const char *t_name, uint64_t t_begin, uint64_t t_end) {
+	if (thread_buffer == 0) {
+		thread_buffer = m_matrixf32TraceRegisterThread();
+
+		if (thread_buffer == 0) return;
+	}
+
+	size_t head = atomic_load_explicit(&thread_buffer->m_head, memory_order_relaxed);
+	TraceSpanType *span = &thread_buffer->m_span[head % MATRIX_F32_TRACE_CAPACITY];
+
+	span->m_name = t_name;
+	span->m_begin = t_begin;
+	span->m_end = t_end;
+
+	atomic_store_explicit(&thread_buffer->m_head, head + 1, memory_order_release);
+}
+
+MatrixStatus matrixf32TraceFlush(const char *t_path) {
+	if (t_path == 0) return MatrixStatusErrNullPtr;
+
+	FILE *file = fopen(t_path, "w");
+	if (file == 0) return MatrixStatusErrIO;
+
+	bool first = true;
+	fputs("{\"displayTimeUnit\":\"ns\",\"traceEvents\":[", file);
+
+	for (TraceBufferType *buffer = atomic_load_explicit(&buffer_list, memory_order_acquire); buffer != 0;
+		 buffer = buffer->m_next) {
+		size_t head = atomic_load_explicit(&buffer->m_head, memory_order_acquire);
+		size_t tail = head > MATRIX_F32_TRACE_CAPACITY ? head - MATRIX_F32_TRACE_CAPACITY : 0;
+
+		for (size_t i = tail; i < head; ++i) {
+			const TraceSpanType *span = &buffer->m_span[i % MATRIX_F32_TRACE_CAPACITY];
+
+			// complete events ("X"), timestamps are in microseconds
+			fprintf(file,
+					"%s\n{\"name\":\"%s\",\"cat\":\"matrix_f32\",\"ph\":\"X\",\"pid\":0,\"tid\":%u,\"ts\":%.3f,"
+					"\"dur\":%.3f}",
+					first ? "" : ",", span->m_name, buffer->m_threadId, (double)span->m_begin / 1000.0,
+					(double)(span->m_end - span->m_begin) / 1000.0);
+			first = false;
+		}
+	}
+
+	fputs("\n]}\n", file);
+
+	return fclose(file) == 0 ? MatrixStatusOK : MatrixStatusErrIO;
+}
+
+void matrixf32TraceReset(void) {
+	for (TraceBufferType *buffer = atomic_load_explicit(&buffer_list, memory_order_acquire); buffer != 0;
+		 buffer = buffer->m_next) {
+		atomic_store_explicit(&buffer->m_head, 0, memory_order_relaxed);
+	}
+}
+
+#else
+
+MatrixStatus matrixf32TraceFlush(const char *t_path) {
+	if (t_path == 0) return MatrixStatusErrNullPtr;
+
+	return MatrixStatusOK;
+}
+
+void matrixf32TraceReset(void) {}
+
+#endif
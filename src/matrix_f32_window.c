@@ -0,0 +1,251 @@
+/**
+ * @Date:   2026-10-19T18:20:44+08:00
+ * @Last modified time: 2026-10-19T18:20:44+08:00
+ */
+
+#include "include/matrix_f32_window.h"
+#include "src/matrix_f32_private.h"
+
+#include <string.h>
+
+struct MatrixF32Window {
+	MatrixF32Ptr m_storage;	 // capacity x col
+	float *m_scratch;		 // col floats, column means of the covariance
+
+	size_t m_head;	// storage row of logical row 0
+	size_t m_count;
+};
+
+typedef struct WindowSegment {
+	const float *m_val;
+	size_t m_rows;
+} WindowSegmentType;
+
+// private function
+// the logical rows as at most two contiguous runs of storage rows, oldest first
+static size_t m_matrixf32WindowSegments(MatrixF32WindowPtr t_window, WindowSegmentType t_segment[2]) {
+	const MatrixF32Ptr storage = t_window->m_storage;
+	const size_t first_rows = storage->m_row - t_window->m_head;
+
+	t_segment[0].m_val = storage->m_val + t_window->m_head * storage->m_col;
+
+	if (t_window->m_count <= first_rows) {
+		t_segment[0].m_rows = t_window->m_count;
+
+		return t_window->m_count == 0 ? 0 : 1;
+	}
+
+	t_segment[0].m_rows = first_rows;
+	t_segment[1].m_val = storage->m_val;
+	t_segment[1].m_rows = t_window->m_count - first_rows;
+
+	return 2;
+}
+
+MatrixF32WindowPtr matrixf32WindowCreate(size_t t_capacity, size_t t_col) {
+	if (t_capacity == 0 || t_col == 0) return 0;
+
+	MatrixF32WindowPtr window = MATRIX_F32_MALLOC(sizeof(struct MatrixF32Window));
+	if (window == 0) return 0;
+
+	window->m_storage = m_matrixf32CreateFor((MatrixDimType){t_capacity, t_col}, MatrixF32OpCreate);
+	window->m_scratch = MATRIX_F32_MALLOC(t_col * sizeof(float));
+	window->m_head = 0;
+	window->m_count = 0;
+
+	if (window->m_storage == 0 || window->m_storage->m_val == 0 || window->m_scratch == 0) {
+		matrixf32WindowDestroy(&window);
+	}
+
+	return window;
+}
+
+MatrixStatus matrixf32WindowDestroy(MatrixF32WindowPtr *t_window) {
+	if (t_window == 0) return MatrixStatusErrNullPtr;
+
+	if (*t_window != 0) {
+		matrixf32Destroy(&(*t_window)->m_storage);
+		MATRIX_F32_FREE((*t_window)->m_scratch);
+	}
+
+	MATRIX_F32_FREE(*t_window);
+	*t_window = 0;
+
+	return MatrixStatusOK;
+}
+
+size_t matrixf32WindowGetRowNumber(MatrixF32WindowPtr t_window) { return t_window == 0 ? 0 : t_window->m_count; }
+
+size_t matrixf32WindowGetColNumber(MatrixF32WindowPtr t_window) {
+	return t_window == 0 ? 0 : t_window->m_storage->m_col;
+}
+
+MatrixStatus matrixf32WindowPush(MatrixF32WindowPtr t_window, const float *t_row) {
+	if (t_window == 0 || t_row == 0) return MatrixStatusErrNullPtr;
+
+	const MatrixF32Ptr storage = t_window->m_storage;
+	size_t tail = t_window->m_head + t_window->m_count;
+	if (tail >= storage->m_row) tail -= storage->m_row;
+
+	memcpy(storage->m_val + tail * storage->m_col, t_row, storage->m_col * sizeof(float));
+
+	if (t_window->m_count < storage->m_row) {
+		t_window->m_count++;
+	} else if (++t_window->m_head == storage->m_row) {
+		t_window->m_head = 0;
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32WindowClear(MatrixF32WindowPtr t_window) {
+	if (t_window == 0) return MatrixStatusErrNullPtr;
+
+	t_window->m_head = 0;
+	t_window->m_count = 0;
+
+	return MatrixStatusOK;
+}
+
+const float *matrixf32WindowGetRow(MatrixF32WindowPtr t_window, size_t t_row) {
+	if (t_window == 0 || t_row >= t_window->m_count) return 0;
+
+	const MatrixF32Ptr storage = t_window->m_storage;
+	size_t row = t_window->m_head + t_row;
+	if (row >= storage->m_row) row -= storage->m_row;
+
+	return storage->m_val + row * storage->m_col;
+}
+
+MatrixStatus matrixf32WindowCopyTo(const MatrixF32Ptr t_result, MatrixF32WindowPtr t_window) {
+	if (t_result == 0 || t_window == 0 || t_result->m_val == 0) return MatrixStatusErrNullPtr;
+
+	const size_t col = t_window->m_storage->m_col;
+	if (t_result->m_row != t_window->m_count || t_result->m_col != col) return MatrixStatusErrDimMismatch;
+	if (!m_matrixf32RowMajorBuffer(t_result)) return MatrixStatusErrLayout;
+
+	m_matrixf32Touch(t_result);
+
+	WindowSegmentType segment[2];
+	size_t segments = m_matrixf32WindowSegments(t_window, segment);
+	float *dest = t_result->m_val;
+
+	for (size_t s = 0; s < segments; ++s) {
+		memcpy(dest, segment[s].m_val, segment[s].m_rows * col * sizeof(float));
+		dest += segment[s].m_rows * col;
+	}
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32WindowMultiplication(const MatrixF32Ptr t_result, MatrixF32WindowPtr t_window,
+										   const MatrixF32Ptr t_mat_c) {
+	if (t_result == 0 || t_window == 0 || t_mat_c == 0) return MatrixStatusErrNullPtr;
+	if (t_result->m_val == 0 || t_mat_c->m_val == 0) return MatrixStatusErrNullPtr;
+
+	const size_t col = t_window->m_storage->m_col;
+	bool dim_not_matched = t_window->m_count == 0 || col != t_mat_c->m_row ||
+						   t_result->m_row != t_window->m_count || t_result->m_col != t_mat_c->m_col;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+	if (!m_matrixf32RowMajorBuffer(t_result) || !m_matrixf32RowMajorBuffer(t_mat_c)) return MatrixStatusErrLayout;
+
+	m_matrixf32Touch(t_result);
+
+	WindowSegmentType segment[2];
+	size_t segments = m_matrixf32WindowSegments(t_window, segment);
+	float *dest = t_result->m_val;
+
+	for (size_t s = 0; s < segments; ++s) {
+		m_matrixf32GemmKernel(segment[s].m_rows, t_mat_c->m_col, col, 1.0f, segment[s].m_val, col, t_mat_c->m_val,
+							  t_mat_c->m_col, false, dest, t_result->m_col);
+		dest += segment[s].m_rows * t_result->m_col;
+	}
+
+	return MatrixStatusOK;
+}
+
+// column sums of the segments divided by the row number
+static void m_matrixf32WindowMean(MatrixF32WindowPtr t_window, float *t_mean) {
+	const size_t col = t_window->m_storage->m_col;
+
+	WindowSegmentType segment[2];
+	size_t segments = m_matrixf32WindowSegments(t_window, segment);
+
+	memset(t_mean, 0, col * sizeof(float));
+
+	for (size_t s = 0; s < segments; ++s) {
+		for (size_t i = 0; i < segment[s].m_rows; ++i) {
+			const float *row = segment[s].m_val + i * col;
+
+			for (size_t j = 0; j < col; ++j) {
+				t_mean[j] += row[j];
+			}
+		}
+	}
+
+	const float inv_count = 1.0f / (float)t_window->m_count;
+
+	for (size_t j = 0; j < col; ++j) {
+		t_mean[j] *= inv_count;
+	}
+}
+
+MatrixStatus matrixf32WindowMean(const MatrixF32Ptr t_result, MatrixF32WindowPtr t_window) {
+	if (t_result == 0 || t_window == 0 || t_result->m_val == 0) return MatrixStatusErrNullPtr;
+
+	bool dim_not_matched = t_window->m_count == 0 || t_result->m_row != 1 ||
+						   t_result->m_col != t_window->m_storage->m_col;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+	if (!m_matrixf32RowMajorBuffer(t_result)) return MatrixStatusErrLayout;
+
+	m_matrixf32Touch(t_result);
+	m_matrixf32WindowMean(t_window, t_result->m_val);
+
+	return MatrixStatusOK;
+}
+
+MatrixStatus matrixf32WindowCovariance(const MatrixF32Ptr t_result, MatrixF32WindowPtr t_window) {
+	if (t_result == 0 || t_window == 0 || t_result->m_val == 0) return MatrixStatusErrNullPtr;
+
+	const size_t col = t_window->m_storage->m_col;
+	bool dim_not_matched = t_window->m_count < 2 || t_result->m_row != col || t_result->m_col != col;
+	if (dim_not_matched) return MatrixStatusErrDimMismatch;
+	if (!m_matrixf32RowMajorBuffer(t_result)) return MatrixStatusErrLayout;
+
+	m_matrixf32Touch(t_result);
+
+	float *mean = t_window->m_scratch;
+	m_matrixf32WindowMean(t_window, mean);
+
+	WindowSegmentType segment[2];
+	size_t segments = m_matrixf32WindowSegments(t_window, segment);
+	float *cov = t_result->m_val;
+
+	memset(cov, 0, col * col * sizeof(float));
+
+	// upper triangle only, mirrored below
+	for (size_t s = 0; s < segments; ++s) {
+		for (size_t i = 0; i < segment[s].m_rows; ++i) {
+			const float *row = segment[s].m_val + i * col;
+
+			for (size_t j = 0; j < col; ++j) {
+				const float dj = row[j] - mean[j];
+
+				for (size_t k = j; k < col; ++k) {
+					cov[j * col + k] += dj * (row[k] - mean[k]);
+				}
+			}
+		}
+	}
+
+	const float inv_dof = 1.0f / (float)(t_window->m_count - 1);
+
+	for (size_t j = 0; j < col; ++j) {
+		for (size_t k = j; k < col; ++k) {
+			cov[j * col + k] *= inv_dof;
+			cov[k * col + j] = cov[j * col + k];
+		}
+	}
+
+	return MatrixStatusOK;
+}
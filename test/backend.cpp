@@ -0,0 +1,117 @@
+#include "../include/matrix_f32_backend.h"
+#include "gtest/gtest.h"
+#include "test_util.h"
+
+#include <cstring>
+
+TEST(Backend, names_and_selection) {
+	const MatrixBackend previous = matrixf32GetBackend();
+
+	EXPECT_TRUE(matrixf32BackendAvailable(MatrixBackendReference));
+	EXPECT_TRUE(matrixf32BackendAvailable(MatrixBackendNative));
+	EXPECT_FALSE(matrixf32BackendAvailable(MatrixBackendCount));
+	EXPECT_EQ(nullptr, matrixf32BackendName(MatrixBackendCount));
+
+	for (int i = 0; i < MatrixBackendCount; ++i) {
+		const MatrixBackend backend = (MatrixBackend)i;
+
+		if (!matrixf32BackendAvailable(backend)) {
+			EXPECT_EQ(MatrixStatusErrUnknownOpt, matrixf32SetBackend(backend));
+			continue;
+		}
+
+		ASSERT_EQ(MatrixStatusOK, matrixf32SetBackendByName(matrixf32BackendName(backend)));
+		EXPECT_EQ(backend, matrixf32GetBackend());
+	}
+
+	EXPECT_STREQ("native", matrixf32BackendName(MatrixBackendNative));
+	EXPECT_EQ(MatrixStatusErrUnknownOpt, matrixf32SetBackendByName("fastest"));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32SetBackendByName(NULL));
+	EXPECT_EQ(MatrixStatusErrUnknownOpt, matrixf32SetBackend(MatrixBackendCount));
+
+	matrixf32SetBackend(previous);
+}
+
+TEST(Backend, self_test_of_every_available_backend) {
+	for (int i = 0; i < MatrixBackendCount; ++i) {
+		if (!matrixf32BackendAvailable((MatrixBackend)i)) continue;
+
+		// 1 and 37 leave remainders in the native GEMM tiles, 100 spans several LU panels
+		for (size_t n : {1u, 37u, 100u}) {
+			float max_error = -1.0f;
+
+			ASSERT_EQ(MatrixStatusOK, matrixf32BackendSelfTest((MatrixBackend)i, n, &max_error));
+			EXPECT_LE(0.0f, max_error);
+			EXPECT_GT(1e-4f, max_error) << matrixf32BackendName((MatrixBackend)i) << " n = " << n;
+		}
+	}
+
+	float max_error;
+	EXPECT_EQ(MatrixStatusErrUnknownOpt, matrixf32BackendSelfTest(MatrixBackendCount, 8, &max_error));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32BackendSelfTest(MatrixBackendNative, 0, &max_error));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32BackendSelfTest(MatrixBackendNative, 8, NULL));
+}
+
+TEST(Backend, public_functions_agree_across_backends) {
+	static constexpr size_t M = 37, K = 53, N = 70;
+
+	const MatrixBackend previous = matrixf32GetBackend();
+
+	MatrixF32Ptr b = matrixf32Create({M, K});
+	MatrixF32Ptr c = matrixf32Create({K, M});
+	MatrixF32Ptr a = matrixf32Create({N, N});
+	MatrixF32Ptr rhs = matrixf32Create({N, 3});
+	fillRandom(b, 3);
+	fillRandom(c, 5);
+	fillRandom(a, 7);
+	fillRandom(rhs, 11);
+
+	MatrixF32Ptr product[MatrixBackendCount], inverse[MatrixBackendCount], solution[MatrixBackendCount];
+
+	for (int i = 0; i < MatrixBackendCount; ++i) {
+		product[i] = matrixf32Create({M, M});
+		inverse[i] = matrixf32Create({N, N});
+		solution[i] = matrixf32Create({N, 3});
+
+		if (matrixf32SetBackend((MatrixBackend)i) != MatrixStatusOK) continue;
+
+		ASSERT_EQ(MatrixStatusOK, matrixf32Multiplication(product[i], b, c));
+		ASSERT_EQ(MatrixStatusOK, matrixf32Inverse(inverse[i], a));
+		ASSERT_EQ(MatrixStatusOK, matrixf32Solve(solution[i], a, rhs));
+
+		EXPECT_TRUE(matrixf32TwoMatEqual(product[MatrixBackendReference], product[i], 1e-4f));
+		EXPECT_TRUE(matrixf32TwoMatEqual(inverse[MatrixBackendReference], inverse[i], 1e-3f));
+		EXPECT_TRUE(matrixf32TwoMatEqual(solution[MatrixBackendReference], solution[i], 1e-3f));
+	}
+
+	// a column of zeros is singular on every backend
+	MatrixF32Ptr singular = matrixf32Create({N, N});
+	MatrixF32Ptr permutation = matrixf32Create({N, 1});
+
+	for (int i = 0; i < MatrixBackendCount; ++i) {
+		if (matrixf32SetBackend((MatrixBackend)i) != MatrixStatusOK) continue;
+
+		ASSERT_EQ(MatrixStatusOK, matrixf32Copy(singular, a));
+
+		for (size_t row = 0; row < N; ++row) {
+			matrixf32SetValueAt(singular, {row, N / 2}, 0.0f);
+		}
+
+		EXPECT_EQ(MatrixStatusErrSingular, matrixf32InPlaceLU(singular, permutation));
+	}
+
+	matrixf32SetBackend(previous);
+
+	for (int i = 0; i < MatrixBackendCount; ++i) {
+		matrixf32Destroy(&product[i]);
+		matrixf32Destroy(&inverse[i]);
+		matrixf32Destroy(&solution[i]);
+	}
+
+	matrixf32Destroy(&b);
+	matrixf32Destroy(&c);
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&rhs);
+	matrixf32Destroy(&singular);
+	matrixf32Destroy(&permutation);
+}
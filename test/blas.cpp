@@ -0,0 +1,164 @@
+#include "../include/matrix_f32_blas.h"
+#include "gtest/gtest.h"
+#include "test_util.h"
+
+#include <cmath>
+
+TEST(Blas, dot_and_nrm2) {
+	// 37 leaves a remainder after the unrolled part
+	for (size_t n : {1u, 8u, 37u}) {
+		MatrixF32Ptr x = matrixf32Create({n, 1});
+		MatrixF32Ptr y = matrixf32Create({1, n});
+		fillRandom(x, 3);
+		fillRandom(y, 5);
+
+		double dot = 0.0, sum_of_squares = 0.0;
+
+		for (size_t i = 0; i < n; ++i) {
+			dot += (double)matrixf32GetBuffer(x)[i] * matrixf32GetBuffer(y)[i];
+			sum_of_squares += (double)matrixf32GetBuffer(x)[i] * matrixf32GetBuffer(x)[i];
+		}
+
+		float result;
+		ASSERT_EQ(MatrixStatusOK, matrixf32Dot(&result, x, y));
+		EXPECT_NEAR(dot, result, 1e-5);
+		ASSERT_EQ(MatrixStatusOK, matrixf32Nrm2(&result, x));
+		EXPECT_NEAR(std::sqrt(sum_of_squares), result, 1e-5);
+
+		matrixf32Destroy(&x);
+		matrixf32Destroy(&y);
+	}
+
+	// squares out of the float range
+	float big[]{3e30f, -4e30f}, small[]{3e-30f, 4e-30f}, result;
+	MatrixF32Ptr x_big = matrixf32CreateContainer({2, 1}, big, 2);
+	MatrixF32Ptr x_small = matrixf32CreateContainer({2, 1}, small, 2);
+
+	ASSERT_EQ(MatrixStatusOK, matrixf32Nrm2(&result, x_big));
+	EXPECT_FLOAT_EQ(5e30f, result);
+	ASSERT_EQ(MatrixStatusOK, matrixf32Nrm2(&result, x_small));
+	EXPECT_FLOAT_EQ(5e-30f, result);
+
+	matrixf32Destroy(&x_big);
+	matrixf32Destroy(&x_small);
+}
+
+TEST(Blas, axpy) {
+	static constexpr size_t N = 19;
+
+	MatrixF32Ptr x = matrixf32Create({N, 1});
+	MatrixF32Ptr y = matrixf32Create({N, 1});
+
+	for (size_t i = 0; i < N; ++i) {
+		matrixf32SetValueAt(x, {i, 0}, (float)i);
+		matrixf32SetValueAt(y, {i, 0}, 1.0f);
+	}
+
+	ASSERT_EQ(MatrixStatusOK, matrixf32Axpy(y, 2.0f, x));
+
+	for (size_t i = 0; i < N; ++i) {
+		EXPECT_EQ(2.0f * i + 1.0f, matrixf32GetValueAt(y, {i, 0}));
+	}
+
+	// x may be y, y = 3 * y
+	ASSERT_EQ(MatrixStatusOK, matrixf32Axpy(x, 2.0f, x));
+	EXPECT_EQ(3.0f * (N - 1), matrixf32GetValueAt(x, {N - 1, 0}));
+
+	matrixf32Destroy(&x);
+	matrixf32Destroy(&y);
+}
+
+TEST(Blas, gemv_and_ger_in_both_layouts) {
+	static constexpr size_t M = 13, N = 21;
+
+	MatrixF32Ptr a_row = matrixf32Create({M, N});
+	MatrixF32Ptr x = matrixf32Create({N, 1});
+	MatrixF32Ptr u = matrixf32Create({M, 1});
+	fillRandom(a_row, 7);
+	fillRandom(x, 11);
+	fillRandom(u, 13);
+
+	for (MatrixLayout layout : layouts) {
+		MatrixF32Ptr a = matrixf32CreateWithLayout({M, N}, layout);
+		ASSERT_EQ(MatrixStatusOK, matrixf32Copy(a, a_row));
+
+		// y = 2 A x + 0.5 y
+		MatrixF32Ptr y = matrixf32Create({M, 1});
+		matrixf32SetAllEntriesTo(y, 4.0f);
+		ASSERT_EQ(MatrixStatusOK, matrixf32Gemv(y, 2.0f, a, x, 0.5f));
+
+		for (size_t i = 0; i < M; ++i) {
+			double expected = 2.0;
+
+			for (size_t j = 0; j < N; ++j) {
+				expected += 2.0 * matrixf32GetValueAt(a_row, {i, j}) * matrixf32GetValueAt(x, {j, 0});
+			}
+
+			EXPECT_NEAR(expected, matrixf32GetValueAt(y, {i, 0}), 1e-5);
+		}
+
+		// z = A^T u, z is not read with a beta of 0
+		MatrixF32Ptr z = matrixf32Create({1, N});
+		matrixf32SetAllEntriesTo(z, NAN);
+		ASSERT_EQ(MatrixStatusOK, matrixf32GemvTransposed(z, 1.0f, a, u, 0.0f));
+
+		for (size_t j = 0; j < N; ++j) {
+			double expected = 0.0;
+
+			for (size_t i = 0; i < M; ++i) {
+				expected += (double)matrixf32GetValueAt(a_row, {i, j}) * matrixf32GetValueAt(u, {i, 0});
+			}
+
+			EXPECT_NEAR(expected, matrixf32GetValueAt(z, {0, j}), 1e-5);
+		}
+
+		// A = -u x^T + A
+		ASSERT_EQ(MatrixStatusOK, matrixf32Ger(a, -1.0f, u, x));
+
+		for (size_t i = 0; i < M; ++i) {
+			for (size_t j = 0; j < N; ++j) {
+				const float outer = matrixf32GetValueAt(u, {i, 0}) * matrixf32GetValueAt(x, {j, 0});
+
+				EXPECT_FLOAT_EQ(matrixf32GetValueAt(a_row, {i, j}) - outer, matrixf32GetValueAt(a, {i, j}));
+			}
+		}
+
+		matrixf32Destroy(&a);
+		matrixf32Destroy(&y);
+		matrixf32Destroy(&z);
+	}
+
+	// matrixf32Multiplication with a column takes the same path
+	MatrixF32Ptr product = matrixf32Create({M, 1});
+	MatrixF32Ptr y = matrixf32Create({M, 1});
+	ASSERT_EQ(MatrixStatusOK, matrixf32Multiplication(product, a_row, x));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Gemv(y, 1.0f, a_row, x, 0.0f));
+	EXPECT_TRUE(matrixf32TwoMatEqual(product, y, 0.0f));
+
+	matrixf32Destroy(&a_row);
+	matrixf32Destroy(&x);
+	matrixf32Destroy(&u);
+	matrixf32Destroy(&product);
+	matrixf32Destroy(&y);
+}
+
+TEST(Blas, invalid_arguments) {
+	MatrixF32Ptr a = matrixf32Create({3, 4});
+	MatrixF32Ptr x = matrixf32Create({4, 1});
+	MatrixF32Ptr y = matrixf32Create({3, 1});
+	float result;
+
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32Dot(NULL, x, x));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32Nrm2(&result, NULL));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32Dot(&result, x, y));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32Nrm2(&result, a));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32Axpy(y, 1.0f, x));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32Gemv(x, 1.0f, a, y, 0.0f));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32GemvTransposed(y, 1.0f, a, x, 0.0f));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32Ger(a, 1.0f, x, y));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32Ger(a, 1.0f, NULL, x));
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&x);
+	matrixf32Destroy(&y);
+}
@@ -0,0 +1,144 @@
+#include "../include/matrix_f32_cholesky.h"
+#include "gtest/gtest.h"
+
+// A = B * B^T + n * I is symmetric positive definite
+static void fillPositiveDefinite(MatrixF32Ptr mat) {
+	const size_t n = matrixf32GetRowNumber(mat);
+
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t j = 0; j < n; ++j) {
+			float sum = i == j ? static_cast<float>(n) : 0.0f;
+
+			for (size_t p = 0; p < n; ++p) {
+				sum += static_cast<float>((i + 2 * p) % 5) * static_cast<float>((j + 2 * p) % 5) * 0.1f;
+			}
+
+			matrixf32SetValueAt(mat, {i, j}, sum);
+		}
+	}
+}
+
+static void multiplyLowerTranspose(MatrixF32Ptr result, MatrixF32Ptr lower) {
+	const size_t n = matrixf32GetRowNumber(lower);
+
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t j = 0; j < n; ++j) {
+			float sum = 0.0f;
+
+			for (size_t p = 0; p < n; ++p) {
+				sum += matrixf32GetValueAt(lower, {i, p}) * matrixf32GetValueAt(lower, {j, p});
+			}
+
+			matrixf32SetValueAt(result, {i, j}, sum);
+		}
+	}
+}
+
+TEST(Cholesky, decomposition_reconstructs_source) {
+	MatrixF32Ptr source = matrixf32Create({6, 6});
+	MatrixF32Ptr lower = matrixf32Create({6, 6});
+	MatrixF32Ptr product = matrixf32Create({6, 6});
+	fillPositiveDefinite(source);
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32Cholesky(lower, source));
+	EXPECT_EQ(0.0f, matrixf32GetValueAt(lower, {0, 5}));
+
+	multiplyLowerTranspose(product, lower);
+	EXPECT_TRUE(matrixf32TwoMatEqual(source, product, 1e-4f));
+
+	// in place
+	EXPECT_EQ(MatrixStatusOK, matrixf32Cholesky(product, product));
+	EXPECT_TRUE(matrixf32TwoMatEqual(lower, product, 1e-5f));
+
+	matrixf32Destroy(&source);
+	matrixf32Destroy(&lower);
+	matrixf32Destroy(&product);
+}
+
+TEST(Cholesky, solve_returns_solution) {
+	MatrixF32Ptr source = matrixf32Create({5, 5});
+	MatrixF32Ptr lower = matrixf32Create({5, 5});
+	MatrixF32Ptr expected = matrixf32Create({5, 2});
+	MatrixF32Ptr rhs = matrixf32Create({5, 2});
+	MatrixF32Ptr result = matrixf32Create({5, 2});
+	fillPositiveDefinite(source);
+
+	for (size_t i = 0; i < 5; ++i) {
+		matrixf32SetValueAt(expected, {i, 0}, static_cast<float>(i) - 2.0f);
+		matrixf32SetValueAt(expected, {i, 1}, 0.5f * static_cast<float>(i * i));
+	}
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32Multiplication(rhs, source, expected));
+	EXPECT_EQ(MatrixStatusOK, matrixf32Cholesky(lower, source));
+	EXPECT_EQ(MatrixStatusOK, matrixf32CholeskySolve(result, lower, rhs));
+	EXPECT_TRUE(matrixf32TwoMatEqual(expected, result, 1e-4f));
+
+	matrixf32Destroy(&source);
+	matrixf32Destroy(&lower);
+	matrixf32Destroy(&expected);
+	matrixf32Destroy(&rhs);
+	matrixf32Destroy(&result);
+}
+
+TEST(Cholesky, rank_one_update_and_downdate) {
+	const size_t n = 6;
+	MatrixF32Ptr source = matrixf32Create({n, n});
+	MatrixF32Ptr updated = matrixf32Create({n, n});
+	MatrixF32Ptr lower = matrixf32Create({n, n});
+	MatrixF32Ptr original = matrixf32Create({n, n});
+	MatrixF32Ptr expected = matrixf32Create({n, n});
+	MatrixF32Ptr vector = matrixf32Create({n, 1});
+	fillPositiveDefinite(source);
+
+	const float x[]{0.5f, -1.0f, 2.0f, 0.25f, 0.0f, 1.5f};
+
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t j = 0; j < n; ++j) {
+			matrixf32SetValueAt(updated, {i, j}, matrixf32GetValueAt(source, {i, j}) + x[i] * x[j]);
+		}
+	}
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32Cholesky(lower, source));
+	EXPECT_EQ(MatrixStatusOK, matrixf32Copy(original, lower));
+	EXPECT_EQ(MatrixStatusOK, matrixf32Cholesky(expected, updated));
+
+	for (size_t i = 0; i < n; ++i) matrixf32SetValueAt(vector, {i, 0}, x[i]);
+	EXPECT_EQ(MatrixStatusOK, matrixf32CholeskyUpdate(lower, vector));
+	EXPECT_TRUE(matrixf32TwoMatEqual(expected, lower, 1e-4f));
+
+	for (size_t i = 0; i < n; ++i) matrixf32SetValueAt(vector, {i, 0}, x[i]);
+	EXPECT_EQ(MatrixStatusOK, matrixf32CholeskyDowndate(lower, vector));
+	EXPECT_TRUE(matrixf32TwoMatEqual(original, lower, 1e-4f));
+
+	// removing more than there is leaves an indefinite matrix
+	for (size_t i = 0; i < n; ++i) matrixf32SetValueAt(vector, {i, 0}, 100.0f * x[i]);
+	EXPECT_EQ(MatrixStatusErrSingular, matrixf32CholeskyDowndate(lower, vector));
+
+	matrixf32Destroy(&source);
+	matrixf32Destroy(&updated);
+	matrixf32Destroy(&lower);
+	matrixf32Destroy(&original);
+	matrixf32Destroy(&expected);
+	matrixf32Destroy(&vector);
+}
+
+TEST(Cholesky, invalid_input_will_return_error) {
+	float buffer[]{1.0f, 2.0f, 2.0f, 1.0f};
+	MatrixF32Ptr indefinite = matrixf32CreateContainer({2, 2}, buffer, 4);
+	MatrixF32Ptr square = matrixf32Create({2, 2});
+	MatrixF32Ptr rect = matrixf32Create({2, 3});
+	MatrixF32Ptr vector = matrixf32Create({3, 1});
+
+	EXPECT_EQ(MatrixStatusErrSingular, matrixf32Cholesky(square, indefinite));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32Cholesky(rect, rect));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32CholeskySolve(rect, square, vector));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32CholeskyUpdate(square, vector));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32Cholesky(0, square));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32CholeskySolve(square, 0, square));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32CholeskyDowndate(square, 0));
+
+	matrixf32Destroy(&indefinite);
+	matrixf32Destroy(&square);
+	matrixf32Destroy(&rect);
+	matrixf32Destroy(&vector);
+}
@@ -0,0 +1,154 @@
+#include "../include/matrix_f32_determinant.h"
+#include "../include/matrix_f32_reduce.h"
+#include "gtest/gtest.h"
+#include "test_util.h"
+
+#include <cmath>
+#include <vector>
+
+TEST(Determinant, small_matrix_in_both_layouts) {
+	// det = 402, the first column needs a row interchange
+	float values[]{1.0f, 2.0f, 3.0f, 6.0f, -4.0f, 5.0f, 7.0f, 8.0f, -9.0f};
+	MatrixF32Ptr source = matrixf32CreateContainer({3, 3}, values, 9);
+
+	for (MatrixLayout layout : layouts) {
+		MatrixF32Ptr lu = matrixf32CreateWithLayout({3, 3}, layout);
+		MatrixF32Ptr permutation = matrixf32Create({3, 1});
+		ASSERT_EQ(MatrixStatusOK, matrixf32OutPlaceLU(lu, source, permutation));
+
+		float det, log_det, sign;
+		ASSERT_EQ(MatrixStatusOK, matrixf32LUDeterminant(&det, lu, permutation));
+		EXPECT_NEAR(402.0f, det, 1e-3f);
+		ASSERT_EQ(MatrixStatusOK, matrixf32LULogDeterminant(&log_det, &sign, lu, permutation));
+		EXPECT_NEAR(std::log(402.0f), log_det, 1e-5f);
+		EXPECT_EQ(1.0f, sign);
+
+		matrixf32Destroy(&lu);
+		matrixf32Destroy(&permutation);
+	}
+
+	matrixf32Destroy(&source);
+}
+
+TEST(Determinant, log_determinant_beyond_the_float_range) {
+	static constexpr size_t N = 66;
+
+	// an anti-diagonal of 1000, det = (-1)^(N / 2) * 1000^N overflows
+	MatrixF32Ptr lu = matrixf32Create({N, N});
+	MatrixF32Ptr permutation = matrixf32Create({N, 1});
+	matrixf32SetAllEntriesTo(lu, 0.0f);
+
+	for (size_t i = 0; i < N; ++i) matrixf32SetValueAt(lu, {i, N - 1 - i}, 1000.0f);
+
+	ASSERT_EQ(MatrixStatusOK, matrixf32InPlaceLU(lu, permutation));
+
+	float det, log_det, sign;
+	ASSERT_EQ(MatrixStatusOK, matrixf32LUDeterminant(&det, lu, permutation));
+	EXPECT_EQ(-INFINITY, det);
+	ASSERT_EQ(MatrixStatusOK, matrixf32LULogDeterminant(&log_det, &sign, lu, permutation));
+	EXPECT_FLOAT_EQ(N * std::log(1000.0f), log_det);
+	EXPECT_EQ(-1.0f, sign);
+
+	// 1000^(N/2) * 0.001^(N/2) = 1, the running product never leaves the float range
+	for (size_t i = 0; i < N; i += 2) matrixf32SetValueAt(lu, {i, i}, 0.001f);
+
+	ASSERT_EQ(MatrixStatusOK, matrixf32LUDeterminant(&det, lu, permutation));
+	EXPECT_FLOAT_EQ(-1.0f, det);
+
+	matrixf32Destroy(&lu);
+	matrixf32Destroy(&permutation);
+}
+
+TEST(Determinant, rcond_bounds_the_exact_value) {
+	for (size_t n : {1u, 2u, 17u, 60u}) {
+		MatrixF32Ptr a = matrixf32Create({n, n});
+		MatrixF32Ptr inverse = matrixf32Create({n, n});
+		MatrixF32Ptr lu = matrixf32Create({n, n});
+		MatrixF32Ptr permutation = matrixf32Create({n, 1});
+		fillRandom(a, 3 + (unsigned)n);
+
+		float norm_a, norm_inverse;
+		ASSERT_EQ(MatrixStatusOK, matrixf32Inverse(inverse, a));
+		ASSERT_EQ(MatrixStatusOK, matrixf32Norm(&norm_a, a, MatrixNormOne));
+		ASSERT_EQ(MatrixStatusOK, matrixf32Norm(&norm_inverse, inverse, MatrixNormOne));
+		ASSERT_EQ(MatrixStatusOK, matrixf32OutPlaceLU(lu, a, permutation));
+
+		std::vector<float> workspace(matrixf32LURcondWorkspaceLen(n));
+		float rcond;
+		ASSERT_EQ(MatrixStatusOK,
+				  matrixf32LURcond(&rcond, lu, permutation, norm_a, workspace.data(), workspace.size()));
+
+		// the inverse norm is a lower bound, so the estimate is at least the exact value up to rounding
+		const float exact = 1.0f / (norm_a * norm_inverse);
+		EXPECT_GE(rcond, exact * 0.999f) << n;
+		EXPECT_LE(rcond, exact * 3.0f) << n;
+
+		matrixf32Destroy(&a);
+		matrixf32Destroy(&inverse);
+		matrixf32Destroy(&lu);
+		matrixf32Destroy(&permutation);
+	}
+}
+
+TEST(Determinant, singular_and_ill_conditioned) {
+	static constexpr size_t N = 8;
+
+	MatrixF32Ptr a = matrixf32Create({N, N});
+	MatrixF32Ptr lu = matrixf32Create({N, N});
+	MatrixF32Ptr permutation = matrixf32Create({N, 1});
+	std::vector<float> workspace(matrixf32LURcondWorkspaceLen(N));
+	fillRandom(a, 7);
+
+	// the last row a tiny step away from the first, far below the absolute 1e-6 pivot threshold of the solves
+	for (size_t j = 0; j < N; ++j) {
+		matrixf32SetValueAt(a, {N - 1, j}, matrixf32GetValueAt(a, {0, j}) * (1.0f + 1e-6f * (j == 3)));
+	}
+
+	float norm_a, rcond, det, log_det, sign;
+	ASSERT_EQ(MatrixStatusOK, matrixf32Norm(&norm_a, a, MatrixNormOne));
+	ASSERT_EQ(MatrixStatusOK, matrixf32OutPlaceLU(lu, a, permutation));
+	ASSERT_EQ(MatrixStatusOK, matrixf32LURcond(&rcond, lu, permutation, norm_a, workspace.data(), workspace.size()));
+	EXPECT_LT(rcond, 1e-5f);
+
+	// a column of zeros stops the factorization at a zero pivot
+	for (size_t i = 0; i < N; ++i) matrixf32SetValueAt(a, {i, 2}, 0.0f);
+
+	EXPECT_EQ(MatrixStatusErrSingular, matrixf32OutPlaceLU(lu, a, permutation));
+	ASSERT_EQ(MatrixStatusOK, matrixf32LUDeterminant(&det, lu, permutation));
+	EXPECT_EQ(0.0f, det);
+	ASSERT_EQ(MatrixStatusOK, matrixf32LULogDeterminant(&log_det, &sign, lu, permutation));
+	EXPECT_EQ(-INFINITY, log_det);
+	EXPECT_EQ(0.0f, sign);
+	ASSERT_EQ(MatrixStatusOK, matrixf32LURcond(&rcond, lu, permutation, norm_a, workspace.data(), workspace.size()));
+	EXPECT_EQ(0.0f, rcond);
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&lu);
+	matrixf32Destroy(&permutation);
+}
+
+TEST(Determinant, invalid_arguments) {
+	MatrixF32Ptr lu = matrixf32Create({3, 3});
+	MatrixF32Ptr permutation = matrixf32Create({3, 1});
+	MatrixF32Ptr wrong = matrixf32Create({2, 1});
+	fillRandom(lu, 11);
+
+	float result, workspace[9];
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32LUDeterminant(NULL, lu, permutation));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32LULogDeterminant(&result, NULL, lu, NULL));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32LUDeterminant(&result, lu, wrong));
+
+	ASSERT_EQ(MatrixStatusOK, matrixf32InPlaceLU(lu, permutation));
+	EXPECT_EQ(MatrixStatusOK, matrixf32LULogDeterminant(&result, NULL, lu, permutation));
+	EXPECT_EQ(MatrixStatusErrOutOfBound, matrixf32LURcond(&result, lu, permutation, 1.0f, workspace, 8));
+	EXPECT_EQ(MatrixStatusOK, matrixf32LURcond(&result, lu, permutation, 1.0f, workspace, 9));
+
+	matrixf32SetValueAt(permutation, {1, 0}, 3.0f);
+	EXPECT_EQ(MatrixStatusErrOutOfBound, matrixf32LUDeterminant(&result, lu, permutation));
+	matrixf32SetValueAt(permutation, {1, 0}, 0.5f);
+	EXPECT_EQ(MatrixStatusErrOutOfBound, matrixf32LUDeterminant(&result, lu, permutation));
+
+	matrixf32Destroy(&lu);
+	matrixf32Destroy(&permutation);
+	matrixf32Destroy(&wrong);
+}
@@ -0,0 +1,139 @@
+#include "../include/matrix_f32_eigen.h"
+#include "gtest/gtest.h"
+#include "test_util.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+void fillSymmetric(MatrixF32Ptr t_mat, unsigned t_seed) {
+	const size_t n = matrixf32GetRowNumber(t_mat);
+
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t j = 0; j <= i; ++j) {
+			const float val = nextUniform(&t_seed);
+
+			matrixf32SetValueAt(t_mat, {i, j}, val);
+			matrixf32SetValueAt(t_mat, {j, i}, val);
+		}
+	}
+}
+}  // namespace
+
+TEST(SymEigen, full_decomposition) {
+	static constexpr size_t N = 50;	 // more than one panel
+
+	MatrixF32Ptr a = matrixf32Create({N, N});
+	MatrixF32Ptr values = matrixf32Create({N, 1});
+	MatrixF32Ptr vectors = matrixf32Create({N, N});
+	fillSymmetric(a, 11);
+
+	std::vector<float> workspace(matrixf32SymEigenWorkspaceLen(N, true));
+	ASSERT_EQ(MatrixStatusOK, matrixf32SymEigen(values, vectors, a, workspace.data(), workspace.size()));
+
+	float trace = 0.0f, sum = 0.0f;
+
+	for (size_t j = 0; j < N; ++j) {
+		trace += matrixf32GetValueAt(a, {j, j});
+		sum += matrixf32GetValueAt(values, {j, 0});
+
+		if (j > 0) {
+			EXPECT_GE(matrixf32GetValueAt(values, {j - 1, 0}), matrixf32GetValueAt(values, {j, 0}));
+		}
+	}
+
+	EXPECT_NEAR(trace, sum, 1e-3f);
+
+	// A v = lambda v and V^T V = I
+	for (size_t j = 0; j < N; ++j) {
+		const float lambda = matrixf32GetValueAt(values, {j, 0});
+
+		for (size_t i = 0; i < N; ++i) {
+			float av = 0.0f;
+
+			for (size_t c = 0; c < N; ++c) {
+				av += matrixf32GetValueAt(a, {i, c}) * matrixf32GetValueAt(vectors, {c, j});
+			}
+
+			EXPECT_NEAR(lambda * matrixf32GetValueAt(vectors, {i, j}), av, 5e-5f);
+		}
+
+		for (size_t l = 0; l <= j; ++l) {
+			float dot = 0.0f;
+
+			for (size_t i = 0; i < N; ++i) {
+				dot += matrixf32GetValueAt(vectors, {i, j}) * matrixf32GetValueAt(vectors, {i, l});
+			}
+
+			EXPECT_NEAR(l == j ? 1.0f : 0.0f, dot, 1e-5f);
+		}
+	}
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&values);
+	matrixf32Destroy(&vectors);
+}
+
+TEST(SymEigen, top_k_and_values_only) {
+	static constexpr size_t N = 8;
+
+	// eigenvalues 1..8 and eigenvectors e_i mixed by a Givens rotation of the last two axes
+	MatrixF32Ptr a = matrixf32Create({N, N});
+	const float c = 0.6f, s = 0.8f;
+
+	for (size_t i = 0; i < N - 2; ++i) {
+		matrixf32SetValueAt(a, {i, i}, (float)(i + 1));
+	}
+
+	matrixf32SetValueAt(a, {N - 2, N - 2}, 7.0f * c * c + 8.0f * s * s);
+	matrixf32SetValueAt(a, {N - 1, N - 1}, 7.0f * s * s + 8.0f * c * c);
+	matrixf32SetValueAt(a, {N - 1, N - 2}, (8.0f - 7.0f) * c * s);
+
+	MatrixF32Ptr values = matrixf32Create({3, 1});
+	MatrixF32Ptr vectors = matrixf32Create({N, 3});
+	std::vector<float> workspace(matrixf32SymEigenWorkspaceLen(N, true));
+
+	// upper triangle left 0, only the lower one is read
+	ASSERT_EQ(MatrixStatusOK, matrixf32SymEigen(values, vectors, a, workspace.data(), workspace.size()));
+	EXPECT_NEAR(8.0f, matrixf32GetValueAt(values, {0, 0}), 1e-5f);
+	EXPECT_NEAR(7.0f, matrixf32GetValueAt(values, {1, 0}), 1e-5f);
+	EXPECT_NEAR(6.0f, matrixf32GetValueAt(values, {2, 0}), 1e-5f);
+
+	// eigenvector of 8 is (0, .., s, c), of 7 (0, .., c, -s) with the sign making the largest component positive
+	EXPECT_NEAR(s, matrixf32GetValueAt(vectors, {N - 2, 0}), 1e-5f);
+	EXPECT_NEAR(c, matrixf32GetValueAt(vectors, {N - 1, 0}), 1e-5f);
+	EXPECT_NEAR(-c, matrixf32GetValueAt(vectors, {N - 2, 1}), 1e-5f);
+	EXPECT_NEAR(s, matrixf32GetValueAt(vectors, {N - 1, 1}), 1e-5f);
+	EXPECT_NEAR(1.0f, matrixf32GetValueAt(vectors, {N - 3, 2}), 1e-5f);
+
+	MatrixF32Ptr only = matrixf32Create({3, 1});
+	std::vector<float> small_workspace(matrixf32SymEigenWorkspaceLen(N, false));
+	ASSERT_LT(small_workspace.size(), workspace.size());
+
+	ASSERT_EQ(MatrixStatusOK, matrixf32SymEigen(only, nullptr, a, small_workspace.data(), small_workspace.size()));
+	EXPECT_TRUE(matrixf32TwoMatEqual(values, only, 1e-5f));
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&values);
+	matrixf32Destroy(&vectors);
+	matrixf32Destroy(&only);
+}
+
+TEST(SymEigen, invalid_input) {
+	MatrixF32Ptr a = matrixf32Create({4, 4});
+	MatrixF32Ptr values = matrixf32Create({4, 1});
+	MatrixF32Ptr too_many = matrixf32Create({5, 1});
+	MatrixF32Ptr vectors = matrixf32Create({4, 2});
+	std::vector<float> workspace(matrixf32SymEigenWorkspaceLen(4, true));
+
+	EXPECT_EQ(0u, matrixf32SymEigenWorkspaceLen(0, true));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32SymEigen(values, nullptr, a, nullptr, 0));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32SymEigen(too_many, nullptr, a, workspace.data(), workspace.size()));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32SymEigen(values, vectors, a, workspace.data(), workspace.size()));
+	EXPECT_EQ(MatrixStatusErrOutOfBound,
+			  matrixf32SymEigen(values, nullptr, a, workspace.data(), matrixf32SymEigenWorkspaceLen(4, false) - 1));
+
+	for (MatrixF32Ptr mat : {a, values, too_many, vectors}) {
+		matrixf32Destroy(&mat);
+	}
+}
@@ -0,0 +1,201 @@
+#include "../include/matrix_f32_elementwise.h"
+#include "gtest/gtest.h"
+#include "test_util.h"
+
+#include <cmath>
+
+namespace {
+// 300 columns span several blocks at the default block sizes, 7 rows leave a remainder in the vector loops
+constexpr size_t M = 7, N = 300;
+}  // namespace
+
+TEST(Elementwise, hadamard_in_every_layout_combination) {
+	for (MatrixLayout result_layout : layouts) {
+		for (MatrixLayout operand_layout : layouts) {
+			MatrixF32Ptr b = matrixf32CreateWithLayout({M, N}, operand_layout);
+			MatrixF32Ptr c = matrixf32CreateWithLayout({M, N}, MatrixLayoutRowMajor);
+			MatrixF32Ptr product = matrixf32CreateWithLayout({M, N}, result_layout);
+			MatrixF32Ptr quotient = matrixf32CreateWithLayout({M, N}, result_layout);
+			fillRandom(b, 3);
+			fillRandom(c, 5);
+
+			ASSERT_EQ(MatrixStatusOK, matrixf32HadamardProduct(product, b, c));
+			ASSERT_EQ(MatrixStatusOK, matrixf32HadamardDivide(quotient, b, c));
+
+			for (size_t i = 0; i < M; ++i) {
+				for (size_t j = 0; j < N; ++j) {
+					const float x = matrixf32GetValueAt(b, {i, j}), y = matrixf32GetValueAt(c, {i, j});
+
+					EXPECT_EQ(x * y, matrixf32GetValueAt(product, {i, j}));
+					EXPECT_EQ(x / y, matrixf32GetValueAt(quotient, {i, j}));
+				}
+			}
+
+			// in place, b = b .* b
+			MatrixF32Ptr expected = matrixf32CreateWithLayout({M, N}, result_layout);
+			ASSERT_EQ(MatrixStatusOK, matrixf32HadamardProduct(expected, b, b));
+			ASSERT_EQ(MatrixStatusOK, matrixf32HadamardProduct(b, b, b));
+			EXPECT_TRUE(matrixf32TwoMatEqual(expected, b, 0.0f));
+
+			matrixf32Destroy(&b);
+			matrixf32Destroy(&c);
+			matrixf32Destroy(&product);
+			matrixf32Destroy(&quotient);
+			matrixf32Destroy(&expected);
+		}
+	}
+}
+
+TEST(Elementwise, broadcast_rows_and_columns) {
+	MatrixF32Ptr row = matrixf32Create({1, N});
+	MatrixF32Ptr col = matrixf32Create({M, 1});
+	fillRandom(row, 7);
+	fillRandom(col, 11);
+
+	for (MatrixLayout result_layout : layouts) {
+		for (MatrixLayout operand_layout : layouts) {
+			MatrixF32Ptr b = matrixf32CreateWithLayout({M, N}, operand_layout);
+			MatrixF32Ptr result = matrixf32CreateWithLayout({M, N}, result_layout);
+			fillRandom(b, 13);
+
+			ASSERT_EQ(MatrixStatusOK, matrixf32BroadcastRow(result, b, MatrixZipSubtract, row));
+
+			for (size_t i = 0; i < M; ++i) {
+				for (size_t j = 0; j < N; ++j) {
+					const float expected = matrixf32GetValueAt(b, {i, j}) - matrixf32GetValueAt(row, {0, j});
+
+					EXPECT_EQ(expected, matrixf32GetValueAt(result, {i, j}));
+				}
+			}
+
+			ASSERT_EQ(MatrixStatusOK, matrixf32BroadcastCol(result, b, MatrixZipMultiply, col));
+
+			for (size_t i = 0; i < M; ++i) {
+				for (size_t j = 0; j < N; ++j) {
+					const float expected = matrixf32GetValueAt(b, {i, j}) * matrixf32GetValueAt(col, {i, 0});
+
+					EXPECT_EQ(expected, matrixf32GetValueAt(result, {i, j}));
+				}
+			}
+
+			matrixf32Destroy(&b);
+			matrixf32Destroy(&result);
+		}
+	}
+
+	// normalizing the rows in place, the vector may be given as a row or a column
+	MatrixF32Ptr a = matrixf32Create({2, 3});
+	float values[]{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f}, sums[]{6.0f, 15.0f};
+	MatrixF32Ptr source = matrixf32CreateContainer({2, 3}, values, 6);
+	MatrixF32Ptr sum = matrixf32CreateContainer({1, 2}, sums, 2);
+	ASSERT_EQ(MatrixStatusOK, matrixf32Copy(a, source));
+	ASSERT_EQ(MatrixStatusOK, matrixf32BroadcastCol(a, a, MatrixZipDivide, sum));
+	EXPECT_FLOAT_EQ(2.0f / 6.0f, matrixf32GetValueAt(a, {0, 1}));
+	EXPECT_FLOAT_EQ(6.0f / 15.0f, matrixf32GetValueAt(a, {1, 2}));
+
+	matrixf32Destroy(&row);
+	matrixf32Destroy(&col);
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&source);
+	matrixf32Destroy(&sum);
+}
+
+TEST(Elementwise, map_and_fused_zip) {
+	for (MatrixLayout layout : layouts) {
+		MatrixF32Ptr b = matrixf32CreateWithLayout({M, N}, layout);
+		MatrixF32Ptr c = matrixf32Create({M, N});
+		MatrixF32Ptr result = matrixf32Create({M, N});
+		fillRandom(b, 17);
+		fillRandom(c, 19);
+
+		ASSERT_EQ(MatrixStatusOK, matrixf32Map(result, b, {MatrixMapAbs, 0.0f, 0.0f}));
+
+		for (size_t i = 0; i < M; ++i) {
+			for (size_t j = 0; j < N; ++j) {
+				EXPECT_EQ(std::fabs(matrixf32GetValueAt(b, {i, j})), matrixf32GetValueAt(result, {i, j}));
+			}
+		}
+
+		// exp(b + c) and sqrt(|b| * |c|) in one pass each
+		ASSERT_EQ(MatrixStatusOK, matrixf32Zip(result, b, MatrixZipAdd, c, {MatrixMapExp, 0.0f, 0.0f}));
+
+		for (size_t i = 0; i < M; ++i) {
+			for (size_t j = 0; j < N; ++j) {
+				const float expected = std::exp(matrixf32GetValueAt(b, {i, j}) + matrixf32GetValueAt(c, {i, j}));
+
+				EXPECT_NEAR(expected, matrixf32GetValueAt(result, {i, j}), 2.5e-7f * expected);
+			}
+		}
+
+		MatrixF32Ptr b_abs = matrixf32Create({M, N});
+		MatrixF32Ptr c_abs = matrixf32Create({M, N});
+		ASSERT_EQ(MatrixStatusOK, matrixf32Map(b_abs, b, {MatrixMapAbs, 0.0f, 0.0f}));
+		ASSERT_EQ(MatrixStatusOK, matrixf32Map(c_abs, c, {MatrixMapAbs, 0.0f, 0.0f}));
+		ASSERT_EQ(MatrixStatusOK, matrixf32Zip(result, b_abs, MatrixZipMultiply, c_abs, {MatrixMapSqrt, 0.0f, 0.0f}));
+
+		for (size_t i = 0; i < M; ++i) {
+			for (size_t j = 0; j < N; ++j) {
+				const float product = matrixf32GetValueAt(b_abs, {i, j}) * matrixf32GetValueAt(c_abs, {i, j});
+
+				EXPECT_EQ(std::sqrt(product), matrixf32GetValueAt(result, {i, j}));
+			}
+		}
+
+		matrixf32Destroy(&b);
+		matrixf32Destroy(&c);
+		matrixf32Destroy(&result);
+		matrixf32Destroy(&b_abs);
+		matrixf32Destroy(&c_abs);
+	}
+}
+
+TEST(Elementwise, exp_and_clamp_edge_cases) {
+	float values[]{0.0f, 1.0f, -1.0f, 88.7f, 89.0f, -103.0f, -105.0f, INFINITY, -INFINITY, NAN, 0.5f, -0.5f};
+	MatrixF32Ptr x = matrixf32CreateContainer({1, 12}, values, 12);
+	MatrixF32Ptr y = matrixf32Create({1, 12});
+
+	ASSERT_EQ(MatrixStatusOK, matrixf32Map(y, x, {MatrixMapExp, 0.0f, 0.0f}));
+
+	const float *exp = matrixf32GetBuffer(y);
+	EXPECT_EQ(1.0f, exp[0]);
+	EXPECT_FLOAT_EQ(std::exp(1.0f), exp[1]);
+	EXPECT_FLOAT_EQ(std::exp(88.7f), exp[3]);
+	EXPECT_EQ(INFINITY, exp[4]);
+	EXPECT_LT(0.0f, exp[5]);
+	EXPECT_EQ(0.0f, exp[6]);
+	EXPECT_EQ(INFINITY, exp[7]);
+	EXPECT_EQ(0.0f, exp[8]);
+	EXPECT_TRUE(std::isnan(exp[9]));
+
+	ASSERT_EQ(MatrixStatusOK, matrixf32Map(y, x, {MatrixMapClamp, -0.5f, 1.0f}));
+
+	const float *clamped = matrixf32GetBuffer(y);
+	EXPECT_EQ(1.0f, clamped[3]);
+	EXPECT_EQ(-0.5f, clamped[8]);
+	EXPECT_TRUE(std::isnan(clamped[9]));
+	EXPECT_EQ(0.5f, clamped[10]);
+
+	matrixf32Destroy(&x);
+	matrixf32Destroy(&y);
+}
+
+TEST(Elementwise, invalid_arguments) {
+	MatrixF32Ptr a = matrixf32Create({3, 4});
+	MatrixF32Ptr b = matrixf32Create({4, 3});
+	MatrixF32Ptr v = matrixf32Create({3, 1});
+
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32HadamardProduct(a, NULL, a));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32HadamardDivide(a, a, b));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32BroadcastRow(a, a, MatrixZipAdd, v));
+	EXPECT_EQ(MatrixStatusOK, matrixf32BroadcastCol(a, a, MatrixZipAdd, v));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32BroadcastCol(a, a, MatrixZipAdd, b));
+	EXPECT_EQ(MatrixStatusErrUnknownOpt, matrixf32BroadcastCol(a, a, (MatrixZipOp)4, v));
+	EXPECT_EQ(MatrixStatusErrUnknownOpt, matrixf32Map(a, a, {(MatrixMapFunc)5, 0.0f, 0.0f}));
+	EXPECT_EQ(MatrixStatusErrUnknownOpt, matrixf32Map(a, a, {MatrixMapClamp, 1.0f, -1.0f}));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32Map(b, a, {MatrixMapAbs, 0.0f, 0.0f}));
+	EXPECT_EQ(MatrixStatusErrUnknownOpt, matrixf32Zip(a, a, MatrixZipAdd, a, {MatrixMapClamp, NAN, 1.0f}));
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&b);
+	matrixf32Destroy(&v);
+}
@@ -0,0 +1,130 @@
+#include "../include/matrix_f32.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+
+namespace {
+float system_buffer[]{4.0f, 1.0f, 2.0f, 1.0f, 5.0f, 3.0f, 2.0f, 3.0f, 6.0f};
+}
+
+TEST(FactorCache, mutating_functions_bump_the_version) {
+	MatrixF32Ptr mat = matrixf32Create({3, 3});
+	MatrixF32Ptr other = matrixf32Create({3, 3});
+
+	EXPECT_EQ(0u, matrixf32GetVersion(mat));
+
+	uint32_t version = 0;
+	auto bumped = [&]() {
+		const uint32_t previous = version;
+		version = matrixf32GetVersion(mat);
+
+		return version > previous;
+	};
+
+	matrixf32SetValueAt(mat, {0, 0}, 1.0f);
+	EXPECT_TRUE(bumped());
+	matrixf32Copy(mat, other);
+	EXPECT_TRUE(bumped());
+	matrixf32Add(mat, other, other);
+	EXPECT_TRUE(bumped());
+	matrixf32Swap(mat, 0, 1, SwapOptRow);
+	EXPECT_TRUE(bumped());
+	matrixf32GetBuffer(mat);
+	EXPECT_TRUE(bumped());
+
+	// read only and failing calls leave it unchanged
+	matrixf32GetValueAt(mat, {0, 0});
+	matrixf32TwoMatEqual(mat, other, 0.0f);
+	matrixf32Add(other, mat, mat);
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32SetValueAt(mat, {3, 0}, 1.0f));
+	EXPECT_EQ(version, matrixf32GetVersion(mat));
+
+	matrixf32Destroy(&mat);
+	matrixf32Destroy(&other);
+}
+
+TEST(FactorCache, solve_with_and_without_cache) {
+	float column_buffer[]{1.0f, 0.0f, 2.0f, 1.0f, 3.0f, 0.0f};
+
+	MatrixF32Ptr a = matrixf32CreateContainer({3, 3}, system_buffer, 9);
+	MatrixF32Ptr column = matrixf32CreateContainer({3, 2}, column_buffer, 6);
+	MatrixF32Ptr result = matrixf32Create({3, 2});
+	MatrixF32Ptr cached_result = matrixf32Create({3, 2});
+	MatrixF32Ptr check = matrixf32Create({3, 2});
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32Solve(result, a, column));
+	EXPECT_EQ(MatrixStatusOK, matrixf32Multiplication(check, a, result));
+	EXPECT_TRUE(matrixf32TwoMatEqual(check, column, 1e-5f));
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32SetFactorCache(a, true));
+	EXPECT_EQ(MatrixStatusOK, matrixf32Solve(cached_result, a, column));
+	EXPECT_EQ(MatrixStatusOK, matrixf32Solve(cached_result, a, column));
+	EXPECT_TRUE(matrixf32TwoMatEqual(cached_result, result, 0.0f));
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&column);
+	matrixf32Destroy(&result);
+	matrixf32Destroy(&cached_result);
+	matrixf32Destroy(&check);
+}
+
+TEST(FactorCache, refactors_after_the_matrix_changes) {
+	float buffer[9];
+	std::copy(system_buffer, system_buffer + 9, buffer);
+
+	MatrixF32Ptr a = matrixf32CreateContainer({3, 3}, buffer, 9);
+	MatrixF32Ptr inverse = matrixf32Create({3, 3});
+	MatrixF32Ptr expected = matrixf32Create({3, 3});
+	MatrixF32Ptr column = matrixf32Create({3, 1});
+	MatrixF32Ptr result = matrixf32Create({3, 1});
+	MatrixF32Ptr expected_result = matrixf32Create({3, 1});
+
+	matrixf32SetAllEntriesTo(column, 1.0f);
+	EXPECT_EQ(MatrixStatusOK, matrixf32SetFactorCache(a, true));
+	EXPECT_EQ(MatrixStatusOK, matrixf32Inverse(inverse, a));
+
+	matrixf32SetValueAt(a, {0, 0}, 10.0f);
+	EXPECT_EQ(MatrixStatusOK, matrixf32Inverse(inverse, a));
+
+	// a write straight into the caller's buffer is only seen once the matrix is touched again
+	buffer[4] = 7.0f;
+	matrixf32GetBuffer(a);
+	EXPECT_EQ(MatrixStatusOK, matrixf32Inverse(inverse, a));
+	EXPECT_EQ(MatrixStatusOK, matrixf32Solve(result, a, column));
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32SetFactorCache(a, false));
+	EXPECT_EQ(MatrixStatusOK, matrixf32Inverse(expected, a));
+	EXPECT_EQ(MatrixStatusOK, matrixf32Solve(expected_result, a, column));
+
+	EXPECT_TRUE(matrixf32TwoMatEqual(inverse, expected, 0.0f));
+	EXPECT_TRUE(matrixf32TwoMatEqual(result, expected_result, 0.0f));
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&inverse);
+	matrixf32Destroy(&expected);
+	matrixf32Destroy(&column);
+	matrixf32Destroy(&result);
+	matrixf32Destroy(&expected_result);
+}
+
+TEST(FactorCache, singular_and_invalid_input) {
+	float singular_buffer[]{1.0f, 2.0f, 2.0f, 4.0f};
+
+	MatrixF32Ptr singular = matrixf32CreateContainer({2, 2}, singular_buffer, 4);
+	MatrixF32Ptr non_square = matrixf32Create({2, 3});
+	MatrixF32Ptr column = matrixf32Create({2, 1});
+	MatrixF32Ptr result = matrixf32Create({2, 1});
+
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32SetFactorCache(non_square, true));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32SetFactorCache(nullptr, true));
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32SetFactorCache(singular, true));
+	EXPECT_EQ(MatrixStatusErrSingular, matrixf32Solve(result, singular, column));
+	EXPECT_EQ(MatrixStatusErrSingular, matrixf32Solve(result, singular, column));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32Solve(result, non_square, column));
+
+	matrixf32Destroy(&singular);
+	matrixf32Destroy(&non_square);
+	matrixf32Destroy(&column);
+	matrixf32Destroy(&result);
+}
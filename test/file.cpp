@@ -0,0 +1,99 @@
+#include "../include/matrix_f32_file.h"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+
+static const char* const FILE_PATH = "matrix_f32_file_test.mf32";
+
+TEST(File, written_matrix_can_be_read_back) {
+	float buffer[]{1.0f, -2.5f, 3.25f, 4.0f, 5.5f, -6.0f};
+
+	MatrixF32Ptr source = matrixf32CreateContainer({2, 3}, buffer, 6);
+	MatrixF32Ptr dest = matrixf32Create({2, 3});
+	MatrixF32Ptr wrong_dim = matrixf32Create({3, 2});
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32FileWrite(FILE_PATH, source));
+	EXPECT_EQ(MatrixStatusOK, matrixf32FileRead(FILE_PATH, dest));
+	EXPECT_TRUE(matrixf32TwoMatEqual(source, dest, 0.0f));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32FileRead(FILE_PATH, wrong_dim));
+
+	std::remove(FILE_PATH);
+	matrixf32Destroy(&source);
+	matrixf32Destroy(&dest);
+	matrixf32Destroy(&wrong_dim);
+}
+
+TEST(File, mapped_matrix_wraps_file_payload) {
+	float buffer[]{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f};
+
+	MatrixF32Ptr source = matrixf32CreateContainer({3, 3}, buffer, 9);
+	EXPECT_EQ(MatrixStatusOK, matrixf32FileWrite(FILE_PATH, source));
+
+	MatrixF32FileMapType map;
+	MatrixStatus status = matrixf32FileMap(FILE_PATH, true, &map);
+
+	if (status == MatrixStatusErrIO) {
+		GTEST_SKIP() << "mmap is not available";
+	}
+
+	ASSERT_EQ(MatrixStatusOK, status);
+	EXPECT_EQ(OwnerShipOuter, matrixf32GetOwnership(map.m_matrix));
+	EXPECT_EQ(0u, reinterpret_cast<uintptr_t>(matrixf32GetBuffer(map.m_matrix)) % MATRIX_F32_FILE_ALIGNMENT);
+	EXPECT_TRUE(matrixf32TwoMatEqual(source, map.m_matrix, 0.0f));
+
+	// copy-on-write, the file keeps the original value
+	EXPECT_EQ(MatrixStatusOK, matrixf32SetValueAt(map.m_matrix, {0, 0}, 100.0f));
+	EXPECT_EQ(MatrixStatusOK, matrixf32FileUnmap(&map));
+	EXPECT_EQ(nullptr, map.m_matrix);
+
+	MatrixF32Ptr dest = matrixf32Create({3, 3});
+	EXPECT_EQ(MatrixStatusOK, matrixf32FileRead(FILE_PATH, dest));
+	EXPECT_TRUE(matrixf32TwoMatEqual(source, dest, 0.0f));
+
+	std::remove(FILE_PATH);
+	matrixf32Destroy(&source);
+	matrixf32Destroy(&dest);
+}
+
+TEST(File, corrupted_file_will_return_error) {
+	float buffer[]{1.0f, 2.0f, 3.0f, 4.0f};
+
+	MatrixF32Ptr source = matrixf32CreateContainer({2, 2}, buffer, 4);
+	MatrixF32Ptr dest = matrixf32Create({2, 2});
+	EXPECT_EQ(MatrixStatusOK, matrixf32FileWrite(FILE_PATH, source));
+
+	// flip one payload byte
+	FILE* file = std::fopen(FILE_PATH, "r+b");
+	ASSERT_NE(nullptr, file);
+	std::fseek(file, MATRIX_F32_FILE_ALIGNMENT + 1, SEEK_SET);
+	std::fputc(0x55, file);
+	std::fclose(file);
+
+	MatrixF32FileMapType map;
+	EXPECT_EQ(MatrixStatusErrIO, matrixf32FileRead(FILE_PATH, dest));
+	EXPECT_EQ(MatrixStatusErrIO, matrixf32FileMap(FILE_PATH, true, &map));
+
+	// bad magic
+	file = std::fopen(FILE_PATH, "r+b");
+	std::fputc('X', file);
+	std::fclose(file);
+	EXPECT_EQ(MatrixStatusErrIO, matrixf32FileMap(FILE_PATH, false, &map));
+
+	std::remove(FILE_PATH);
+	matrixf32Destroy(&source);
+	matrixf32Destroy(&dest);
+}
+
+TEST(File, null_ptr_input_will_return_error) {
+	MatrixF32Ptr mat = matrixf32Create({2, 2});
+	MatrixF32FileMapType map;
+
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32FileWrite(0, mat));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32FileWrite(FILE_PATH, 0));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32FileRead(FILE_PATH, 0));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32FileMap(FILE_PATH, true, 0));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32FileMap(0, true, &map));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32FileUnmap(0));
+
+	matrixf32Destroy(&mat);
+}
@@ -0,0 +1,262 @@
+#include "../include/matrix_f32_fixed.h"
+#include "gtest/gtest.h"
+#include "test_util.h"
+
+#include <cmath>
+
+namespace {
+float maxDifference(MatrixF32Ptr t_mat_a, MatrixF32Ptr t_mat_b) {
+	float diff = 0.0f;
+
+	for (size_t i = 0; i < matrixf32GetRowNumber(t_mat_a); ++i) {
+		for (size_t j = 0; j < matrixf32GetColNumber(t_mat_a); ++j) {
+			const float a = matrixf32GetValueAt(t_mat_a, {i, j});
+			diff = std::fmax(diff, std::fabs(a - matrixf32GetValueAt(t_mat_b, {i, j})));
+		}
+	}
+
+	return diff;
+}
+}  // namespace
+
+TEST(FixedPoint, conversion_rounds_and_saturates) {
+	float val[4] = {0.5f, -0.25f, 1.5f, -2.0f};
+	MatrixF32Ptr source = matrixf32CreateContainer({2, 2}, val, 4);
+	MatrixF32Ptr back = matrixf32Create({2, 2});
+	MatrixQ15Ptr q15 = matrixq15Create({2, 2});
+	MatrixQ31Ptr q31 = matrixq31Create({2, 2});
+
+	ASSERT_EQ(MatrixStatusOK, matrixq15FromF32(q15, source));
+	ASSERT_EQ(MatrixStatusOK, matrixq31FromF32(q31, source));
+
+	const int16_t *q15_val = matrixq15GetBuffer(q15);
+	EXPECT_EQ(16384, q15_val[0]);
+	EXPECT_EQ(-8192, q15_val[1]);
+	EXPECT_EQ(INT16_MAX, q15_val[2]);
+	EXPECT_EQ(INT16_MIN, q15_val[3]);
+
+	const int32_t *q31_val = matrixq31GetBuffer(q31);
+	EXPECT_EQ(1 << 30, q31_val[0]);
+	EXPECT_EQ(-(1 << 29), q31_val[1]);
+	EXPECT_EQ(INT32_MAX, q31_val[2]);
+	EXPECT_EQ(INT32_MIN, q31_val[3]);
+
+	ASSERT_EQ(MatrixStatusOK, matrixq15ToF32(back, q15));
+	EXPECT_FLOAT_EQ(0.5f, matrixf32GetValueAt(back, {0, 0}));
+	EXPECT_FLOAT_EQ(-1.0f, matrixf32GetValueAt(back, {1, 1}));
+
+	matrixf32Destroy(&source);
+	matrixf32Destroy(&back);
+	matrixq15Destroy(&q15);
+	matrixq31Destroy(&q31);
+}
+
+TEST(FixedPoint, add_subtract_scale_saturate) {
+	MatrixQ15Ptr a = matrixq15Create({1, 3});
+	MatrixQ15Ptr b = matrixq15Create({1, 3});
+	MatrixQ15Ptr result = matrixq15Create({1, 3});
+
+	int16_t *a_val = matrixq15GetBuffer(a);
+	int16_t *b_val = matrixq15GetBuffer(b);
+	a_val[0] = 24576, a_val[1] = -24576, a_val[2] = 1000;
+	b_val[0] = 24576, b_val[1] = 24576, b_val[2] = -3000;
+
+	ASSERT_EQ(MatrixStatusOK, matrixq15Add(result, a, b));
+	EXPECT_EQ(INT16_MAX, matrixq15GetBuffer(result)[0]);
+	EXPECT_EQ(0, matrixq15GetBuffer(result)[1]);
+	EXPECT_EQ(-2000, matrixq15GetBuffer(result)[2]);
+
+	ASSERT_EQ(MatrixStatusOK, matrixq15Subtract(result, a, b));
+	EXPECT_EQ(0, matrixq15GetBuffer(result)[0]);
+	EXPECT_EQ(INT16_MIN, matrixq15GetBuffer(result)[1]);
+	EXPECT_EQ(4000, matrixq15GetBuffer(result)[2]);
+
+	// -1 * -1 does not fit
+	b_val[0] = INT16_MIN;
+	ASSERT_EQ(MatrixStatusOK, matrixq15Scale(result, INT16_MIN, b));
+	EXPECT_EQ(INT16_MAX, matrixq15GetBuffer(result)[0]);
+	EXPECT_EQ(-24576, matrixq15GetBuffer(result)[1]);
+
+	MatrixQ31Ptr c = matrixq31Create({1, 2});
+	MatrixQ31Ptr c_result = matrixq31Create({1, 2});
+	matrixq31GetBuffer(c)[0] = INT32_MAX;
+	matrixq31GetBuffer(c)[1] = INT32_MIN;
+
+	ASSERT_EQ(MatrixStatusOK, matrixq31Add(c_result, c, c));
+	EXPECT_EQ(INT32_MAX, matrixq31GetBuffer(c_result)[0]);
+	EXPECT_EQ(INT32_MIN, matrixq31GetBuffer(c_result)[1]);
+
+	ASSERT_EQ(MatrixStatusOK, matrixq31Scale(c_result, INT32_MIN, c));
+	EXPECT_EQ(-INT32_MAX, matrixq31GetBuffer(c_result)[0]);
+	EXPECT_EQ(INT32_MAX, matrixq31GetBuffer(c_result)[1]);
+
+	matrixq15Destroy(&a);
+	matrixq15Destroy(&b);
+	matrixq15Destroy(&result);
+	matrixq31Destroy(&c);
+	matrixq31Destroy(&c_result);
+}
+
+TEST(FixedPoint, multiplication_matches_float) {
+	static constexpr size_t N = 16;
+
+	MatrixF32Ptr a = matrixf32Create({N, N});
+	MatrixF32Ptr b = matrixf32Create({N, 5});
+	MatrixF32Ptr expected = matrixf32Create({N, 5});
+	MatrixF32Ptr actual = matrixf32Create({N, 5});
+
+	// |sum| <= 16 * 0.25 * 0.25 = 1
+	fillRandom(a, 1, 0.25f);
+	fillRandom(b, 2, 0.25f);
+	matrixf32Multiplication(expected, a, b);
+
+	MatrixQ15Ptr a15 = matrixq15Create({N, N});
+	MatrixQ15Ptr b15 = matrixq15Create({N, 5});
+	MatrixQ15Ptr r15 = matrixq15Create({N, 5});
+	matrixq15FromF32(a15, a);
+	matrixq15FromF32(b15, b);
+
+	ASSERT_EQ(MatrixStatusOK, matrixq15Multiplication(r15, a15, b15));
+	matrixq15ToF32(actual, r15);
+	EXPECT_LT(maxDifference(expected, actual), N * 0.25f / 32768.0f + 1.0f / 32768.0f);
+
+	MatrixQ31Ptr a31 = matrixq31Create({N, N});
+	MatrixQ31Ptr b31 = matrixq31Create({N, 5});
+	MatrixQ31Ptr r31 = matrixq31Create({N, 5});
+	matrixq31FromF32(a31, a);
+	matrixq31FromF32(b31, b);
+
+	ASSERT_EQ(MatrixStatusOK, matrixq31Multiplication(r31, a31, b31));
+	matrixq31ToF32(actual, r31);
+	EXPECT_LT(maxDifference(expected, actual), 1e-6f);
+
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixq15Multiplication(r15, b15, a15));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixq31Multiplication(r31, b31, a31));
+
+	for (MatrixF32Ptr mat : {a, b, expected, actual}) {
+		matrixf32Destroy(&mat);
+	}
+
+	for (MatrixQ15Ptr mat : {a15, b15, r15}) {
+		matrixq15Destroy(&mat);
+	}
+
+	for (MatrixQ31Ptr mat : {a31, b31, r31}) {
+		matrixq31Destroy(&mat);
+	}
+}
+
+TEST(FixedPoint, q31_multiplication_bounds_the_inner_dimension) {
+	static constexpr size_t LIMIT = 65535;
+
+	MatrixF32Ptr actual = matrixf32Create({1, 1});
+	MatrixQ31Ptr r31 = matrixq31Create({1, 1});
+
+	for (size_t inner : {LIMIT, LIMIT + 1}) {
+		MatrixF32Ptr row = matrixf32Create({1, inner});
+		MatrixF32Ptr column = matrixf32Create({inner, 1});
+		MatrixQ31Ptr row31 = matrixq31Create({1, inner});
+		MatrixQ31Ptr column31 = matrixq31Create({inner, 1});
+
+		// -1 is the full scale value, every product is the largest one
+		matrixf32SetAllEntriesTo(row, -1.0f);
+		matrixf32SetAllEntriesTo(column, -1.0f);
+		matrixq31FromF32(row31, row);
+		matrixq31FromF32(column31, column);
+
+		if (inner == LIMIT) {
+			ASSERT_EQ(MatrixStatusOK, matrixq31Multiplication(r31, row31, column31));
+			matrixq31ToF32(actual, r31);
+			EXPECT_EQ(1.0f, matrixf32GetValueAt(actual, {0, 0}));
+		} else {
+			EXPECT_EQ(MatrixStatusErrOutOfBound, matrixq31Multiplication(r31, row31, column31));
+		}
+
+		matrixf32Destroy(&row);
+		matrixf32Destroy(&column);
+		matrixq31Destroy(&row31);
+		matrixq31Destroy(&column31);
+	}
+
+	matrixf32Destroy(&actual);
+	matrixq31Destroy(&r31);
+}
+
+TEST(FixedPoint, solve_matches_float) {
+	static constexpr size_t N = 12;
+
+	MatrixF32Ptr a = matrixf32Create({N, N});
+	MatrixF32Ptr x = matrixf32Create({N, 2});
+	MatrixF32Ptr column = matrixf32Create({N, 2});
+	MatrixF32Ptr expected = matrixf32Create({N, 2});
+	MatrixF32Ptr actual = matrixf32Create({N, 2});
+
+	// small diagonal entries, so the elimination has to pivot and the intermediate values grow beyond 1
+	fillRandom(a, 3, 0.08f);
+	for (size_t i = 0; i < N; ++i) {
+		matrixf32SetValueAt(a, {i, (i + 5) % N}, i % 2 == 0 ? 0.6f : -0.6f);
+	}
+
+	fillRandom(x, 4, 0.9f);
+	matrixf32Multiplication(column, a, x);
+	ASSERT_EQ(MatrixStatusOK, matrixf32Solve(expected, a, column));
+
+	MatrixQ31Ptr a31 = matrixq31Create({N, N});
+	MatrixQ31Ptr column31 = matrixq31Create({N, 2});
+	MatrixQ31Ptr x31 = matrixq31Create({N, 2});
+	matrixq31FromF32(a31, a);
+	matrixq31FromF32(column31, column);
+
+	ASSERT_EQ(MatrixStatusOK, matrixq31Solve(x31, a31, column31));
+	matrixq31ToF32(actual, x31);
+	EXPECT_LT(maxDifference(expected, actual), 1e-5f);
+
+	MatrixQ15Ptr a15 = matrixq15Create({N, N});
+	MatrixQ15Ptr column15 = matrixq15Create({N, 2});
+	MatrixQ15Ptr x15 = matrixq15Create({N, 2});
+	matrixq15FromF32(a15, a);
+	matrixq15FromF32(column15, column);
+
+	ASSERT_EQ(MatrixStatusOK, matrixq15Solve(x15, a15, column15));
+	matrixq15ToF32(actual, x15);
+	EXPECT_LT(maxDifference(expected, actual), 2e-3f);
+
+	// two equal rows
+	matrixq15GetBuffer(a15)[0] = 0;
+	for (size_t j = 0; j < N; ++j) {
+		matrixq15GetBuffer(a15)[N + j] = matrixq15GetBuffer(a15)[j];
+	}
+	EXPECT_EQ(MatrixStatusErrSingular, matrixq15Solve(x15, a15, column15));
+
+	for (MatrixF32Ptr mat : {a, x, column, expected, actual}) {
+		matrixf32Destroy(&mat);
+	}
+
+	for (MatrixQ15Ptr mat : {a15, column15, x15}) {
+		matrixq15Destroy(&mat);
+	}
+
+	for (MatrixQ31Ptr mat : {a31, column31, x31}) {
+		matrixq31Destroy(&mat);
+	}
+}
+
+TEST(FixedPoint, invalid_input) {
+	MatrixQ15Ptr q15 = matrixq15Create({2, 3});
+	MatrixQ31Ptr q31 = matrixq31Create({3, 3});
+	MatrixF32Ptr f32 = matrixf32Create({3, 3});
+
+	EXPECT_EQ(nullptr, matrixq15Create({0, 3}));
+	EXPECT_EQ(nullptr, matrixq31Create({3, 0}));
+	EXPECT_EQ(nullptr, matrixq15GetBuffer(nullptr));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixq15Add(q15, nullptr, q15));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixq31Solve(q31, q31, nullptr));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixq15FromF32(q15, f32));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixq15Solve(q15, q15, q15));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixq31Destroy(nullptr));
+
+	matrixq15Destroy(&q15);
+	matrixq31Destroy(&q31);
+	matrixf32Destroy(&f32);
+	EXPECT_EQ(nullptr, q15);
+}
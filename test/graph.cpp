@@ -0,0 +1,175 @@
+#include "../include/matrix_f32_graph.h"
+#include "gtest/gtest.h"
+#include "test_util.h"
+
+#include <vector>
+
+TEST(Graph, fused_chain_matches_eager) {
+	static constexpr size_t N = 130, K = 70, M = 90;
+
+	MatrixF32Ptr x = matrixf32Create({N, K});
+	MatrixF32Ptr y = matrixf32Create({N, K});
+	MatrixF32Ptr w = matrixf32Create({K, M});
+	MatrixF32Ptr z = matrixf32Create({N, M});
+	MatrixF32Ptr scaled = matrixf32Create({N, K});
+	MatrixF32Ptr sum = matrixf32Create({N, K});
+	MatrixF32Ptr product = matrixf32Create({N, M});
+	MatrixF32Ptr result = matrixf32Create({N, M});
+	MatrixF32Ptr expected = matrixf32Create({N, M});
+
+	MatrixF32GraphPtr graph = matrixf32GraphCreate();
+	ASSERT_NE(nullptr, graph);
+
+	// result = (2 * x + y) * w - z
+	EXPECT_EQ(MatrixStatusOK, matrixf32GraphScale(graph, scaled, 2.0f, x));
+	EXPECT_EQ(MatrixStatusOK, matrixf32GraphAdd(graph, sum, scaled, y));
+	EXPECT_EQ(MatrixStatusOK, matrixf32GraphMultiplication(graph, product, sum, w));
+	EXPECT_EQ(MatrixStatusOK, matrixf32GraphSubtract(graph, result, product, z));
+	EXPECT_EQ(MatrixStatusOK, matrixf32GraphSetTemporary(graph, scaled));
+	EXPECT_EQ(MatrixStatusOK, matrixf32GraphSetTemporary(graph, sum));
+	EXPECT_EQ(MatrixStatusOK, matrixf32GraphSetTemporary(graph, product));
+	EXPECT_EQ(MatrixStatusOK, matrixf32GraphCompile(graph));
+
+	// elementwise prologue, multiplication with the subtraction as epilogue
+	EXPECT_EQ(2u, matrixf32GraphGetStepNumber(graph));
+
+	for (unsigned seed : {1u, 2u}) {
+		fillRandom(x, seed, 2.0f);
+		fillRandom(y, seed + 10, 2.0f);
+		fillRandom(w, seed + 20, 2.0f);
+		fillRandom(z, seed + 30, 3.0f);
+		matrixf32SetAllEntriesTo(product, 0.0f);
+
+		EXPECT_EQ(MatrixStatusOK, matrixf32GraphReplay(graph));
+
+		matrixf32Scale(scaled, 2.0f, x);
+		matrixf32Add(sum, scaled, y);
+		matrixf32Multiplication(expected, sum, w);
+		matrixf32Subtract(expected, expected, z);
+
+		EXPECT_TRUE(matrixf32TwoMatEqual(result, expected, 1e-2f));
+	}
+
+	// the product is only used inside the epilogue and never written back
+	MatrixF32Ptr zero = matrixf32Create({N, M});
+	EXPECT_TRUE(matrixf32TwoMatEqual(product, zero, 0.0f));
+
+	matrixf32GraphDestroy(&graph);
+	EXPECT_EQ(nullptr, graph);
+
+	for (MatrixF32Ptr mat : {x, y, w, z, scaled, sum, product, result, expected, zero}) {
+		matrixf32Destroy(&mat);
+	}
+}
+
+TEST(Graph, scale_is_folded_into_multiplication) {
+	float a_buffer[]{1.0f, 2.0f, 3.0f, 4.0f};
+	float b_buffer[]{5.0f, 6.0f, 7.0f, 8.0f};
+	float expected_buffer[]{-57.0f, -66.0f, -129.0f, -150.0f};
+
+	MatrixF32Ptr a = matrixf32CreateContainer({2, 2}, a_buffer, 4);
+	MatrixF32Ptr b = matrixf32CreateContainer({2, 2}, b_buffer, 4);
+	MatrixF32Ptr expected = matrixf32CreateContainer({2, 2}, expected_buffer, 4);
+	MatrixF32Ptr scaled = matrixf32Create({2, 2});
+	MatrixF32Ptr result = matrixf32Create({2, 2});
+
+	MatrixF32GraphPtr graph = matrixf32GraphCreate();
+
+	matrixf32GraphScale(graph, scaled, -3.0f, b);
+	matrixf32GraphMultiplication(graph, result, a, scaled);
+	matrixf32GraphSetTemporary(graph, scaled);
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32GraphReplay(graph));
+	EXPECT_EQ(1u, matrixf32GraphGetStepNumber(graph));
+	EXPECT_TRUE(matrixf32TwoMatEqual(result, expected, 1e-5f));
+
+	matrixf32GraphDestroy(&graph);
+
+	for (MatrixF32Ptr mat : {a, b, expected, scaled, result}) {
+		matrixf32Destroy(&mat);
+	}
+}
+
+TEST(Graph, dead_temporaries_are_removed) {
+	MatrixF32Ptr a = matrixf32Create({3, 3});
+	MatrixF32Ptr unused = matrixf32Create({3, 3});
+	MatrixF32Ptr result = matrixf32Create({3, 3});
+
+	matrixf32SetAllEntriesTo(a, 2.0f);
+
+	MatrixF32GraphPtr graph = matrixf32GraphCreate();
+
+	matrixf32GraphAdd(graph, unused, a, a);
+	matrixf32GraphScale(graph, unused, 4.0f, unused);
+	matrixf32GraphSetTemporary(graph, unused);
+	EXPECT_EQ(MatrixStatusOK, matrixf32GraphCompile(graph));
+	EXPECT_EQ(0u, matrixf32GraphGetStepNumber(graph));
+
+	// recording drops the compiled steps
+	matrixf32GraphCopy(graph, result, a);
+	EXPECT_EQ(0u, matrixf32GraphGetStepNumber(graph));
+	EXPECT_EQ(MatrixStatusOK, matrixf32GraphReplay(graph));
+	EXPECT_EQ(1u, matrixf32GraphGetStepNumber(graph));
+
+	EXPECT_TRUE(matrixf32TwoMatEqual(result, a, 0.0f));
+	EXPECT_EQ(0.0f, matrixf32GetValueAt(unused, {0, 0}));
+
+	matrixf32GraphDestroy(&graph);
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&unused);
+	matrixf32Destroy(&result);
+}
+
+TEST(Graph, long_chain_keeps_eager_semantics) {
+	static constexpr size_t COUNT = 12;
+
+	std::vector<MatrixF32Ptr> mat;
+	std::vector<MatrixF32Ptr> expected;
+
+	for (size_t i = 0; i < COUNT; ++i) {
+		mat.push_back(matrixf32Create({17, 33}));
+		expected.push_back(matrixf32Create({17, 33}));
+		fillRandom(mat[i], (unsigned)i + 1, (float)i + 0.5f);
+		matrixf32Copy(expected[i], mat[i]);
+	}
+
+	MatrixF32GraphPtr graph = matrixf32GraphCreate();
+
+	// more distinct matrices than registers, reading values overwritten earlier in the chain
+	for (size_t i = 1; i < COUNT; ++i) {
+		matrixf32GraphAdd(graph, mat[i], mat[i], mat[i - 1]);
+		matrixf32GraphSubtract(graph, mat[i - 1], mat[i], mat[0]);
+		matrixf32Add(expected[i], expected[i], expected[i - 1]);
+		matrixf32Subtract(expected[i - 1], expected[i], expected[0]);
+	}
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32GraphReplay(graph));
+	EXPECT_LT(1u, matrixf32GraphGetStepNumber(graph));
+
+	for (size_t i = 0; i < COUNT; ++i) {
+		EXPECT_TRUE(matrixf32TwoMatEqual(mat[i], expected[i], 1e-3f)) << i;
+		matrixf32Destroy(&mat[i]);
+		matrixf32Destroy(&expected[i]);
+	}
+
+	matrixf32GraphDestroy(&graph);
+}
+
+TEST(Graph, invalid_input) {
+	MatrixF32Ptr a = matrixf32Create({2, 3});
+	MatrixF32Ptr b = matrixf32Create({3, 2});
+
+	MatrixF32GraphPtr graph = matrixf32GraphCreate();
+
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32GraphAdd(nullptr, a, a, a));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32GraphAdd(graph, a, nullptr, a));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32GraphAdd(graph, a, a, b));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32GraphMultiplication(graph, a, a, b));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32GraphReplay(nullptr));
+	EXPECT_EQ(MatrixStatusOK, matrixf32GraphReplay(graph));
+	EXPECT_EQ(0u, matrixf32GraphGetStepNumber(graph));
+
+	matrixf32GraphDestroy(&graph);
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&b);
+}
@@ -0,0 +1,142 @@
+#include "../include/matrix_f32_half.h"
+#include "gtest/gtest.h"
+#include "test_util.h"
+
+#include <cmath>
+#include <cstring>
+#include <limits>
+
+namespace {
+uint16_t toHalf(float t_val, MatrixHalfFormat t_format) {
+	MatrixF32Ptr source = matrixf32CreateContainer({1, 1}, &t_val, 1);
+	MatrixHalfPtr half = matrixhalfCreate({1, 1}, t_format);
+
+	matrixhalfFromF32(half, source);
+	uint16_t bits = matrixhalfGetBuffer(half)[0];
+
+	matrixhalfDestroy(&half);
+	matrixf32Destroy(&source);
+
+	return bits;
+}
+}  // namespace
+
+TEST(Half, fp16_rounds_to_nearest_even) {
+	EXPECT_EQ(0x3C00, toHalf(1.0f, MatrixHalfFp16));
+	EXPECT_EQ(0xC000, toHalf(-2.0f, MatrixHalfFp16));
+	EXPECT_EQ(0x7BFF, toHalf(65504.0f, MatrixHalfFp16));
+	EXPECT_EQ(0x7C00, toHalf(70000.0f, MatrixHalfFp16));
+	EXPECT_EQ(0xFC00, toHalf(-std::numeric_limits<float>::infinity(), MatrixHalfFp16));
+	EXPECT_EQ(0x0001, toHalf(std::ldexp(1.0f, -24), MatrixHalfFp16));
+	EXPECT_EQ(0x0000, toHalf(std::ldexp(1.0f, -26), MatrixHalfFp16));
+	EXPECT_EQ(0x3C00, toHalf(1.0f + std::ldexp(1.0f, -11), MatrixHalfFp16));
+	EXPECT_EQ(0x3C02, toHalf(1.0f + 3.0f * std::ldexp(1.0f, -11), MatrixHalfFp16));
+
+	const uint16_t nan = toHalf(std::numeric_limits<float>::quiet_NaN(), MatrixHalfFp16);
+	EXPECT_EQ(0x7C00, nan & 0x7C00);
+	EXPECT_NE(0, nan & 0x03FF);
+}
+
+TEST(Half, bf16_rounds_to_nearest_even) {
+	EXPECT_EQ(0x3F80, toHalf(1.0f, MatrixHalfBf16));
+	EXPECT_EQ(0x3F80, toHalf(1.0f + std::ldexp(1.0f, -8), MatrixHalfBf16));
+	EXPECT_EQ(0x3F82, toHalf(1.0f + 3.0f * std::ldexp(1.0f, -8), MatrixHalfBf16));
+	EXPECT_EQ(0x7F80, toHalf(std::numeric_limits<float>::infinity(), MatrixHalfBf16));
+	EXPECT_EQ(0x7F80, toHalf(std::numeric_limits<float>::quiet_NaN(), MatrixHalfBf16) & 0x7F80);
+}
+
+TEST(Half, every_fp16_value_round_trips) {
+	MatrixHalfPtr half = matrixhalfCreate({256, 256}, MatrixHalfFp16);
+	MatrixHalfPtr back = matrixhalfCreate({256, 256}, MatrixHalfFp16);
+	MatrixF32Ptr f32 = matrixf32Create({256, 256});
+
+	uint16_t *bits = matrixhalfGetBuffer(half);
+	for (uint32_t i = 0; i < 65536; ++i) {
+		bits[i] = (uint16_t)i;
+	}
+
+	ASSERT_EQ(MatrixStatusOK, matrixhalfToF32(f32, half));
+	ASSERT_EQ(MatrixStatusOK, matrixhalfFromF32(back, f32));
+
+	EXPECT_FLOAT_EQ(1.0f, matrixf32GetValueAt(f32, {0x3C00 / 256, 0}));
+	EXPECT_FLOAT_EQ(65504.0f, matrixf32GetValueAt(f32, {0x7BFF / 256, 0x7BFF % 256}));
+
+	const uint16_t *round_trip = matrixhalfGetBuffer(back);
+	for (uint32_t i = 0; i < 65536; ++i) {
+		const bool is_nan = (i & 0x7C00) == 0x7C00 && (i & 0x03FF) != 0;
+
+		if (is_nan) {
+			EXPECT_TRUE(std::isnan(matrixf32GetValueAt(f32, {i / 256, i % 256})));
+		} else {
+			ASSERT_EQ(i, round_trip[i]) << i;
+		}
+	}
+
+	matrixhalfDestroy(&half);
+	matrixhalfDestroy(&back);
+	matrixf32Destroy(&f32);
+}
+
+TEST(Half, kernels_match_float_on_converted_values) {
+	static constexpr size_t ROW = 19;
+	static constexpr size_t INNER = 150;
+	static constexpr size_t COL = 7;
+
+	for (MatrixHalfFormat format : {MatrixHalfFp16, MatrixHalfBf16}) {
+		MatrixF32Ptr a = matrixf32Create({ROW, INNER});
+		MatrixF32Ptr rounded = matrixf32Create({ROW, INNER});
+		MatrixF32Ptr b = matrixf32Create({INNER, COL});
+		MatrixF32Ptr c = matrixf32Create({ROW, INNER});
+		MatrixF32Ptr expected = matrixf32Create({ROW, COL});
+		MatrixF32Ptr actual = matrixf32Create({ROW, COL});
+		MatrixF32Ptr expected_sum = matrixf32Create({ROW, INNER});
+		MatrixF32Ptr actual_sum = matrixf32Create({ROW, INNER});
+		MatrixHalfPtr half = matrixhalfCreate({ROW, INNER}, format);
+
+		fillRandom(a, 1, 2.0f);
+		fillRandom(b, 2, 2.0f);
+		fillRandom(c, 3, 2.0f);
+
+		ASSERT_EQ(MatrixStatusOK, matrixhalfFromF32(half, a));
+		ASSERT_EQ(MatrixStatusOK, matrixhalfToF32(rounded, half));
+		EXPECT_TRUE(matrixf32TwoMatEqual(a, rounded, format == MatrixHalfFp16 ? 1e-3f : 1e-2f));
+
+		ASSERT_EQ(MatrixStatusOK, matrixhalfMultiplication(actual, half, b));
+		matrixf32Multiplication(expected, rounded, b);
+		EXPECT_TRUE(matrixf32TwoMatEqual(expected, actual, 1e-4f));
+
+		ASSERT_EQ(MatrixStatusOK, matrixhalfAdd(actual_sum, half, c));
+		matrixf32Add(expected_sum, rounded, c);
+		EXPECT_TRUE(matrixf32TwoMatEqual(expected_sum, actual_sum, 0.0f));
+
+		ASSERT_EQ(MatrixStatusOK, matrixhalfScale(actual_sum, -0.5f, half));
+		matrixf32Scale(expected_sum, -0.5f, rounded);
+		EXPECT_TRUE(matrixf32TwoMatEqual(expected_sum, actual_sum, 0.0f));
+
+		EXPECT_EQ(format, matrixhalfGetFormat(half));
+
+		for (MatrixF32Ptr mat : {a, rounded, b, c, expected, actual, expected_sum, actual_sum}) {
+			matrixf32Destroy(&mat);
+		}
+
+		matrixhalfDestroy(&half);
+	}
+}
+
+TEST(Half, invalid_input) {
+	MatrixHalfPtr half = matrixhalfCreate({2, 3}, MatrixHalfBf16);
+	MatrixF32Ptr f32 = matrixf32Create({3, 2});
+
+	EXPECT_EQ(nullptr, matrixhalfCreate({0, 3}, MatrixHalfFp16));
+	EXPECT_EQ(nullptr, matrixhalfCreate({2, 3}, (MatrixHalfFormat)7));
+	EXPECT_EQ(nullptr, matrixhalfGetBuffer(nullptr));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixhalfFromF32(half, nullptr));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixhalfToF32(f32, half));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixhalfAdd(f32, half, f32));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixhalfMultiplication(f32, half, f32));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixhalfDestroy(nullptr));
+
+	matrixhalfDestroy(&half);
+	matrixf32Destroy(&f32);
+	EXPECT_EQ(nullptr, half);
+}
@@ -68,3 +68,25 @@ TEST(Inverse, null_ptr_input_will_return_error) {
 	matrixf32Destroy(&source);
 	matrixf32Destroy(&dest);
 }
+
+TEST(Inverse, cyclic_row_permutation) {
+	float test_case[]{0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 1.0f, 5.0f, 2.0f, 1.0f};
+
+	MatrixF32Ptr dest = matrixf32Create({3, 3});
+	MatrixF32Ptr product = matrixf32Create({3, 3});
+	MatrixF32Ptr identity = matrixf32Create({3, 3});
+	MatrixF32Ptr source = matrixf32CreateContainer({3, 3}, test_case, 3 * 3);
+
+	for (size_t i = 0; i < 3; ++i) {
+		matrixf32SetValueAt(identity, {i, i}, 1.0f);
+	}
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32Inverse(dest, source));
+	EXPECT_EQ(MatrixStatusOK, matrixf32Multiplication(product, source, dest));
+	EXPECT_TRUE(matrixf32TwoMatEqual(product, identity, 1e-5f));
+
+	matrixf32Destroy(&dest);
+	matrixf32Destroy(&product);
+	matrixf32Destroy(&identity);
+	matrixf32Destroy(&source);
+}
@@ -0,0 +1,140 @@
+#include "../include/matrix_f32_kalman.h"
+#include "gtest/gtest.h"
+
+static MatrixF32Ptr transposed(MatrixF32Ptr mat) {
+	MatrixF32Ptr result = matrixf32Create({matrixf32GetColNumber(mat), matrixf32GetRowNumber(mat)});
+
+	for (size_t i = 0; i < matrixf32GetRowNumber(mat); ++i) {
+		for (size_t j = 0; j < matrixf32GetColNumber(mat); ++j) {
+			matrixf32SetValueAt(result, {j, i}, matrixf32GetValueAt(mat, {i, j}));
+		}
+	}
+
+	return result;
+}
+
+// textbook filter assembled from the generic matrix functions
+static void referenceStep(MatrixF32Ptr x, MatrixF32Ptr p, MatrixF32Ptr f, MatrixF32Ptr q, MatrixF32Ptr z,
+						  MatrixF32Ptr h, MatrixF32Ptr r) {
+	const size_t n = matrixf32GetRowNumber(x), m = matrixf32GetRowNumber(z);
+
+	MatrixF32Ptr ft = transposed(f), ht = transposed(h);
+	MatrixF32Ptr nx1 = matrixf32Create({n, 1}), nxn = matrixf32Create({n, n}), nxn2 = matrixf32Create({n, n});
+	MatrixF32Ptr mx1 = matrixf32Create({m, 1}), mxn = matrixf32Create({m, n}), nxm = matrixf32Create({n, m});
+	MatrixF32Ptr s = matrixf32Create({m, m}), s_inv = matrixf32Create({m, m}), k = matrixf32Create({n, m});
+	MatrixF32Ptr mxm = matrixf32Create({m, m});
+
+	matrixf32Multiplication(nx1, f, x);
+	matrixf32Copy(x, nx1);
+	matrixf32Multiplication(nxn, f, p);
+	matrixf32Multiplication(nxn2, nxn, ft);
+	matrixf32Add(p, nxn2, q);
+
+	matrixf32Multiplication(mx1, h, x);
+	matrixf32Subtract(mx1, z, mx1);
+	matrixf32Multiplication(mxn, h, p);
+	matrixf32Multiplication(mxm, mxn, ht);
+	matrixf32Add(s, mxm, r);
+	matrixf32Inverse(s_inv, s);
+	matrixf32Multiplication(nxm, p, ht);
+	matrixf32Multiplication(k, nxm, s_inv);
+
+	matrixf32Multiplication(nx1, k, mx1);
+	matrixf32Add(x, x, nx1);
+	matrixf32Multiplication(nxn, k, mxn);
+	matrixf32Subtract(p, p, nxn);
+
+	for (MatrixF32Ptr mat : {ft, ht, nx1, nxn, nxn2, mx1, mxn, nxm, s, s_inv, k, mxm}) matrixf32Destroy(&mat);
+}
+
+class KalmanTest : public ::testing::TestWithParam<bool> {};
+
+TEST_P(KalmanTest, matches_reference_filter) {
+	const size_t n = 4, m = 2;
+	const float dt = 0.1f;
+
+	// constant velocity in two axes, position is measured
+	float f_buffer[]{1, 0, dt, 0, 0, 1, 0, dt, 0, 0, 1, 0, 0, 0, 0, 1};
+	float h_buffer[]{1, 0, 0, 0, 0, 1, 0, 0};
+	float q_buffer[]{1e-3f, 0, 0, 0, 0, 1e-3f, 0, 0, 0, 0, 1e-2f, 0, 0, 0, 0, 1e-2f};
+	float r_buffer[]{0.05f, 0.01f, 0.01f, 0.05f};
+
+	MatrixF32Ptr f = matrixf32CreateContainer({n, n}, f_buffer, 16);
+	MatrixF32Ptr h = matrixf32CreateContainer({m, n}, h_buffer, 8);
+	MatrixF32Ptr q = matrixf32CreateContainer({n, n}, q_buffer, 16);
+	MatrixF32Ptr r = matrixf32CreateContainer({m, m}, r_buffer, 4);
+	MatrixF32Ptr z = matrixf32Create({m, 1});
+	MatrixF32Ptr x = matrixf32Create({n, 1});
+	MatrixF32Ptr p = matrixf32Create({n, n});
+	for (size_t i = 0; i < n; ++i) matrixf32SetValueAt(p, {i, i}, 1.0f);
+
+	MatrixF32KalmanPtr kalman = matrixf32KalmanCreate(n, m);
+	ASSERT_NE(nullptr, kalman);
+	EXPECT_EQ(MatrixStatusOK, matrixf32KalmanSetJoseph(kalman, GetParam()));
+
+	for (int step = 0; step < 30; ++step) {
+		matrixf32SetValueAt(z, {0, 0}, 0.5f * step * dt + 0.02f * static_cast<float>(step % 3));
+		matrixf32SetValueAt(z, {1, 0}, -0.2f * step * dt + 0.01f * static_cast<float>(step % 5));
+
+		referenceStep(x, p, f, q, z, h, r);
+		EXPECT_EQ(MatrixStatusOK, matrixf32KalmanPredict(kalman, f, q, 0));
+		EXPECT_EQ(MatrixStatusOK, matrixf32KalmanUpdate(kalman, z, h, r, 0));
+	}
+
+	EXPECT_TRUE(matrixf32TwoMatEqual(x, matrixf32KalmanGetState(kalman), 1e-3f));
+	EXPECT_TRUE(matrixf32TwoMatEqual(p, matrixf32KalmanGetCovariance(kalman), 1e-4f));
+
+	MatrixF32Ptr covariance = matrixf32KalmanGetCovariance(kalman);
+	EXPECT_EQ(matrixf32GetValueAt(covariance, {0, 2}), matrixf32GetValueAt(covariance, {2, 0}));
+	EXPECT_NEAR(0.5f, matrixf32GetValueAt(matrixf32KalmanGetState(kalman), {2, 0}), 0.1f);
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32KalmanDestroy(&kalman));
+	EXPECT_EQ(nullptr, kalman);
+	for (MatrixF32Ptr mat : {f, h, q, r, z, x, p}) matrixf32Destroy(&mat);
+}
+
+INSTANTIATE_TEST_SUITE_P(Kalman, KalmanTest, ::testing::Values(false, true));
+
+TEST(Kalman, extended_filter_uses_given_predictions) {
+	MatrixF32KalmanPtr kalman = matrixf32KalmanCreate(1, 1);
+	float one[]{1.0f}, zero[]{0.0f}, state[]{2.0f}, predicted[]{4.0f}, measurement[]{5.0f};
+
+	MatrixF32Ptr f = matrixf32CreateContainer({1, 1}, one, 1);
+	MatrixF32Ptr q = matrixf32CreateContainer({1, 1}, zero, 1);
+	MatrixF32Ptr r = matrixf32CreateContainer({1, 1}, one, 1);
+	MatrixF32Ptr fx = matrixf32CreateContainer({1, 1}, state, 1);
+	MatrixF32Ptr hx = matrixf32CreateContainer({1, 1}, predicted, 1);
+	MatrixF32Ptr z = matrixf32CreateContainer({1, 1}, measurement, 1);
+
+	// P = 1, S = 2, K = 0.5, x = 2 + 0.5 * (5 - 4)
+	EXPECT_EQ(MatrixStatusOK, matrixf32KalmanPredict(kalman, f, q, fx));
+	EXPECT_EQ(MatrixStatusOK, matrixf32KalmanUpdate(kalman, z, f, r, hx));
+	EXPECT_FLOAT_EQ(2.5f, matrixf32GetValueAt(matrixf32KalmanGetState(kalman), {0, 0}));
+	EXPECT_FLOAT_EQ(0.5f, matrixf32GetValueAt(matrixf32KalmanGetCovariance(kalman), {0, 0}));
+
+	matrixf32KalmanDestroy(&kalman);
+	for (MatrixF32Ptr mat : {f, q, r, fx, hx, z}) matrixf32Destroy(&mat);
+}
+
+TEST(Kalman, invalid_input_will_return_error) {
+	MatrixF32KalmanPtr kalman = matrixf32KalmanCreate(2, 1);
+	MatrixF32Ptr square = matrixf32Create({2, 2});
+	MatrixF32Ptr h = matrixf32Create({1, 2});
+	MatrixF32Ptr zero = matrixf32Create({1, 1});
+
+	EXPECT_EQ(nullptr, matrixf32KalmanCreate(0, 1));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32KalmanPredict(kalman, h, square, 0));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32KalmanPredict(kalman, square, square, h));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32KalmanUpdate(kalman, zero, square, zero, 0));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32KalmanPredict(0, square, square, 0));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32KalmanUpdate(kalman, 0, h, zero, 0));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32KalmanSetJoseph(0, true));
+
+	// H = 0 and R = 0 give S = 0
+	matrixf32SetValueAt(matrixf32KalmanGetState(kalman), {0, 0}, 3.0f);
+	EXPECT_EQ(MatrixStatusErrSingular, matrixf32KalmanUpdate(kalman, zero, h, zero, 0));
+	EXPECT_EQ(3.0f, matrixf32GetValueAt(matrixf32KalmanGetState(kalman), {0, 0}));
+
+	matrixf32KalmanDestroy(&kalman);
+	for (MatrixF32Ptr mat : {square, h, zero}) matrixf32Destroy(&mat);
+}
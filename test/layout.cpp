@@ -0,0 +1,219 @@
+#include "../include/matrix_f32.h"
+#include "../include/matrix_f32_cholesky.h"
+#include "../util/runtime_error.h"
+#include "gtest/gtest.h"
+#include "test_util.h"
+
+#include <vector>
+
+namespace {
+MatrixF32Ptr createFilled(MatrixDimType t_dim, MatrixLayout t_layout, unsigned t_seed) {
+	MatrixF32Ptr mat = matrixf32CreateWithLayout(t_dim, t_layout);
+	fillRandom(mat, t_seed);
+
+	return mat;
+}
+
+void expectSameEntries(MatrixF32Ptr t_expected, MatrixF32Ptr t_actual, float t_tolerance) {
+	ASSERT_EQ(matrixf32GetRowNumber(t_expected), matrixf32GetRowNumber(t_actual));
+	ASSERT_EQ(matrixf32GetColNumber(t_expected), matrixf32GetColNumber(t_actual));
+
+	for (size_t i = 0; i < matrixf32GetRowNumber(t_expected); ++i) {
+		for (size_t j = 0; j < matrixf32GetColNumber(t_expected); ++j) {
+			EXPECT_NEAR(matrixf32GetValueAt(t_expected, {i, j}), matrixf32GetValueAt(t_actual, {i, j}), t_tolerance);
+		}
+	}
+}
+}  // namespace
+
+TEST(Layout, column_major_container_is_zero_copy) {
+	// 2 x 3 matrix [1 2 3; 4 5 6] stored column by column
+	float buffer[]{1.0f, 4.0f, 2.0f, 5.0f, 3.0f, 6.0f};
+	MatrixF32Ptr mat = matrixf32CreateContainerWithLayout({2, 3}, buffer, 6, MatrixLayoutColMajor);
+
+	EXPECT_EQ(MatrixLayoutColMajor, matrixf32GetLayout(mat));
+	EXPECT_EQ(OwnerShipOuter, matrixf32GetOwnership(mat));
+	EXPECT_EQ(2.0f, matrixf32GetValueAt(mat, {0, 1}));
+	EXPECT_EQ(6.0f, matrixf32GetValueAt(mat, {1, 2}));
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32SetValueAt(mat, {1, 0}, -4.0f));
+	EXPECT_EQ(-4.0f, buffer[1]);
+
+	// copying into a row-major matrix transposes the buffer
+	MatrixF32Ptr row_major = matrixf32Create({2, 3});
+	ASSERT_EQ(MatrixStatusOK, matrixf32Copy(row_major, mat));
+	const float expected[]{1.0f, 2.0f, 3.0f, -4.0f, 5.0f, 6.0f};
+
+	for (size_t i = 0; i < 6; ++i) {
+		EXPECT_EQ(expected[i], matrixf32GetBuffer(row_major)[i]);
+	}
+
+	EXPECT_TRUE(matrixf32TwoMatEqual(mat, row_major, 0.0f));
+	EXPECT_EQ(MatrixLayoutRowMajor, matrixf32GetLayout(row_major));
+
+	matrixf32Destroy(&mat);
+	matrixf32Destroy(&row_major);
+}
+
+TEST(Layout, element_wise_and_multiplication_in_every_combination) {
+	MatrixF32Ptr b_row = createFilled({4, 3}, MatrixLayoutRowMajor, 1);
+	MatrixF32Ptr c_row = createFilled({3, 5}, MatrixLayoutRowMajor, 2);
+	MatrixF32Ptr d_row = createFilled({4, 3}, MatrixLayoutRowMajor, 3);
+	MatrixF32Ptr product = matrixf32Create({4, 5});
+	MatrixF32Ptr sum = matrixf32Create({4, 3});
+	MatrixF32Ptr difference = matrixf32Create({4, 3});
+	MatrixF32Ptr scaled = matrixf32Create({4, 3});
+	ASSERT_EQ(MatrixStatusOK, matrixf32Multiplication(product, b_row, c_row));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Add(sum, b_row, d_row));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Subtract(difference, b_row, d_row));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Scale(scaled, 2.0f, b_row));
+
+	for (MatrixLayout layout_b : layouts) {
+		for (MatrixLayout layout_c : layouts) {
+			for (MatrixLayout layout_dest : layouts) {
+				MatrixF32Ptr b = matrixf32CreateWithLayout({4, 3}, layout_b);
+				MatrixF32Ptr c = matrixf32CreateWithLayout({3, 5}, layout_c);
+				MatrixF32Ptr d = matrixf32CreateWithLayout({4, 3}, layout_c);
+				MatrixF32Ptr dest = matrixf32CreateWithLayout({4, 5}, layout_dest);
+				MatrixF32Ptr element_wise = matrixf32CreateWithLayout({4, 3}, layout_dest);
+				ASSERT_EQ(MatrixStatusOK, matrixf32Copy(b, b_row));
+				ASSERT_EQ(MatrixStatusOK, matrixf32Copy(c, c_row));
+				ASSERT_EQ(MatrixStatusOK, matrixf32Copy(d, d_row));
+
+				ASSERT_EQ(MatrixStatusOK, matrixf32Multiplication(dest, b, c));
+				expectSameEntries(product, dest, 1e-6f);
+				ASSERT_EQ(MatrixStatusOK, matrixf32Add(element_wise, b, d));
+				expectSameEntries(sum, element_wise, 0.0f);
+				ASSERT_EQ(MatrixStatusOK, matrixf32Subtract(element_wise, b, d));
+				expectSameEntries(difference, element_wise, 0.0f);
+				ASSERT_EQ(MatrixStatusOK, matrixf32Scale(element_wise, 2.0f, b));
+				expectSameEntries(scaled, element_wise, 0.0f);
+
+				matrixf32Destroy(&b);
+				matrixf32Destroy(&c);
+				matrixf32Destroy(&d);
+				matrixf32Destroy(&dest);
+				matrixf32Destroy(&element_wise);
+			}
+		}
+	}
+
+	matrixf32Destroy(&b_row);
+	matrixf32Destroy(&c_row);
+	matrixf32Destroy(&d_row);
+	matrixf32Destroy(&product);
+	matrixf32Destroy(&sum);
+	matrixf32Destroy(&difference);
+	matrixf32Destroy(&scaled);
+}
+
+TEST(Layout, swap_rows_and_columns_of_column_major) {
+	MatrixF32Ptr col_major = createFilled({3, 4}, MatrixLayoutColMajor, 5);
+	MatrixF32Ptr row_major = matrixf32Create({3, 4});
+	ASSERT_EQ(MatrixStatusOK, matrixf32Copy(row_major, col_major));
+
+	ASSERT_EQ(MatrixStatusOK, matrixf32Swap(col_major, 0, 2, SwapOptRow));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Swap(row_major, 0, 2, SwapOptRow));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Swap(col_major, 3, 1, SwapOptCol));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Swap(row_major, 3, 1, SwapOptCol));
+	expectSameEntries(row_major, col_major, 0.0f);
+
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32Swap(col_major, 0, 3, SwapOptRow));
+
+	matrixf32Destroy(&col_major);
+	matrixf32Destroy(&row_major);
+}
+
+TEST(Layout, factorizations_of_column_major) {
+	static constexpr size_t N = 6, K = 3;
+
+	MatrixF32Ptr a_row = createFilled({N, N}, MatrixLayoutRowMajor, 7);
+	MatrixF32Ptr b_row = createFilled({N, K}, MatrixLayoutRowMajor, 11);
+
+	for (size_t i = 0; i < N; ++i) {
+		matrixf32SetValueAt(a_row, {i, i}, matrixf32GetValueAt(a_row, {i, i}) + 4.0f);
+	}
+
+	MatrixF32Ptr a_col = matrixf32CreateWithLayout({N, N}, MatrixLayoutColMajor);
+	MatrixF32Ptr b_col = matrixf32CreateWithLayout({N, K}, MatrixLayoutColMajor);
+	ASSERT_EQ(MatrixStatusOK, matrixf32Copy(a_col, a_row));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Copy(b_col, b_row));
+
+	// LU decomposition in place
+	MatrixF32Ptr lu_row = matrixf32Create({N, N});
+	MatrixF32Ptr lu_col = matrixf32CreateWithLayout({N, N}, MatrixLayoutColMajor);
+	MatrixF32Ptr permutation_row = matrixf32Create({N, 1});
+	MatrixF32Ptr permutation_col = matrixf32Create({N, 1});
+	ASSERT_EQ(MatrixStatusOK, matrixf32OutPlaceLU(lu_row, a_row, permutation_row));
+	ASSERT_EQ(MatrixStatusOK, matrixf32OutPlaceLU(lu_col, a_col, permutation_col));
+	expectSameEntries(lu_row, lu_col, 0.0f);
+	expectSameEntries(permutation_row, permutation_col, 0.0f);
+
+	// triangular solves read U from the column-major factor, by columns instead of rows
+	MatrixF32Ptr column = createFilled({N, 1}, MatrixLayoutRowMajor, 13);
+	MatrixF32Ptr x_row = matrixf32Create({N, 1});
+	MatrixF32Ptr x_col = matrixf32Create({N, 1});
+	ASSERT_EQ(MatrixStatusOK, matrixf32BackwardSubstitution(x_row, lu_row, column));
+	ASSERT_EQ(MatrixStatusOK, matrixf32BackwardSubstitution(x_col, lu_col, column));
+	expectSameEntries(x_row, x_col, 1e-6f);
+
+	// solve and inverse, the second inverse comes from the factor cache
+	MatrixF32Ptr solution_row = matrixf32Create({N, K});
+	MatrixF32Ptr solution_col = matrixf32CreateWithLayout({N, K}, MatrixLayoutColMajor);
+	MatrixF32Ptr inverse_row = matrixf32Create({N, N});
+	MatrixF32Ptr inverse_col = matrixf32CreateWithLayout({N, N}, MatrixLayoutColMajor);
+	ASSERT_EQ(MatrixStatusOK, matrixf32Solve(solution_row, a_row, b_row));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Solve(solution_col, a_col, b_col));
+	expectSameEntries(solution_row, solution_col, 1e-6f);
+
+	ASSERT_EQ(MatrixStatusOK, matrixf32SetFactorCache(a_col, true));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Inverse(inverse_row, a_row));
+
+	for (int pass = 0; pass < 2; ++pass) {
+		matrixf32SetAllEntriesTo(inverse_col, 0.0f);
+		ASSERT_EQ(MatrixStatusOK, matrixf32Inverse(inverse_col, a_col));
+		expectSameEntries(inverse_row, inverse_col, 1e-6f);
+	}
+
+	for (MatrixF32Ptr mat : {a_row, b_row, a_col, b_col, lu_row, lu_col, permutation_row, permutation_col, column,
+							 x_row, x_col, solution_row, solution_col, inverse_row, inverse_col}) {
+		matrixf32Destroy(&mat);
+	}
+}
+
+TEST(Layout, other_modules_reject_column_major) {
+	MatrixF32Ptr spd = matrixf32CreateWithLayout({2, 2}, MatrixLayoutColMajor);
+	MatrixF32Ptr lower = matrixf32Create({2, 2});
+	matrixf32SetValueAt(spd, {0, 0}, 4.0f);
+	matrixf32SetValueAt(spd, {1, 1}, 9.0f);
+
+	EXPECT_EQ(MatrixStatusErrLayout, matrixf32Cholesky(lower, spd));
+
+	// vectors are stored the same in both layouts
+	MatrixF32Ptr vector = matrixf32CreateWithLayout({2, 1}, MatrixLayoutColMajor);
+	MatrixF32Ptr solution = matrixf32Create({2, 1});
+	matrixf32SetValueAt(vector, {0, 0}, 2.0f);
+	matrixf32SetValueAt(vector, {1, 0}, 3.0f);
+	ASSERT_EQ(MatrixStatusOK, matrixf32Copy(lower, spd));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Cholesky(lower, lower));
+	EXPECT_EQ(MatrixStatusOK, matrixf32CholeskySolve(solution, lower, vector));
+	EXPECT_FLOAT_EQ(0.5f, matrixf32GetValueAt(solution, {0, 0}));
+
+	matrixf32Destroy(&spd);
+	matrixf32Destroy(&lower);
+	matrixf32Destroy(&vector);
+	matrixf32Destroy(&solution);
+}
+
+TEST(Layout, unknown_layout_is_reported) {
+	RuntimeErrorContextType context;
+	runtimeErrorContextInit(&context, false);
+	RuntimeErrorContextType* previous = runtimeErrorSetContext(&context);
+
+	float buffer[4]{};
+	EXPECT_EQ(nullptr, matrixf32CreateWithLayout({2, 2}, (MatrixLayout)2));
+	EXPECT_EQ(MatrixStatusErrUnknownOpt, runtimeErrorGetLastParam());
+	EXPECT_EQ(nullptr, matrixf32CreateContainerWithLayout({2, 2}, buffer, 4, (MatrixLayout)2));
+
+	runtimeErrorSetContext(previous);
+}
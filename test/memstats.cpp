@@ -0,0 +1,78 @@
+#include "../include/matrix_f32_memstats.h"
+#include "gtest/gtest.h"
+
+#include <vector>
+
+TEST(MemStats, null_ptr_input_will_return_error) { EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32MemStatsSnapshot(0)); }
+
+#ifdef MATRIX_F32_ENABLE_MEM_STATS
+
+TEST(MemStats, live_and_peak_bytes_follow_create_and_destroy) {
+	MatrixF32MemStatsType before, during, after;
+	matrixf32MemStatsReset();
+	EXPECT_EQ(MatrixStatusOK, matrixf32MemStatsSnapshot(&before));
+
+	MatrixF32Ptr mat = matrixf32Create({10, 10});
+	EXPECT_EQ(MatrixStatusOK, matrixf32MemStatsSnapshot(&during));
+	matrixf32Destroy(&mat);
+	EXPECT_EQ(MatrixStatusOK, matrixf32MemStatsSnapshot(&after));
+
+	EXPECT_EQ(before.m_liveMatrices + 1, during.m_liveMatrices);
+	EXPECT_LE(before.m_liveBytes + 100 * sizeof(float), during.m_liveBytes);
+	EXPECT_EQ(before.m_liveMatrices, after.m_liveMatrices);
+	EXPECT_EQ(before.m_liveBytes, after.m_liveBytes);
+	EXPECT_EQ(during.m_liveBytes, after.m_peakBytes);
+	EXPECT_EQ(1u, after.m_allocCount[MatrixF32OpCreate]);
+}
+
+TEST(MemStats, inverse_temporaries_are_attributed_to_inverse) {
+	float buffer[]{4.0f, 1.0f, 2.0f, 3.0f};
+
+	MatrixF32Ptr source = matrixf32CreateContainer({2, 2}, buffer, 4);
+	MatrixF32Ptr dest = matrixf32Create({2, 2});
+
+	matrixf32MemStatsReset();
+	EXPECT_EQ(MatrixStatusOK, matrixf32Inverse(dest, source));
+
+	MatrixF32MemStatsType snapshot;
+	EXPECT_EQ(MatrixStatusOK, matrixf32MemStatsSnapshot(&snapshot));
+	EXPECT_EQ(2u, snapshot.m_allocCount[MatrixF32OpInverse]);
+	EXPECT_EQ(0u, snapshot.m_allocCount[MatrixF32OpCreate]);
+	EXPECT_LT(snapshot.m_liveBytes, snapshot.m_peakBytes);
+
+	matrixf32Destroy(&source);
+	matrixf32Destroy(&dest);
+}
+
+TEST(MemStats, leak_report_lists_matrices_not_destroyed) {
+	float buffer[6]{};
+
+	MatrixF32Ptr leaked = matrixf32Create({2, 3});
+	MatrixF32Ptr container = matrixf32CreateContainer({3, 2}, buffer, 6);
+
+	std::vector<MatrixF32LeakInfoType> leaks;
+	size_t live = matrixf32MemReportLeaks(
+		[](const MatrixF32LeakInfoType* t_leak, void* t_context) {
+			static_cast<std::vector<MatrixF32LeakInfoType>*>(t_context)->push_back(*t_leak);
+		},
+		&leaks);
+
+	ASSERT_EQ(live, leaks.size());
+	ASSERT_LE(2u, leaks.size());
+
+	const MatrixF32LeakInfoType& second_last = leaks[leaks.size() - 2];
+	const MatrixF32LeakInfoType& last = leaks.back();
+	EXPECT_EQ(leaked, second_last.m_matrix);
+	EXPECT_EQ(MatrixF32OpCreate, second_last.m_createdBy);
+	EXPECT_EQ(2u, second_last.m_dim.m_row);
+	EXPECT_EQ(3u, second_last.m_dim.m_col);
+	EXPECT_EQ(container, last.m_matrix);
+	EXPECT_EQ(MatrixF32OpCreateContainer, last.m_createdBy);
+	EXPECT_LT(second_last.m_allocId, last.m_allocId);
+
+	matrixf32Destroy(&leaked);
+	matrixf32Destroy(&container);
+	EXPECT_EQ(live - 2, matrixf32MemReportLeaks(0, 0));
+}
+
+#endif
@@ -0,0 +1,246 @@
+#include "../include/matrix_f32_queue.h"
+#include "gtest/gtest.h"
+#include "test_util.h"
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+namespace {
+struct Recorder {
+	std::mutex m_mutex;
+	std::vector<int> m_order;
+};
+
+struct Step {
+	Recorder *m_recorder;
+	int m_id;
+	MatrixStatus m_status;
+};
+
+MatrixStatus record(void *t_step) {
+	Step *step = static_cast<Step *>(t_step);
+	std::lock_guard<std::mutex> lock(step->m_recorder->m_mutex);
+	step->m_recorder->m_order.push_back(step->m_id);
+
+	return step->m_status;
+}
+}  // namespace
+
+TEST(Queue, independent_operations_and_dependency) {
+	static constexpr size_t N = 48;
+
+	MatrixF32Ptr a = matrixf32Create({N, N});
+	MatrixF32Ptr a_copy = matrixf32Create({N, N});
+	MatrixF32Ptr b = matrixf32Create({N, N});
+	MatrixF32Ptr product = matrixf32Create({N, N});
+	MatrixF32Ptr inverse = matrixf32Create({N, N});
+	MatrixF32Ptr result = matrixf32Create({N, N});
+	MatrixF32Ptr expected = matrixf32Create({N, N});
+	MatrixF32Ptr expected_inverse = matrixf32Create({N, N});
+
+	fillRandom(a, 1, 1.0f, 10.0f);
+	fillRandom(b, 2);
+
+	// operations running at the same time must not share a matrix, not even one they only read
+	matrixf32Copy(a_copy, a);
+
+	MatrixF32QueuePtr queue = matrixf32QueueCreate(3);
+	ASSERT_NE(nullptr, queue);
+
+	MatrixF32FuturePtr deps[2];
+	deps[0] = matrixf32QueueMultiplication(queue, product, a, b, nullptr, 0);
+	deps[1] = matrixf32QueueInverse(queue, inverse, a_copy, nullptr, 0);
+	MatrixF32FuturePtr last = matrixf32QueueSubtract(queue, result, product, inverse, deps, 2);
+	ASSERT_NE(nullptr, last);
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32FutureWait(last));
+	EXPECT_TRUE(matrixf32FutureIsReady(deps[0]));
+	EXPECT_TRUE(matrixf32FutureIsReady(deps[1]));
+	EXPECT_EQ(MatrixStatusOK, matrixf32FutureWait(deps[1]));
+
+	matrixf32Multiplication(expected, a, b);
+	matrixf32Inverse(expected_inverse, a);
+	matrixf32Subtract(expected, expected, expected_inverse);
+	EXPECT_TRUE(matrixf32TwoMatEqual(result, expected, 0.0f));
+
+	matrixf32FutureRelease(&deps[0]);
+	matrixf32FutureRelease(&deps[1]);
+	matrixf32FutureRelease(&last);
+	EXPECT_EQ(nullptr, last);
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32QueueDestroy(&queue));
+	EXPECT_EQ(nullptr, queue);
+
+	for (MatrixF32Ptr mat : {a, a_copy, b, product, inverse, result, expected, expected_inverse}) {
+		matrixf32Destroy(&mat);
+	}
+}
+
+TEST(Queue, dependencies_order_custom_operations) {
+	Recorder recorder;
+	Step step[4] = {{&recorder, 0, MatrixStatusOK},
+					{&recorder, 1, MatrixStatusOK},
+					{&recorder, 2, MatrixStatusOK},
+					{&recorder, 3, MatrixStatusOK}};
+
+	MatrixF32QueuePtr queue = matrixf32QueueCreate(4);
+	MatrixF32FuturePtr future[4];
+
+	// 0 -> 1 -> 2 -> 3, submitted while the earlier ones may still run
+	future[0] = matrixf32QueueSubmit(queue, record, &step[0], nullptr, 0);
+
+	for (size_t i = 1; i < 4; ++i) {
+		future[i] = matrixf32QueueSubmit(queue, record, &step[i], &future[i - 1], 1);
+		ASSERT_NE(nullptr, future[i]);
+	}
+
+	// the handles may go before the operations complete
+	for (size_t i = 0; i < 4; ++i) {
+		matrixf32FutureRelease(&future[i]);
+	}
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32QueueFinish(queue));
+	EXPECT_EQ((std::vector<int>{0, 1, 2, 3}), recorder.m_order);
+
+	matrixf32QueueDestroy(&queue);
+}
+
+TEST(Queue, failed_dependency_skips_the_operation) {
+	Recorder recorder;
+	Step failing = {&recorder, 0, MatrixStatusErrSingular};
+	Step skipped = {&recorder, 1, MatrixStatusOK};
+
+	MatrixF32QueuePtr queue = matrixf32QueueCreate(2);
+
+	MatrixF32FuturePtr first = matrixf32QueueSubmit(queue, record, &failing, nullptr, 0);
+	MatrixF32FuturePtr second = matrixf32QueueSubmit(queue, record, &skipped, &first, 1);
+
+	EXPECT_EQ(MatrixStatusErrSingular, matrixf32FutureWait(second));
+	EXPECT_EQ((std::vector<int>{0}), recorder.m_order);
+
+	matrixf32FutureRelease(&first);
+	matrixf32FutureRelease(&second);
+	matrixf32QueueDestroy(&queue);
+}
+
+TEST(Queue, callback_runs_once) {
+	static std::atomic<int> calls;
+	calls = 0;
+
+	MatrixF32Ptr a = matrixf32Create({2, 3});
+	MatrixF32Ptr b = matrixf32Create({3, 2});
+	MatrixF32Ptr result = matrixf32Create({2, 3});
+
+	MatrixF32QueuePtr queue = matrixf32QueueCreate(1);
+	MatrixF32FuturePtr future = matrixf32QueueAdd(queue, result, a, b, nullptr, 0);
+
+	auto callback = [](void *t_context, MatrixStatus t_status) {
+		EXPECT_EQ(MatrixStatusErrDimMismatch, t_status);
+		EXPECT_EQ(nullptr, t_context);
+		++calls;
+	};
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32FutureThen(future, callback, nullptr));
+	matrixf32QueueFinish(queue);
+	EXPECT_EQ(1, calls.load());
+
+	// a complete future calls back right away, only one callback per future
+	MatrixF32FuturePtr other = matrixf32QueueAdd(queue, result, a, b, nullptr, 0);
+	matrixf32FutureWait(other);
+	EXPECT_EQ(MatrixStatusOK, matrixf32FutureThen(other, callback, nullptr));
+	EXPECT_EQ(2, calls.load());
+	EXPECT_EQ(MatrixStatusErrUnknownOpt, matrixf32FutureThen(future, callback, nullptr));
+
+	matrixf32FutureRelease(&future);
+	matrixf32FutureRelease(&other);
+	matrixf32QueueDestroy(&queue);
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&b);
+	matrixf32Destroy(&result);
+}
+
+TEST(Queue, invalid_input) {
+	MatrixF32QueuePtr queue = matrixf32QueueCreate(1);
+	MatrixF32QueuePtr other_queue = matrixf32QueueCreate(1);
+	MatrixF32Ptr mat = matrixf32Create({2, 2});
+
+	EXPECT_EQ(nullptr, matrixf32QueueCreate(0));
+	EXPECT_EQ(nullptr, matrixf32QueueAdd(nullptr, mat, mat, mat, nullptr, 0));
+	EXPECT_EQ(nullptr, matrixf32QueueAdd(queue, mat, mat, mat, nullptr, 1));
+	EXPECT_EQ(nullptr, matrixf32QueueSubmit(queue, nullptr, nullptr, nullptr, 0));
+
+	MatrixF32FuturePtr future = matrixf32QueueAdd(other_queue, mat, mat, mat, nullptr, 0);
+	EXPECT_EQ(nullptr, matrixf32QueueAdd(queue, mat, mat, mat, &future, 1));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32FutureWait(nullptr));
+	EXPECT_FALSE(matrixf32FutureIsReady(nullptr));
+
+	matrixf32FutureRelease(&future);
+	matrixf32QueueDestroy(&queue);
+	matrixf32QueueDestroy(&other_queue);
+	matrixf32Destroy(&mat);
+}
+
+#ifdef __cpp_impl_coroutine
+namespace {
+struct Detached {
+	struct promise_type {
+		Detached get_return_object() { return {}; }
+		std::suspend_never initial_suspend() noexcept { return {}; }
+		std::suspend_never final_suspend() noexcept { return {}; }
+		void return_void() {}
+		void unhandled_exception() { std::terminate(); }
+	};
+};
+
+Detached pipeline(MatrixF32QueuePtr t_queue, MatrixF32Ptr t_product, MatrixF32Ptr t_a, MatrixF32Ptr t_inverse,
+				  std::atomic<int> *t_stage, MatrixStatus *t_status) {
+	MatrixF32FuturePtr future = matrixf32QueueMultiplication(t_queue, t_product, t_a, t_a, nullptr, 0);
+	MatrixStatus status = co_await matrixf32Await(future);
+	matrixf32FutureRelease(&future);
+	++*t_stage;
+
+	if (status == MatrixStatusOK) {
+		future = matrixf32QueueInverse(t_queue, t_inverse, t_product, nullptr, 0);
+		status = co_await matrixf32Await(future);
+		matrixf32FutureRelease(&future);
+	}
+
+	*t_status = status;
+	++*t_stage;
+}
+}  // namespace
+
+TEST(Queue, coroutine_awaits_futures) {
+	MatrixF32Ptr a = matrixf32Create({8, 8});
+	MatrixF32Ptr product = matrixf32Create({8, 8});
+	MatrixF32Ptr inverse = matrixf32Create({8, 8});
+	MatrixF32Ptr square = matrixf32Create({8, 8});
+	MatrixF32Ptr expected = matrixf32Create({8, 8});
+
+	fillRandom(a, 3, 1.0f, 10.0f);
+
+	std::atomic<int> stage{0};
+	MatrixStatus status = MatrixStatusErrUnknownOpt;
+	MatrixF32QueuePtr queue = matrixf32QueueCreate(2);
+
+	pipeline(queue, product, a, inverse, &stage, &status);
+
+	// the second operation is submitted from the worker that resumed the coroutine
+	while (stage.load() != 2) {
+		matrixf32QueueFinish(queue);
+	}
+
+	EXPECT_EQ(MatrixStatusOK, status);
+	matrixf32Multiplication(square, a, a);
+	matrixf32Inverse(expected, square);
+	EXPECT_TRUE(matrixf32TwoMatEqual(inverse, expected, 0.0f));
+
+	matrixf32QueueDestroy(&queue);
+
+	for (MatrixF32Ptr mat : {a, product, inverse, square, expected}) {
+		matrixf32Destroy(&mat);
+	}
+}
+#endif
@@ -0,0 +1,163 @@
+#include "../include/matrix_f32_reduce.h"
+#include "gtest/gtest.h"
+#include "test_util.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+TEST(Reduce, norms_sums_and_trace_in_both_layouts) {
+	// 37 rows span two pairwise halves of the column sums, 45 columns leave remainders in every kernel
+	static constexpr size_t M = 37, N = 45;
+
+	MatrixF32Ptr a_row = matrixf32Create({M, N});
+	fillRandom(a_row, 3);
+
+	std::vector<double> row_sum(M), col_sum(N), row_abs(M), col_abs(N);
+	double sum = 0.0, squares = 0.0, largest = 0.0;
+
+	for (size_t i = 0; i < M; ++i) {
+		for (size_t j = 0; j < N; ++j) {
+			const double value = matrixf32GetValueAt(a_row, {i, j});
+
+			row_sum[i] += value;
+			col_sum[j] += value;
+			row_abs[i] += std::fabs(value);
+			col_abs[j] += std::fabs(value);
+			sum += value;
+			squares += value * value;
+			largest = std::max(largest, std::fabs(value));
+		}
+	}
+
+	for (MatrixLayout layout : layouts) {
+		MatrixF32Ptr a = matrixf32CreateWithLayout({M, N}, layout);
+		ASSERT_EQ(MatrixStatusOK, matrixf32Copy(a, a_row));
+
+		float result;
+		ASSERT_EQ(MatrixStatusOK, matrixf32Norm(&result, a, MatrixNormFrobenius));
+		EXPECT_NEAR(std::sqrt(squares), result, 1e-4);
+		ASSERT_EQ(MatrixStatusOK, matrixf32Norm(&result, a, MatrixNormOne));
+		EXPECT_NEAR(*std::max_element(col_abs.begin(), col_abs.end()), result, 1e-4);
+		ASSERT_EQ(MatrixStatusOK, matrixf32Norm(&result, a, MatrixNormInf));
+		EXPECT_NEAR(*std::max_element(row_abs.begin(), row_abs.end()), result, 1e-4);
+		ASSERT_EQ(MatrixStatusOK, matrixf32Norm(&result, a, MatrixNormMax));
+		EXPECT_FLOAT_EQ((float)largest, result);
+		ASSERT_EQ(MatrixStatusOK, matrixf32Sum(&result, a));
+		EXPECT_NEAR(sum, result, 1e-4);
+
+		MatrixF32Ptr rows = matrixf32Create({M, 1});
+		MatrixF32Ptr cols = matrixf32Create({1, N});
+		ASSERT_EQ(MatrixStatusOK, matrixf32RowSums(rows, a));
+		ASSERT_EQ(MatrixStatusOK, matrixf32ColSums(cols, a));
+
+		for (size_t i = 0; i < M; ++i) EXPECT_NEAR(row_sum[i], matrixf32GetBuffer(rows)[i], 1e-5);
+		for (size_t j = 0; j < N; ++j) EXPECT_NEAR(col_sum[j], matrixf32GetBuffer(cols)[j], 1e-5);
+
+		MatrixF32Ptr square = matrixf32CreateWithLayout({N, N}, layout);
+		matrixf32SetAllEntriesTo(square, 5.0f);
+
+		for (size_t i = 0; i < N; ++i) matrixf32SetValueAt(square, {i, i}, i + 1 < N ? 1.0f : -3.0f);
+
+		ASSERT_EQ(MatrixStatusOK, matrixf32Trace(&result, square));
+		EXPECT_EQ(N - 4.0f, result);
+		EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32Trace(&result, a));
+
+		matrixf32Destroy(&a);
+		matrixf32Destroy(&rows);
+		matrixf32Destroy(&cols);
+		matrixf32Destroy(&square);
+	}
+
+	matrixf32Destroy(&a_row);
+}
+
+TEST(Reduce, pairwise_sum_of_a_long_vector) {
+	// a sequential float sum is off by about 1 % here
+	static constexpr size_t N = (size_t)1 << 20;
+
+	std::vector<float> tenths(N, 0.1f);
+	MatrixF32Ptr x = matrixf32CreateContainer({N, 1}, tenths.data(), (int)N);
+	const double expected = (double)0.1f * N;
+
+	float result;
+	ASSERT_EQ(MatrixStatusOK, matrixf32Sum(&result, x));
+	EXPECT_NEAR(expected, result, expected * 1e-6);
+	ASSERT_EQ(MatrixStatusOK, matrixf32Norm(&result, x, MatrixNormOne));
+	EXPECT_NEAR(expected, result, expected * 1e-6);
+
+	// the column sums of the same buffer as a matrix are summed pairwise over its rows
+	MatrixF32Ptr a = matrixf32CreateContainer({N / 16, 16}, tenths.data(), (int)N);
+	MatrixF32Ptr cols = matrixf32Create({16, 1});
+	ASSERT_EQ(MatrixStatusOK, matrixf32ColSums(cols, a));
+	EXPECT_NEAR(expected / 16, matrixf32GetBuffer(cols)[15], expected / 16 * 1e-5);
+
+	matrixf32Destroy(&x);
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&cols);
+}
+
+TEST(Reduce, scaled_frobenius_and_nan) {
+	float big[]{3e30f, 0.0f, 0.0f, -4e30f}, result;
+	MatrixF32Ptr a_big = matrixf32CreateContainer({2, 2}, big, 4);
+
+	ASSERT_EQ(MatrixStatusOK, matrixf32Norm(&result, a_big, MatrixNormFrobenius));
+	EXPECT_FLOAT_EQ(5e30f, result);
+
+	// a NaN beyond the unrolled part of the kernels
+	MatrixF32Ptr a = matrixf32Create({3, 7});
+	fillRandom(a, 5);
+	matrixf32SetValueAt(a, {2, 5}, NAN);
+
+	for (MatrixNormType type : {MatrixNormFrobenius, MatrixNormOne, MatrixNormInf, MatrixNormMax}) {
+		ASSERT_EQ(MatrixStatusOK, matrixf32Norm(&result, a, type));
+		EXPECT_TRUE(std::isnan(result)) << type;
+	}
+
+	MatrixDimType index;
+	ASSERT_EQ(MatrixStatusOK, matrixf32ArgMax(&index, a, false));
+	EXPECT_EQ(2u, index.m_row);
+	EXPECT_EQ(5u, index.m_col);
+
+	matrixf32Destroy(&a_big);
+	matrixf32Destroy(&a);
+}
+
+TEST(Reduce, arg_max_takes_the_first_in_row_major_order) {
+	for (MatrixLayout layout : layouts) {
+		MatrixF32Ptr a = matrixf32CreateWithLayout({5, 9}, layout);
+		matrixf32SetAllEntriesTo(a, -2.0f);
+		matrixf32SetValueAt(a, {3, 1}, 1.0f);
+		matrixf32SetValueAt(a, {1, 7}, 1.0f);
+		matrixf32SetValueAt(a, {4, 8}, -6.0f);
+
+		MatrixDimType index;
+		ASSERT_EQ(MatrixStatusOK, matrixf32ArgMax(&index, a, false));
+		EXPECT_EQ(1u, index.m_row);
+		EXPECT_EQ(7u, index.m_col);
+		ASSERT_EQ(MatrixStatusOK, matrixf32ArgMax(&index, a, true));
+		EXPECT_EQ(4u, index.m_row);
+		EXPECT_EQ(8u, index.m_col);
+
+		matrixf32Destroy(&a);
+	}
+}
+
+TEST(Reduce, invalid_arguments) {
+	MatrixF32Ptr a = matrixf32Create({3, 4});
+	MatrixF32Ptr wrong = matrixf32Create({4, 1});
+	MatrixDimType index;
+	float result;
+
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32Norm(NULL, a, MatrixNormOne));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32Sum(&result, NULL));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32ArgMax(NULL, a, false));
+	EXPECT_EQ(MatrixStatusErrUnknownOpt, matrixf32Norm(&result, a, (MatrixNormType)4));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32RowSums(wrong, a));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32ColSums(a, a));
+	EXPECT_EQ(MatrixStatusOK, matrixf32ColSums(wrong, a));
+	EXPECT_EQ(MatrixStatusOK, matrixf32ArgMax(&index, a, true));
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&wrong);
+}
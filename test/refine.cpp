@@ -0,0 +1,166 @@
+#include "../include/matrix_f32_refine.h"
+#include "gtest/gtest.h"
+#include "test_util.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+// max |b - A x| / (|A| |x| + |b|) with the float solution, in double
+double backwardError(MatrixF32Ptr t_mat_a, MatrixF32Ptr t_x, MatrixF32Ptr t_column) {
+	const size_t n = matrixf32GetRowNumber(t_mat_a);
+	double norm_a = 0.0, norm_x = 0.0, norm_b = 0.0, norm_r = 0.0;
+
+	for (size_t i = 0; i < n; ++i) {
+		double row = 0.0, r = matrixf32GetValueAt(t_column, {i, 0});
+
+		for (size_t j = 0; j < n; ++j) {
+			row += std::fabs(matrixf32GetValueAt(t_mat_a, {i, j}));
+			r -= (double)matrixf32GetValueAt(t_mat_a, {i, j}) * matrixf32GetValueAt(t_x, {j, 0});
+		}
+
+		norm_a = std::fmax(norm_a, row);
+		norm_x = std::fmax(norm_x, std::fabs(matrixf32GetValueAt(t_x, {i, 0})));
+		norm_b = std::fmax(norm_b, std::fabs(matrixf32GetValueAt(t_column, {i, 0})));
+		norm_r = std::fmax(norm_r, std::fabs(r));
+	}
+
+	return norm_r / (norm_a * norm_x + norm_b);
+}
+
+void fillHilbert(MatrixF32Ptr t_mat) {
+	for (size_t i = 0; i < matrixf32GetRowNumber(t_mat); ++i) {
+		for (size_t j = 0; j < matrixf32GetColNumber(t_mat); ++j) {
+			matrixf32SetValueAt(t_mat, {i, j}, 1.0f / (float)(i + j + 1));
+		}
+	}
+}
+}  // namespace
+
+TEST(Refine, converges_on_float_factors) {
+	static constexpr size_t N = 24;
+
+	MatrixF32Ptr a = matrixf32Create({N, N});
+	MatrixF32Ptr column = matrixf32Create({N, 2});
+	MatrixF32Ptr result = matrixf32Create({N, 2});
+
+	fillRandom(a, 7, 1.0f, 4.0f);
+	for (size_t i = 0; i < N; ++i) {
+		matrixf32SetValueAt(column, {i, 0}, (float)i / 7.0f);
+		matrixf32SetValueAt(column, {i, 1}, i % 2 == 0 ? 1.0f : -3.0f);
+	}
+
+	std::vector<double> solution(N * 2);
+	MatrixF32RefineReport report;
+
+	ASSERT_EQ(MatrixStatusOK, matrixf32SolveRefined(result, a, column, solution.data(), &report));
+	EXPECT_TRUE(report.m_converged);
+	EXPECT_FALSE(report.m_fallback);
+	EXPECT_GE(report.m_iterations, 1u);
+	EXPECT_LT(report.m_iterations, 10u);
+	EXPECT_LT(report.m_backwardError, 1e-15);
+
+	for (size_t i = 0; i < N; ++i) {
+		EXPECT_EQ((float)solution[i * 2], matrixf32GetValueAt(result, {i, 0}));
+	}
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&column);
+	matrixf32Destroy(&result);
+}
+
+TEST(Refine, scale_of_the_system_does_not_matter) {
+	static constexpr size_t N = 24;
+
+	MatrixF32Ptr a = matrixf32Create({N, N});
+	MatrixF32Ptr column = matrixf32Create({N, 1});
+	MatrixF32Ptr result = matrixf32Create({N, 1});
+
+	for (size_t i = 0; i < N; ++i) {
+		matrixf32SetValueAt(column, {i, 0}, (float)i / 7.0f);
+	}
+
+	// the same well-conditioned system, with pivots far below and above 1e-6
+	for (float scale : {1e-5f, 1e-12f, 1e6f}) {
+		fillRandom(a, 7, scale, 4.0f * scale);
+
+		MatrixF32RefineReport report;
+		ASSERT_EQ(MatrixStatusOK, matrixf32SolveRefined(result, a, column, nullptr, &report));
+		EXPECT_TRUE(report.m_converged) << scale;
+		EXPECT_FALSE(report.m_fallback) << scale;
+		EXPECT_LE(report.m_iterations, 4u) << scale;
+	}
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&column);
+	matrixf32Destroy(&result);
+}
+
+TEST(Refine, ill_conditioned_beats_float_solve) {
+	static constexpr size_t N = 5;	// condition number about 5e5
+
+	MatrixF32Ptr a = matrixf32Create({N, N});
+	MatrixF32Ptr column = matrixf32Create({N, 1});
+	MatrixF32Ptr refined = matrixf32Create({N, 1});
+	MatrixF32Ptr plain = matrixf32Create({N, 1});
+
+	fillHilbert(a);
+	matrixf32SetAllEntriesTo(column, 1.0f);
+
+	MatrixF32RefineReport report;
+	ASSERT_EQ(MatrixStatusOK, matrixf32SolveRefined(refined, a, column, nullptr, &report));
+	EXPECT_TRUE(report.m_converged);
+	EXPECT_FALSE(report.m_fallback);
+	EXPECT_LT(report.m_backwardError, 1e-14);
+
+	// the float result is the double solution rounded once
+	EXPECT_LT(backwardError(a, refined, column), 1e-6);
+
+	if (matrixf32Solve(plain, a, column) == MatrixStatusOK) {
+		EXPECT_LT(backwardError(a, refined, column), backwardError(a, plain, column));
+	}
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&column);
+	matrixf32Destroy(&refined);
+	matrixf32Destroy(&plain);
+}
+
+TEST(Refine, falls_back_to_double_factorization) {
+	static constexpr size_t N = 9;	// condition number about 5e11, beyond float
+
+	MatrixF32Ptr a = matrixf32Create({N, N});
+	MatrixF32Ptr column = matrixf32Create({N, 1});
+	MatrixF32Ptr result = matrixf32Create({N, 1});
+
+	fillHilbert(a);
+	matrixf32SetAllEntriesTo(column, 1.0f);
+
+	MatrixF32RefineReport report;
+	ASSERT_EQ(MatrixStatusOK, matrixf32SolveRefined(result, a, column, nullptr, &report));
+	EXPECT_TRUE(report.m_fallback);
+	EXPECT_LT(report.m_backwardError, 1e-12);
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&column);
+	matrixf32Destroy(&result);
+}
+
+TEST(Refine, invalid_input) {
+	MatrixF32Ptr a = matrixf32Create({3, 3});
+	MatrixF32Ptr column = matrixf32Create({3, 1});
+	MatrixF32Ptr result = matrixf32Create({3, 1});
+	MatrixF32Ptr wrong = matrixf32Create({2, 1});
+
+	MatrixF32RefineReport report;
+	EXPECT_EQ(MatrixStatusErrSingular, matrixf32SolveRefined(result, a, column, nullptr, &report));
+	EXPECT_TRUE(report.m_fallback);
+
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32SolveRefined(result, nullptr, column, nullptr, nullptr));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32SolveRefined(wrong, a, column, nullptr, nullptr));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32SolveRefined(result, column, column, nullptr, nullptr));
+
+	for (MatrixF32Ptr mat : {a, column, result, wrong}) {
+		matrixf32Destroy(&mat);
+	}
+}
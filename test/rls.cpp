@@ -0,0 +1,179 @@
+#include "../include/matrix_f32_rls.h"
+#include "gtest/gtest.h"
+
+static void fillInvertible(MatrixF32Ptr mat) {
+	const size_t n = matrixf32GetRowNumber(mat);
+
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t j = 0; j < n; ++j) {
+			float val = static_cast<float>((3 * i + 5 * j) % 7) * 0.25f;
+			matrixf32SetValueAt(mat, {i, j}, i == j ? val + static_cast<float>(n) : val);
+		}
+	}
+}
+
+TEST(Rls, sherman_morrison_matches_inverse) {
+	const size_t n = 5;
+	MatrixF32Ptr source = matrixf32Create({n, n});
+	MatrixF32Ptr inverse = matrixf32Create({n, n});
+	MatrixF32Ptr expected = matrixf32Create({n, n});
+	MatrixF32Ptr u = matrixf32Create({n, 1});
+	MatrixF32Ptr v = matrixf32Create({n, 1});
+	MatrixF32Ptr work = matrixf32Create({n, 2});
+	fillInvertible(source);
+
+	for (size_t i = 0; i < n; ++i) {
+		matrixf32SetValueAt(u, {i, 0}, static_cast<float>(i) * 0.5f - 1.0f);
+		matrixf32SetValueAt(v, {i, 0}, static_cast<float>(n - i) * 0.3f);
+	}
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32Inverse(inverse, source));
+
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t j = 0; j < n; ++j) {
+			float val = matrixf32GetValueAt(source, {i, j});
+			matrixf32SetValueAt(source, {i, j}, val + matrixf32GetValueAt(u, {i, 0}) * matrixf32GetValueAt(v, {j, 0}));
+		}
+	}
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32Inverse(expected, source));
+	EXPECT_EQ(MatrixStatusOK, matrixf32ShermanMorrison(inverse, u, v, work));
+	EXPECT_TRUE(matrixf32TwoMatEqual(expected, inverse, 1e-4f));
+
+	matrixf32Destroy(&source);
+	matrixf32Destroy(&inverse);
+	matrixf32Destroy(&expected);
+	matrixf32Destroy(&u);
+	matrixf32Destroy(&v);
+	matrixf32Destroy(&work);
+}
+
+TEST(Rls, woodbury_matches_inverse) {
+	const size_t n = 6, k = 2;
+	MatrixF32Ptr source = matrixf32Create({n, n});
+	MatrixF32Ptr inverse = matrixf32Create({n, n});
+	MatrixF32Ptr expected = matrixf32Create({n, n});
+	MatrixF32Ptr u = matrixf32Create({n, k});
+	MatrixF32Ptr v = matrixf32Create({n, k});
+	MatrixF32Ptr work = matrixf32Create({2 * n, 1});
+	fillInvertible(source);
+
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t c = 0; c < k; ++c) {
+			matrixf32SetValueAt(u, {i, c}, static_cast<float>((i + c) % 3) * 0.5f);
+			matrixf32SetValueAt(v, {i, c}, static_cast<float>((2 * i + c) % 4) * 0.25f - 0.3f);
+		}
+	}
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32Inverse(inverse, source));
+
+	for (size_t i = 0; i < n; ++i) {
+		for (size_t j = 0; j < n; ++j) {
+			float val = matrixf32GetValueAt(source, {i, j});
+
+			for (size_t c = 0; c < k; ++c) {
+				val += matrixf32GetValueAt(u, {i, c}) * matrixf32GetValueAt(v, {j, c});
+			}
+
+			matrixf32SetValueAt(source, {i, j}, val);
+		}
+	}
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32Inverse(expected, source));
+	EXPECT_EQ(MatrixStatusOK, matrixf32Woodbury(inverse, u, v, work));
+	EXPECT_TRUE(matrixf32TwoMatEqual(expected, inverse, 1e-4f));
+
+	matrixf32Destroy(&source);
+	matrixf32Destroy(&inverse);
+	matrixf32Destroy(&expected);
+	matrixf32Destroy(&u);
+	matrixf32Destroy(&v);
+	matrixf32Destroy(&work);
+}
+
+TEST(Rls, estimator_converges_and_tracks_change) {
+	MatrixF32RlsPtr rls = matrixf32RlsCreate(3, 0.9f, 1000.0f);
+	ASSERT_NE(nullptr, rls);
+
+	MatrixF32Ptr phi = matrixf32Create({3, 1});
+	float theta[]{2.0f, -3.0f, 0.5f};
+	float error = 0.0f;
+
+	for (int step = 0; step < 200; ++step) {
+		// the system changes half way, the forgetting factor lets the estimate follow
+		if (step == 100) theta[1] = 1.0f;
+
+		float x[]{1.0f, static_cast<float>(step % 7) - 3.0f, static_cast<float>((step * 5) % 11) * 0.2f};
+		float y = 0.0f;
+
+		for (size_t i = 0; i < 3; ++i) {
+			matrixf32SetValueAt(phi, {i, 0}, x[i]);
+			y += theta[i] * x[i];
+		}
+
+		EXPECT_EQ(MatrixStatusOK, matrixf32RlsUpdate(rls, phi, y, &error));
+	}
+
+	MatrixF32Ptr estimate = matrixf32RlsGetParameter(rls);
+	EXPECT_NEAR(2.0f, matrixf32GetValueAt(estimate, {0, 0}), 1e-2f);
+	EXPECT_NEAR(1.0f, matrixf32GetValueAt(estimate, {1, 0}), 1e-2f);
+	EXPECT_NEAR(0.5f, matrixf32GetValueAt(estimate, {2, 0}), 1e-2f);
+	EXPECT_NEAR(0.0f, error, 1e-2f);
+
+	MatrixF32Ptr covariance = matrixf32RlsGetCovariance(rls);
+	EXPECT_FLOAT_EQ(matrixf32GetValueAt(covariance, {0, 2}), matrixf32GetValueAt(covariance, {2, 0}));
+
+	matrixf32Destroy(&phi);
+	EXPECT_EQ(MatrixStatusOK, matrixf32RlsDestroy(&rls));
+	EXPECT_EQ(nullptr, rls);
+}
+
+TEST(Rls, invalid_input_will_return_error) {
+	MatrixF32RlsPtr rls = matrixf32RlsCreate(2, 1.0f, 10.0f);
+	MatrixF32Ptr square = matrixf32Create({2, 2});
+	MatrixF32Ptr vector = matrixf32Create({2, 1});
+	MatrixF32Ptr wrong = matrixf32Create({3, 1});
+	MatrixF32Ptr small_work = matrixf32Create({1, 1});
+	MatrixF32Ptr work = matrixf32Create({2, 2});
+
+	EXPECT_EQ(nullptr, matrixf32RlsCreate(0, 1.0f, 1.0f));
+	EXPECT_EQ(nullptr, matrixf32RlsCreate(2, 1.5f, 1.0f));
+	EXPECT_EQ(nullptr, matrixf32RlsCreate(2, 1.0f, 0.0f));
+
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32RlsUpdate(rls, wrong, 1.0f, 0));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32ShermanMorrison(square, vector, vector, small_work));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32ShermanMorrison(square, wrong, vector, work));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32RlsUpdate(rls, 0, 1.0f, 0));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32Woodbury(square, vector, vector, 0));
+	EXPECT_EQ(nullptr, matrixf32RlsGetParameter(0));
+
+	// A = I, u = -e0, v = e0 makes A + u * v^T singular
+	matrixf32SetValueAt(square, {0, 0}, 1.0f);
+	matrixf32SetValueAt(square, {1, 1}, 1.0f);
+	matrixf32SetValueAt(vector, {0, 0}, 1.0f);
+	MatrixF32Ptr negative = matrixf32Create({2, 1});
+	matrixf32SetValueAt(negative, {0, 0}, -1.0f);
+	const uint32_t version = matrixf32GetVersion(square);
+	EXPECT_EQ(MatrixStatusErrSingular, matrixf32ShermanMorrison(square, negative, vector, work));
+	EXPECT_EQ(version, matrixf32GetVersion(square));
+	EXPECT_EQ(1.0f, matrixf32GetValueAt(square, {0, 0}));
+
+	// 1 + phi^T * (P / lambda) * phi = 0, the covariance must not be left scaled by 1 / lambda
+	MatrixF32RlsPtr forgetting = matrixf32RlsCreate(2, 0.5f, 10.0f);
+	MatrixF32Ptr covariance = matrixf32RlsGetCovariance(forgetting);
+	matrixf32SetValueAt(covariance, {0, 0}, -0.5f);
+	const uint32_t covariance_version = matrixf32GetVersion(covariance);
+	EXPECT_EQ(MatrixStatusErrSingular, matrixf32RlsUpdate(forgetting, vector, 1.0f, 0));
+	EXPECT_EQ(covariance_version, matrixf32GetVersion(covariance));
+	EXPECT_EQ(-0.5f, matrixf32GetValueAt(covariance, {0, 0}));
+	EXPECT_EQ(10.0f, matrixf32GetValueAt(covariance, {1, 1}));
+
+	matrixf32RlsDestroy(&rls);
+	matrixf32RlsDestroy(&forgetting);
+	matrixf32Destroy(&square);
+	matrixf32Destroy(&vector);
+	matrixf32Destroy(&wrong);
+	matrixf32Destroy(&small_work);
+	matrixf32Destroy(&work);
+	matrixf32Destroy(&negative);
+}
@@ -0,0 +1,69 @@
+#include "../include/matrix_f32.h"
+#include "../util/runtime_error.h"
+#include "gtest/gtest.h"
+
+#include <string>
+#include <thread>
+
+TEST(RuntimeError, non_aborting_context_records_error_and_create_returns_null) {
+	RuntimeErrorContextType context;
+	runtimeErrorContextInit(&context, false);
+	RuntimeErrorContextType* previous = runtimeErrorSetContext(&context);
+
+	EXPECT_EQ(nullptr, matrixf32Create({0, 2}));
+	EXPECT_STREQ("Matrix Error: Invalid dimension", context.m_message);
+	EXPECT_EQ(MatrixStatusErrDimMismatch, context.m_parameter);
+	EXPECT_NE(nullptr, context.m_file);
+
+	runtimeErrorReset();
+	EXPECT_STREQ("No Error", runtimerErrorGetLastError());
+	EXPECT_EQ(-1, runtimeErrorGetLastParam());
+
+	EXPECT_EQ(&context, runtimeErrorSetContext(previous));
+}
+
+TEST(RuntimeError, getters_return_default_value_on_invalid_input) {
+	RuntimeErrorContextType context;
+	runtimeErrorContextInit(&context, false);
+	RuntimeErrorContextType* previous = runtimeErrorSetContext(&context);
+
+	float buffer[]{1.0f, 2.0f, 3.0f, 4.0f};
+	MatrixF32Ptr mat = matrixf32CreateContainer({2, 2}, buffer, 4);
+
+	EXPECT_EQ(0.0f, matrixf32GetValueAt(mat, {2, 0}));
+	EXPECT_EQ(MatrixStatusErrOutOfBound, runtimeErrorGetLastParam());
+	EXPECT_EQ(0u, matrixf32GetRowNumber(0));
+	EXPECT_EQ(OwnerShipNull, matrixf32GetOwnership(0));
+	EXPECT_EQ(MatrixStatusErrNullPtr, runtimeErrorGetLastParam());
+	EXPECT_EQ(nullptr, matrixf32CreateContainer({3, 2}, buffer, 4));
+	EXPECT_EQ(MatrixStatusErrOutOfBound, runtimeErrorGetLastParam());
+
+	runtimeErrorSetContext(previous);
+	matrixf32Destroy(&mat);
+}
+
+TEST(RuntimeError, every_thread_has_its_own_context) {
+	auto worker = [](MatrixDimType t_dim, std::string* t_message) {
+		runtimeErrorSetAbortOnThrow(false);
+
+		matrixf32GetValueAt(0, t_dim);
+		*t_message = runtimerErrorGetLastError();
+
+		float buffer[]{1.0f};
+		MatrixF32Ptr mat = matrixf32CreateContainer({1, 1}, buffer, 1);
+		matrixf32GetValueAt(mat, t_dim);
+		matrixf32Destroy(&mat);
+
+		*t_message += runtimerErrorGetLastError();
+	};
+
+	std::string first_message, second_message;
+	std::thread first(worker, MatrixDimType{0, 0}, &first_message);
+	std::thread second(worker, MatrixDimType{1, 1}, &second_message);
+	first.join();
+	second.join();
+
+	EXPECT_EQ("Matrix Error: Null pointerMatrix Error: Null pointer", first_message);
+	EXPECT_EQ("Matrix Error: Null pointerMatrix Error: Out of bound", second_message);
+	EXPECT_TRUE(runtimeErrorGetContext()->m_abortOnThrow);
+}
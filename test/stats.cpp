@@ -0,0 +1,64 @@
+#include "../include/matrix_f32_stats.h"
+#include "gtest/gtest.h"
+
+TEST(Stats, null_ptr_input_will_return_error) { EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32StatsSnapshot(0)); }
+
+TEST(Stats, op_name_of_out_of_range_op_is_unknown) {
+	EXPECT_STREQ("Inverse", matrixf32OpName(MatrixF32OpInverse));
+	EXPECT_STREQ("Unknown", matrixf32OpName(MatrixF32OpCount));
+}
+
+#ifdef MATRIX_F32_ENABLE_STATS
+
+TEST(Stats, successful_calls_are_recorded) {
+	MatrixF32Ptr mat_a = matrixf32Create({2, 3});
+	MatrixF32Ptr mat_b = matrixf32Create({3, 4});
+	MatrixF32Ptr result = matrixf32Create({2, 4});
+	MatrixF32Ptr sum = matrixf32Create({2, 3});
+
+	matrixf32StatsReset();
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32Add(sum, mat_a, mat_a));
+	EXPECT_EQ(MatrixStatusOK, matrixf32Add(sum, sum, mat_a));
+	EXPECT_EQ(MatrixStatusOK, matrixf32Multiplication(result, mat_a, mat_b));
+
+	MatrixF32StatsType snapshot;
+	EXPECT_EQ(MatrixStatusOK, matrixf32StatsSnapshot(&snapshot));
+
+	const MatrixF32OpStatsType &add = snapshot.m_op[MatrixF32OpAdd];
+	EXPECT_EQ(2u, add.m_callCount);
+	EXPECT_EQ(2u * 6u, add.m_flops);
+	EXPECT_EQ(2u * 3u * 6u * sizeof(float), add.m_bytes);
+	EXPECT_LE(add.m_minCycles, add.m_maxCycles);
+	EXPECT_LE(add.m_maxCycles, add.m_totalCycles);
+
+	const MatrixF32OpStatsType &mult = snapshot.m_op[MatrixF32OpMultiplication];
+	EXPECT_EQ(1u, mult.m_callCount);
+	EXPECT_EQ(2u * 2u * 3u * 4u, mult.m_flops);
+	EXPECT_EQ(0u, snapshot.m_op[MatrixF32OpInverse].m_callCount);
+
+	matrixf32Destroy(&mat_a);
+	matrixf32Destroy(&mat_b);
+	matrixf32Destroy(&result);
+	matrixf32Destroy(&sum);
+}
+
+TEST(Stats, failed_calls_are_not_recorded) {
+	MatrixF32Ptr mat_a = matrixf32Create({2, 3});
+	MatrixF32Ptr mat_b = matrixf32Create({3, 3});
+
+	matrixf32StatsReset();
+
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32Add(mat_a, mat_b, mat_a));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32Scale(mat_a, 1.0f, 0));
+
+	MatrixF32StatsType snapshot;
+	EXPECT_EQ(MatrixStatusOK, matrixf32StatsSnapshot(&snapshot));
+	EXPECT_EQ(0u, snapshot.m_op[MatrixF32OpAdd].m_callCount);
+	EXPECT_EQ(0u, snapshot.m_op[MatrixF32OpScale].m_callCount);
+
+	matrixf32Destroy(&mat_a);
+	matrixf32Destroy(&mat_b);
+}
+
+#endif
@@ -0,0 +1,122 @@
+#include "../include/matrix_f32_strassen.h"
+#include "gtest/gtest.h"
+#include "test_util.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+// integers in [-t_range, t_range] keep every intermediate exact
+void fillIntegers(MatrixF32Ptr t_mat, unsigned t_seed, int t_range) {
+	for (size_t i = 0; i < matrixf32GetRowNumber(t_mat); ++i) {
+		for (size_t j = 0; j < matrixf32GetColNumber(t_mat); ++j) {
+			matrixf32SetValueAt(t_mat, {i, j}, (float)((int)((nextSeed(&t_seed) >> 8) % (2 * t_range + 1)) - t_range));
+		}
+	}
+}
+}  // namespace
+
+TEST(Strassen, exact_on_integers) {
+	// 75 peels a row and column at 75 and 37, 64 splits evenly down to the cutoff
+	for (size_t n : {64u, 75u}) {
+		MatrixF32Ptr b = matrixf32Create({n, n});
+		MatrixF32Ptr c = matrixf32Create({n, n});
+		MatrixF32Ptr classical = matrixf32Create({n, n});
+		MatrixF32Ptr fast = matrixf32Create({n, n});
+		fillIntegers(b, 3, 4);
+		fillIntegers(c, 5, 4);
+
+		std::vector<float> workspace(matrixf32StrassenWorkspaceLen(n, 8));
+		ASSERT_EQ(MatrixStatusOK, matrixf32Multiplication(classical, b, c));
+		ASSERT_EQ(MatrixStatusOK, matrixf32StrassenMultiplication(fast, b, c, 8, workspace.data(), workspace.size()));
+		EXPECT_TRUE(matrixf32TwoMatEqual(classical, fast, 0.0f));
+
+		matrixf32Destroy(&b);
+		matrixf32Destroy(&c);
+		matrixf32Destroy(&classical);
+		matrixf32Destroy(&fast);
+	}
+}
+
+TEST(Strassen, error_bound) {
+	static constexpr size_t N = 200, CUTOFF = 16;
+
+	MatrixF32Ptr b = matrixf32Create({N, N});
+	MatrixF32Ptr c = matrixf32Create({N, N});
+	MatrixF32Ptr classical = matrixf32Create({N, N});
+	MatrixF32Ptr fast = matrixf32Create({N, N});
+	fillRandom(b, 7);
+	fillRandom(c, 9);
+
+	std::vector<float> workspace(matrixf32StrassenWorkspaceLen(N, CUTOFF));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Multiplication(classical, b, c));
+	ASSERT_EQ(MatrixStatusOK, matrixf32StrassenMultiplication(fast, b, c, CUTOFF, workspace.data(), workspace.size()));
+
+	const float *val_b = matrixf32GetBuffer(b);
+	const float *val_c = matrixf32GetBuffer(c);
+	double error_classical = 0.0, error_fast = 0.0;
+
+	for (size_t i = 0; i < N; ++i) {
+		for (size_t j = 0; j < N; ++j) {
+			double exact = 0.0;
+
+			for (size_t k = 0; k < N; ++k) {
+				exact += (double)val_b[i * N + k] * val_c[k * N + j];
+			}
+
+			error_classical = std::fmax(error_classical, std::fabs(matrixf32GetValueAt(classical, {i, j}) - exact));
+			error_fast = std::fmax(error_fast, std::fabs(matrixf32GetValueAt(fast, {i, j}) - exact));
+		}
+	}
+
+	// Higham's bound for Strassen-Winograd with max|B| = max|C| = 1 and n0 = 200 / 16 after 4 levels
+	const double n0 = N / 16.0, u = std::ldexp(1.0, -24);
+	const double bound = (std::pow(N / n0, std::log2(18.0)) * (n0 * n0 + 6.0 * n0) - 6.0 * N) * u;
+
+	EXPECT_LE(error_fast, bound);
+	EXPECT_LE(error_classical, N * u);
+	// in practice the error is far below the bound, within two orders of magnitude of the classical one
+	EXPECT_LE(error_fast, 64.0 * error_classical);
+
+	matrixf32Destroy(&b);
+	matrixf32Destroy(&c);
+	matrixf32Destroy(&classical);
+	matrixf32Destroy(&fast);
+}
+
+TEST(Strassen, below_cutoff_matches_classical) {
+	static constexpr size_t N = 33;
+
+	MatrixF32Ptr b = matrixf32Create({N, N});
+	MatrixF32Ptr c = matrixf32Create({N, N});
+	MatrixF32Ptr classical = matrixf32Create({N, N});
+	MatrixF32Ptr fast = matrixf32Create({N, N});
+	fillRandom(b, 11);
+	fillRandom(c, 13);
+
+	EXPECT_EQ(0u, matrixf32StrassenWorkspaceLen(N, 0));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Multiplication(classical, b, c));
+	ASSERT_EQ(MatrixStatusOK, matrixf32StrassenMultiplication(fast, b, c, 0, NULL, 0));
+	EXPECT_TRUE(matrixf32TwoMatEqual(classical, fast, 0.0f));
+
+	matrixf32Destroy(&b);
+	matrixf32Destroy(&c);
+	matrixf32Destroy(&classical);
+	matrixf32Destroy(&fast);
+}
+
+TEST(Strassen, invalid_arguments) {
+	MatrixF32Ptr square = matrixf32Create({40, 40});
+	MatrixF32Ptr wide = matrixf32Create({40, 41});
+	std::vector<float> workspace(matrixf32StrassenWorkspaceLen(40, 8));
+
+	EXPECT_EQ(MatrixStatusErrNullPtr,
+			  matrixf32StrassenMultiplication(NULL, square, square, 8, workspace.data(), workspace.size()));
+	EXPECT_EQ(MatrixStatusErrDimMismatch,
+			  matrixf32StrassenMultiplication(square, wide, square, 8, workspace.data(), workspace.size()));
+	EXPECT_EQ(MatrixStatusErrOutOfBound,
+			  matrixf32StrassenMultiplication(square, square, square, 8, workspace.data(), workspace.size() - 1));
+
+	matrixf32Destroy(&square);
+	matrixf32Destroy(&wide);
+}
@@ -0,0 +1,150 @@
+#include "../include/matrix_f32_stream.h"
+#include "gtest/gtest.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+static const char* const STREAM_PATH = "matrix_f32_stream_test.csv";
+
+static void writeFile(const std::string& content) {
+	FILE* file = std::fopen(STREAM_PATH, "wb");
+	std::fwrite(content.data(), 1, content.size(), file);
+	std::fclose(file);
+}
+
+TEST(Stream, csv_rows_are_parsed_into_matrix) {
+	writeFile("time,x,y\n# comment\n0, 1.5, -2.25\r\n1,3e2,.5\n\n2,-0.000125,1.0E-3\n3,nan,7");
+
+	MatrixF32StreamPtr stream = matrixf32StreamOpen(STREAM_PATH, MatrixF32StreamCSV, 0);
+	ASSERT_NE(nullptr, stream);
+	EXPECT_EQ(3u, matrixf32StreamGetColNumber(stream));
+
+	MatrixF32Ptr dest = matrixf32Create({3, 3});
+	size_t rows_read = 0;
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32StreamRead(stream, dest, 0, &rows_read));
+	EXPECT_EQ(3u, rows_read);
+	EXPECT_EQ(1.5f, matrixf32GetValueAt(dest, {0, 1}));
+	EXPECT_EQ(-2.25f, matrixf32GetValueAt(dest, {0, 2}));
+	EXPECT_EQ(300.0f, matrixf32GetValueAt(dest, {1, 1}));
+	EXPECT_EQ(0.5f, matrixf32GetValueAt(dest, {1, 2}));
+	EXPECT_EQ(-0.000125f, matrixf32GetValueAt(dest, {2, 1}));
+	EXPECT_EQ(1.0e-3f, matrixf32GetValueAt(dest, {2, 2}));
+
+	// the last line has no line break, only the remaining row is filled
+	EXPECT_EQ(MatrixStatusOK, matrixf32StreamRead(stream, dest, 1, &rows_read));
+	EXPECT_EQ(1u, rows_read);
+	EXPECT_EQ(3.0f, matrixf32GetValueAt(dest, {1, 0}));
+	EXPECT_TRUE(std::isnan(matrixf32GetValueAt(dest, {1, 1})));
+	EXPECT_EQ(7.0f, matrixf32GetValueAt(dest, {1, 2}));
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32StreamRead(stream, dest, 0, &rows_read));
+	EXPECT_EQ(0u, rows_read);
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32StreamClose(&stream));
+	EXPECT_EQ(nullptr, stream);
+
+	std::remove(STREAM_PATH);
+	matrixf32Destroy(&dest);
+}
+
+TEST(Stream, fast_parser_matches_strtof) {
+	const char* const values[]{"0.1",	 "-123.456",	   "9999999", "16777215", "1.17549435e-38",
+							   "3.4e38", "0.333333333333", "1e-10",	  "2.5e10",	  "123456789012"};
+
+	std::string content;
+	for (const char* value : values) {
+		content += value;
+		content += "\n";
+	}
+	writeFile(content);
+
+	MatrixF32StreamPtr stream = matrixf32StreamOpen(STREAM_PATH, MatrixF32StreamCSV, 1);
+	MatrixF32Ptr dest = matrixf32Create({10, 1});
+	EXPECT_EQ(MatrixStatusOK, matrixf32StreamRead(stream, dest, 0, 0));
+
+	for (size_t i = 0; i < 10; ++i) {
+		EXPECT_EQ(std::strtof(values[i], nullptr), matrixf32GetValueAt(dest, {i, 0})) << values[i];
+	}
+
+	std::remove(STREAM_PATH);
+	matrixf32StreamClose(&stream);
+	matrixf32Destroy(&dest);
+}
+
+TEST(Stream, read_all_grows_across_buffer_boundaries) {
+	const size_t rows = 20000;
+
+	std::string content;
+	for (size_t i = 0; i < rows; ++i) {
+		content += std::to_string(i) + "," + std::to_string(i % 7) + ".25\n";
+	}
+	writeFile(content);
+
+	MatrixF32StreamPtr stream = matrixf32StreamOpen(STREAM_PATH, MatrixF32StreamCSV, 2);
+	MatrixF32Ptr dest = 0;
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32StreamReadAll(stream, &dest));
+	ASSERT_NE(nullptr, dest);
+	EXPECT_EQ(rows, matrixf32GetRowNumber(dest));
+	EXPECT_EQ(OwnerShipSelf, matrixf32GetOwnership(dest));
+
+	for (size_t i = 0; i < rows; ++i) {
+		ASSERT_EQ(static_cast<float>(i), matrixf32GetValueAt(dest, {i, 0}));
+		ASSERT_EQ(static_cast<float>(i % 7) + 0.25f, matrixf32GetValueAt(dest, {i, 1}));
+	}
+
+	// nothing left
+	MatrixF32Ptr empty = 0;
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32StreamReadAll(stream, &empty));
+	EXPECT_EQ(nullptr, empty);
+
+	std::remove(STREAM_PATH);
+	matrixf32StreamClose(&stream);
+	matrixf32Destroy(&dest);
+}
+
+TEST(Stream, raw_rows_are_read_without_parsing) {
+	const float values[]{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f};
+	writeFile(std::string(reinterpret_cast<const char*>(values), sizeof(values)));
+
+	MatrixF32StreamPtr stream = matrixf32StreamOpen(STREAM_PATH, MatrixF32StreamRaw, 3);
+	MatrixF32Ptr dest = matrixf32Create({4, 3});
+	size_t rows_read = 0;
+
+	// the seventh value is an incomplete row
+	EXPECT_EQ(MatrixStatusErrIO, matrixf32StreamRead(stream, dest, 0, &rows_read));
+	EXPECT_EQ(2u, rows_read);
+	EXPECT_EQ(6.0f, matrixf32GetValueAt(dest, {1, 2}));
+
+	std::remove(STREAM_PATH);
+	matrixf32StreamClose(&stream);
+	matrixf32Destroy(&dest);
+}
+
+TEST(Stream, malformed_input_will_return_error) {
+	writeFile("1,2,3\n4,,6\n7,8\n");
+
+	MatrixF32StreamPtr stream = matrixf32StreamOpen(STREAM_PATH, MatrixF32StreamCSV, 0);
+	MatrixF32Ptr dest = matrixf32Create({2, 3});
+	MatrixF32Ptr wrong_dim = matrixf32Create({2, 2});
+	size_t rows_read = 0;
+
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32StreamRead(stream, wrong_dim, 0, &rows_read));
+	EXPECT_EQ(MatrixStatusErrOutOfBound, matrixf32StreamRead(stream, dest, 3, &rows_read));
+	EXPECT_EQ(MatrixStatusErrIO, matrixf32StreamRead(stream, dest, 0, &rows_read));
+	EXPECT_EQ(1u, rows_read);
+
+	EXPECT_EQ(nullptr, matrixf32StreamOpen("matrix_f32_stream_missing.csv", MatrixF32StreamCSV, 0));
+	EXPECT_EQ(nullptr, matrixf32StreamOpen(STREAM_PATH, MatrixF32StreamRaw, 0));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32StreamRead(0, dest, 0, &rows_read));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32StreamReadAll(stream, 0));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32StreamClose(0));
+
+	std::remove(STREAM_PATH);
+	matrixf32StreamClose(&stream);
+	matrixf32Destroy(&dest);
+	matrixf32Destroy(&wrong_dim);
+}
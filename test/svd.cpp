@@ -0,0 +1,211 @@
+#include "../include/matrix_f32_svd.h"
+#include "gtest/gtest.h"
+#include "test_util.h"
+
+#include <cmath>
+#include <vector>
+
+namespace {
+// checks U S V^T = A and U^T U = V^T V = I
+void expectDecomposition(size_t t_row, size_t t_col, unsigned t_seed) {
+	const size_t r = t_row < t_col ? t_row : t_col;
+
+	MatrixF32Ptr a = matrixf32Create({t_row, t_col});
+	MatrixF32Ptr u = matrixf32Create({t_row, r});
+	MatrixF32Ptr s = matrixf32Create({r, 1});
+	MatrixF32Ptr v = matrixf32Create({t_col, r});
+	fillRandom(a, t_seed);
+
+	std::vector<float> workspace(matrixf32SvdWorkspaceLen(t_row, t_col));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Svd(u, s, v, a, workspace.data(), workspace.size()));
+
+	for (size_t k = 1; k < r; ++k) {
+		EXPECT_GE(matrixf32GetValueAt(s, {k - 1, 0}), matrixf32GetValueAt(s, {k, 0}));
+	}
+
+	for (size_t i = 0; i < t_row; ++i) {
+		for (size_t j = 0; j < t_col; ++j) {
+			float usv = 0.0f;
+
+			for (size_t k = 0; k < r; ++k) {
+				usv += matrixf32GetValueAt(u, {i, k}) * matrixf32GetValueAt(s, {k, 0}) * matrixf32GetValueAt(v, {j, k});
+			}
+
+			EXPECT_NEAR(matrixf32GetValueAt(a, {i, j}), usv, 2e-5f);
+		}
+	}
+
+	for (size_t k = 0; k < r; ++k) {
+		for (size_t l = 0; l <= k; ++l) {
+			float dot_u = 0.0f, dot_v = 0.0f;
+
+			for (size_t i = 0; i < t_row; ++i) {
+				dot_u += matrixf32GetValueAt(u, {i, k}) * matrixf32GetValueAt(u, {i, l});
+			}
+
+			for (size_t j = 0; j < t_col; ++j) {
+				dot_v += matrixf32GetValueAt(v, {j, k}) * matrixf32GetValueAt(v, {j, l});
+			}
+
+			EXPECT_NEAR(l == k ? 1.0f : 0.0f, dot_u, 1e-5f);
+			EXPECT_NEAR(l == k ? 1.0f : 0.0f, dot_v, 1e-5f);
+		}
+	}
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&u);
+	matrixf32Destroy(&s);
+	matrixf32Destroy(&v);
+}
+}  // namespace
+
+TEST(Svd, decomposition) {
+	expectDecomposition(12, 12, 3);	 // square, odd number of columns below
+	expectDecomposition(9, 7, 5);
+	expectDecomposition(40, 9, 7);	// QR preconditioned
+	expectDecomposition(5, 13, 9);	// wide
+	expectDecomposition(1, 4, 11);
+}
+
+TEST(Svd, known_singular_values) {
+	// orthogonal rows of norms 5 and 2
+	MatrixF32Ptr a = matrixf32Create({2, 3});
+	matrixf32SetValueAt(a, {0, 0}, 3.0f);
+	matrixf32SetValueAt(a, {0, 1}, 4.0f);
+	matrixf32SetValueAt(a, {1, 2}, -2.0f);
+
+	MatrixF32Ptr s = matrixf32Create({2, 1});
+	std::vector<float> workspace(matrixf32SvdWorkspaceLen(2, 3));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Svd(NULL, s, NULL, a, workspace.data(), workspace.size()));
+
+	EXPECT_NEAR(5.0f, matrixf32GetValueAt(s, {0, 0}), 1e-6f);
+	EXPECT_NEAR(2.0f, matrixf32GetValueAt(s, {1, 0}), 1e-6f);
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&s);
+}
+
+TEST(Svd, rank_deficient_pseudo_inverse) {
+	static constexpr size_t M = 10, N = 6;
+
+	// rank 3: A = B C with B 10 x 3, C 3 x 6
+	MatrixF32Ptr b = matrixf32Create({M, 3});
+	MatrixF32Ptr c = matrixf32Create({3, N});
+	MatrixF32Ptr a = matrixf32Create({M, N});
+	MatrixF32Ptr pinv = matrixf32Create({N, M});
+	fillRandom(b, 21);
+	fillRandom(c, 23);
+	ASSERT_EQ(MatrixStatusOK, matrixf32Multiplication(a, b, c));
+
+	std::vector<float> workspace(matrixf32SvdWorkspaceLen(M, N));
+	ASSERT_EQ(MatrixStatusOK, matrixf32PseudoInverse(pinv, a, 1e-4f, workspace.data(), workspace.size()));
+
+	// A A^+ A = A and A^+ A A^+ = A^+
+	MatrixF32Ptr a_pinv = matrixf32Create({M, M});
+	MatrixF32Ptr pinv_a = matrixf32Create({N, N});
+	MatrixF32Ptr product = matrixf32Create({M, N});
+	MatrixF32Ptr product_t = matrixf32Create({N, M});
+	ASSERT_EQ(MatrixStatusOK, matrixf32Multiplication(a_pinv, a, pinv));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Multiplication(pinv_a, pinv, a));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Multiplication(product, a_pinv, a));
+	ASSERT_EQ(MatrixStatusOK, matrixf32Multiplication(product_t, pinv_a, pinv));
+
+	for (size_t i = 0; i < M; ++i) {
+		for (size_t j = 0; j < N; ++j) {
+			EXPECT_NEAR(matrixf32GetValueAt(a, {i, j}), matrixf32GetValueAt(product, {i, j}), 1e-4f);
+			EXPECT_NEAR(matrixf32GetValueAt(pinv, {j, i}), matrixf32GetValueAt(product_t, {j, i}), 1e-4f);
+		}
+	}
+
+	// A A^+ is a symmetric projection
+	for (size_t i = 0; i < M; ++i) {
+		for (size_t j = 0; j < i; ++j) {
+			EXPECT_NEAR(matrixf32GetValueAt(a_pinv, {i, j}), matrixf32GetValueAt(a_pinv, {j, i}), 1e-5f);
+		}
+	}
+
+	matrixf32Destroy(&b);
+	matrixf32Destroy(&c);
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&pinv);
+	matrixf32Destroy(&a_pinv);
+	matrixf32Destroy(&pinv_a);
+	matrixf32Destroy(&product);
+	matrixf32Destroy(&product_t);
+}
+
+TEST(Svd, least_squares) {
+	// overdetermined: the residual is orthogonal to the columns of A
+	static constexpr size_t M = 30, N = 4, K = 2;
+
+	MatrixF32Ptr a = matrixf32Create({M, N});
+	MatrixF32Ptr b = matrixf32Create({M, K});
+	MatrixF32Ptr x = matrixf32Create({N, K});
+	fillRandom(a, 31);
+	fillRandom(b, 37);
+
+	std::vector<float> workspace(matrixf32SvdWorkspaceLen(M, N));
+	ASSERT_EQ(MatrixStatusOK, matrixf32LeastSquares(x, a, b, 0.0f, workspace.data(), workspace.size()));
+
+	for (size_t j = 0; j < K; ++j) {
+		for (size_t c = 0; c < N; ++c) {
+			float dot = 0.0f;
+
+			for (size_t i = 0; i < M; ++i) {
+				float ax = 0.0f;
+
+				for (size_t l = 0; l < N; ++l) {
+					ax += matrixf32GetValueAt(a, {i, l}) * matrixf32GetValueAt(x, {l, j});
+				}
+
+				dot += matrixf32GetValueAt(a, {i, c}) * (matrixf32GetValueAt(b, {i, j}) - ax);
+			}
+
+			EXPECT_NEAR(0.0f, dot, 1e-4f);
+		}
+	}
+
+	// underdetermined: x + t (0, 0, 1) solves x1 + x2 = 2, x2 = 1 for all t, the minimum norm solution is (1, 1, 0)
+	MatrixF32Ptr wide = matrixf32Create({2, 3});
+	MatrixF32Ptr rhs = matrixf32Create({2, 1});
+	MatrixF32Ptr solution = matrixf32Create({3, 1});
+	matrixf32SetValueAt(wide, {0, 0}, 1.0f);
+	matrixf32SetValueAt(wide, {0, 1}, 1.0f);
+	matrixf32SetValueAt(wide, {1, 1}, 1.0f);
+	matrixf32SetValueAt(rhs, {0, 0}, 2.0f);
+	matrixf32SetValueAt(rhs, {1, 0}, 1.0f);
+
+	std::vector<float> wide_workspace(matrixf32SvdWorkspaceLen(2, 3));
+	ASSERT_EQ(MatrixStatusOK,
+			  matrixf32LeastSquares(solution, wide, rhs, 0.0f, wide_workspace.data(), wide_workspace.size()));
+
+	EXPECT_NEAR(1.0f, matrixf32GetValueAt(solution, {0, 0}), 1e-6f);
+	EXPECT_NEAR(1.0f, matrixf32GetValueAt(solution, {1, 0}), 1e-6f);
+	EXPECT_NEAR(0.0f, matrixf32GetValueAt(solution, {2, 0}), 1e-6f);
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&b);
+	matrixf32Destroy(&x);
+	matrixf32Destroy(&wide);
+	matrixf32Destroy(&rhs);
+	matrixf32Destroy(&solution);
+}
+
+TEST(Svd, invalid_arguments) {
+	MatrixF32Ptr a = matrixf32Create({4, 3});
+	MatrixF32Ptr s = matrixf32Create({3, 1});
+	MatrixF32Ptr u = matrixf32Create({4, 4});
+	MatrixF32Ptr pinv = matrixf32Create({4, 3});
+	std::vector<float> workspace(matrixf32SvdWorkspaceLen(4, 3));
+
+	EXPECT_EQ(0u, matrixf32SvdWorkspaceLen(0, 3));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32Svd(NULL, NULL, NULL, a, workspace.data(), workspace.size()));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32Svd(u, s, NULL, a, workspace.data(), workspace.size()));
+	EXPECT_EQ(MatrixStatusErrOutOfBound, matrixf32Svd(NULL, s, NULL, a, workspace.data(), workspace.size() - 1));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32PseudoInverse(pinv, a, 0.0f, workspace.data(), workspace.size()));
+
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&s);
+	matrixf32Destroy(&u);
+	matrixf32Destroy(&pinv);
+}
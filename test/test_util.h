@@ -0,0 +1,24 @@
+#ifndef MATRIX_F32_TEST_UTIL_H_
+#define MATRIX_F32_TEST_UTIL_H_
+
+#include "../include/matrix_f32.h"
+
+// the storage orders a layout-aware test runs through
+const MatrixLayout layouts[] = {MatrixLayoutRowMajor, MatrixLayoutColMajor};
+
+// the LCG of the C standard, the same sequence on every platform
+inline unsigned nextSeed(unsigned *t_seed) { return *t_seed = *t_seed * 1103515245u + 12345u; }
+
+// uniform in [-1, 1] in steps of 0.001
+inline float nextUniform(unsigned *t_seed) { return (float)((nextSeed(t_seed) >> 8) % 2001) / 1000.0f - 1.0f; }
+
+// fills the matrix row by row with t_scale times uniform [-1, 1] entries, t_diagonal added on the diagonal
+inline void fillRandom(MatrixF32Ptr t_mat, unsigned t_seed, float t_scale = 1.0f, float t_diagonal = 0.0f) {
+	for (size_t i = 0; i < matrixf32GetRowNumber(t_mat); ++i) {
+		for (size_t j = 0; j < matrixf32GetColNumber(t_mat); ++j) {
+			matrixf32SetValueAt(t_mat, {i, j}, t_scale * nextUniform(&t_seed) + (i == j ? t_diagonal : 0.0f));
+		}
+	}
+}
+
+#endif	// MATRIX_F32_TEST_UTIL_H_
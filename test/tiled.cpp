@@ -0,0 +1,202 @@
+#include "../include/matrix_f32_file.h"
+#include "../include/matrix_f32_tiled.h"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+
+static const char* const PATH_A = "matrix_f32_tiled_a.mf32";
+static const char* const PATH_B = "matrix_f32_tiled_b.mf32";
+static const char* const PATH_C = "matrix_f32_tiled_c.mf32";
+
+static MatrixF32Ptr randomMatrix(MatrixDimType dim, uint32_t seed) {
+	MatrixF32Ptr mat = matrixf32Create(dim);
+
+	for (size_t i = 0; i < dim.m_row; ++i) {
+		for (size_t j = 0; j < dim.m_col; ++j) {
+			seed = seed * 1664525u + 1013904223u;
+			matrixf32SetValueAt(mat, {i, j}, static_cast<float>(seed >> 8) / 16777216.0f - 0.5f);
+		}
+	}
+
+	return mat;
+}
+
+TEST(Tiled, multiplication_matches_in_core_result) {
+	const size_t m = 40, k = 56, n = 24, tile = 16;
+
+	MatrixF32Ptr a = randomMatrix({m, k}, 1);
+	MatrixF32Ptr b = randomMatrix({k, n}, 2);
+	MatrixF32Ptr expected = matrixf32Create({m, n});
+	MatrixF32Ptr result = matrixf32Create({m, n});
+	EXPECT_EQ(MatrixStatusOK, matrixf32Multiplication(expected, a, b));
+	EXPECT_EQ(MatrixStatusOK, matrixf32FileWrite(PATH_A, a));
+	EXPECT_EQ(MatrixStatusOK, matrixf32FileWrite(PATH_B, b));
+
+	MatrixF32TiledPtr tiled_a = matrixf32TiledOpen(PATH_A, tile, 2);
+	MatrixF32TiledPtr tiled_b = matrixf32TiledOpen(PATH_B, tile, 2);
+	MatrixF32TiledPtr tiled_c = matrixf32TiledCreate(PATH_C, {m, n}, tile, 2);
+
+	if (tiled_a == nullptr && tiled_b == nullptr && tiled_c == nullptr) {
+		GTEST_SKIP() << "tiled files are not available";
+	}
+
+	ASSERT_NE(nullptr, tiled_a);
+	ASSERT_NE(nullptr, tiled_b);
+	ASSERT_NE(nullptr, tiled_c);
+	EXPECT_EQ(MatrixStatusOK, matrixf32TiledMultiplication(tiled_c, tiled_a, tiled_b));
+
+	// each of the 3 x 2 x 4 tile products reads at most one tile of each operand
+	const uint64_t bound = 2u * 3u * 2u * 4u * tile * tile * sizeof(float);
+	EXPECT_LE(matrixf32TiledGetIO(tiled_a).m_bytesRead + matrixf32TiledGetIO(tiled_b).m_bytesRead, bound);
+	EXPECT_EQ(0u, matrixf32TiledGetIO(tiled_c).m_bytesRead);
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32TiledClose(&tiled_a));
+	EXPECT_EQ(MatrixStatusOK, matrixf32TiledClose(&tiled_b));
+	EXPECT_EQ(MatrixStatusOK, matrixf32TiledClose(&tiled_c));
+	EXPECT_EQ(nullptr, tiled_c);
+
+	// the checksum is updated on close, so the file reads back through the verified path
+	EXPECT_EQ(MatrixStatusOK, matrixf32FileRead(PATH_C, result));
+	EXPECT_TRUE(matrixf32TwoMatEqual(expected, result, 1e-4f));
+
+	std::remove(PATH_A);
+	std::remove(PATH_B);
+	std::remove(PATH_C);
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&b);
+	matrixf32Destroy(&expected);
+	matrixf32Destroy(&result);
+}
+
+TEST(Tiled, repeated_multiplication_overwrites_cached_result) {
+	float values[]{1.0f, 2.0f, 3.0f, 4.0f};
+	float ones[]{1.0f, 0.0f, 0.0f, 1.0f};
+
+	MatrixF32Ptr a = matrixf32CreateContainer({2, 2}, values, 4);
+	MatrixF32Ptr identity = matrixf32CreateContainer({2, 2}, ones, 4);
+	MatrixF32Ptr result = matrixf32Create({2, 2});
+	EXPECT_EQ(MatrixStatusOK, matrixf32FileWrite(PATH_A, a));
+	EXPECT_EQ(MatrixStatusOK, matrixf32FileWrite(PATH_B, identity));
+
+	MatrixF32TiledPtr tiled_a = matrixf32TiledOpen(PATH_A, 2, 2);
+	MatrixF32TiledPtr tiled_b = matrixf32TiledOpen(PATH_B, 2, 2);
+	MatrixF32TiledPtr tiled_c = matrixf32TiledCreate(PATH_C, {2, 2}, 2, 2);
+
+	if (tiled_a == nullptr && tiled_b == nullptr && tiled_c == nullptr) {
+		GTEST_SKIP() << "tiled files are not available";
+	}
+
+	ASSERT_NE(nullptr, tiled_a);
+	ASSERT_NE(nullptr, tiled_b);
+	ASSERT_NE(nullptr, tiled_c);
+
+	// the single result tile stays cached between the calls, the second product must not add onto the first
+	EXPECT_EQ(MatrixStatusOK, matrixf32TiledMultiplication(tiled_c, tiled_a, tiled_b));
+	EXPECT_EQ(MatrixStatusOK, matrixf32TiledMultiplication(tiled_c, tiled_a, tiled_b));
+
+	EXPECT_EQ(MatrixStatusErrUnknownOpt, matrixf32TiledMultiplication(tiled_a, tiled_a, tiled_b));
+	EXPECT_EQ(MatrixStatusErrUnknownOpt, matrixf32TiledMultiplication(tiled_b, tiled_a, tiled_b));
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32TiledClose(&tiled_a));
+	EXPECT_EQ(MatrixStatusOK, matrixf32TiledClose(&tiled_b));
+	EXPECT_EQ(MatrixStatusOK, matrixf32TiledClose(&tiled_c));
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32FileRead(PATH_C, result));
+	EXPECT_TRUE(matrixf32TwoMatEqual(a, result, 0.0f));
+
+	std::remove(PATH_A);
+	std::remove(PATH_B);
+	std::remove(PATH_C);
+	matrixf32Destroy(&a);
+	matrixf32Destroy(&identity);
+	matrixf32Destroy(&result);
+}
+
+TEST(Tiled, lu_reconstructs_permuted_source) {
+	const size_t n = 50;
+
+	MatrixF32Ptr source = randomMatrix({n, n}, 3);
+	MatrixF32Ptr lu = matrixf32Create({n, n});
+	MatrixF32Ptr permutation = matrixf32Create({n, 1});
+	EXPECT_EQ(MatrixStatusOK, matrixf32FileWrite(PATH_A, source));
+
+	MatrixF32TiledPtr tiled = matrixf32TiledOpen(PATH_A, 16, 3);
+
+	if (tiled == nullptr) {
+		GTEST_SKIP() << "tiled files are not available";
+	}
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32TiledLU(tiled, permutation));
+	EXPECT_EQ(MatrixStatusOK, matrixf32TiledClose(&tiled));
+	EXPECT_EQ(MatrixStatusOK, matrixf32FileRead(PATH_A, lu));
+
+	// (L * U)[i][j] == source[permutation[i]][j]
+	for (size_t i = 0; i < n; ++i) {
+		const size_t source_row = static_cast<size_t>(matrixf32GetValueAt(permutation, {i, 0}));
+
+		for (size_t j = 0; j < n; ++j) {
+			float sum = 0.0f;
+
+			for (size_t p = 0; p <= (i < j ? i : j); ++p) {
+				const float l = p == i ? 1.0f : matrixf32GetValueAt(lu, {i, p});
+				sum += l * matrixf32GetValueAt(lu, {p, j});
+			}
+
+			EXPECT_NEAR(matrixf32GetValueAt(source, {source_row, j}), sum, 1e-4f);
+		}
+	}
+
+	std::remove(PATH_A);
+	matrixf32Destroy(&source);
+	matrixf32Destroy(&lu);
+	matrixf32Destroy(&permutation);
+}
+
+TEST(Tiled, singular_matrix_will_return_error) {
+	float buffer[]{1.0f, 2.0f, 3.0f, 2.0f, 4.0f, 6.0f, 1.0f, 0.0f, 1.0f};
+
+	MatrixF32Ptr source = matrixf32CreateContainer({3, 3}, buffer, 9);
+	MatrixF32Ptr permutation = matrixf32Create({3, 1});
+	EXPECT_EQ(MatrixStatusOK, matrixf32FileWrite(PATH_A, source));
+
+	MatrixF32TiledPtr tiled = matrixf32TiledOpen(PATH_A, 2, 2);
+
+	if (tiled == nullptr) {
+		GTEST_SKIP() << "tiled files are not available";
+	}
+
+	EXPECT_EQ(MatrixStatusErrSingular, matrixf32TiledLU(tiled, permutation));
+	EXPECT_EQ(MatrixStatusOK, matrixf32TiledClose(&tiled));
+
+	std::remove(PATH_A);
+	matrixf32Destroy(&source);
+	matrixf32Destroy(&permutation);
+}
+
+TEST(Tiled, invalid_input_will_return_error) {
+	MatrixF32Ptr permutation = matrixf32Create({3, 1});
+
+	MatrixF32TiledPtr rect = matrixf32TiledCreate(PATH_A, {3, 4}, 2, 2);
+	MatrixF32TiledPtr other_tile = matrixf32TiledCreate(PATH_B, {4, 3}, 4, 2);
+
+	EXPECT_EQ(nullptr, matrixf32TiledCreate(PATH_C, {3, 3}, 2, 1));
+	EXPECT_EQ(nullptr, matrixf32TiledOpen("matrix_f32_tiled_missing.mf32", 2, 2));
+
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32TiledMultiplication(0, rect, other_tile));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32TiledLU(0, permutation));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32TiledClose(0));
+
+	if (rect != nullptr && other_tile != nullptr) {
+		EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32TiledMultiplication(rect, rect, other_tile));
+		EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32TiledLU(rect, permutation));
+		EXPECT_EQ(MatrixStatusOK, matrixf32TiledClose(&rect));
+		EXPECT_EQ(MatrixStatusOK, matrixf32TiledClose(&other_tile));
+	}
+
+	EXPECT_EQ(16u, matrixf32TiledSuggestTileSize(0));
+	EXPECT_EQ(64u, matrixf32TiledSuggestTileSize(3 * 64 * 64 * sizeof(float)));
+
+	std::remove(PATH_A);
+	std::remove(PATH_B);
+	matrixf32Destroy(&permutation);
+}
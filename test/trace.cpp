@@ -0,0 +1,80 @@
+#include "../include/matrix_f32_trace.h"
+#include "gtest/gtest.h"
+
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+TEST(Trace, null_ptr_input_will_return_error) { EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32TraceFlush(0)); }
+
+#ifdef MATRIX_F32_ENABLE_TRACE
+
+static std::string readTraceFile(const char* path) {
+	std::ifstream file(path);
+	std::stringstream content;
+	content << file.rdbuf();
+
+	return content.str();
+}
+
+static size_t countOccurrence(const std::string& text, const std::string& pattern) {
+	size_t count = 0;
+	for (size_t pos = text.find(pattern); pos != std::string::npos; pos = text.find(pattern, pos + 1)) ++count;
+
+	return count;
+}
+
+TEST(Trace, inverse_phases_are_written_to_trace_file) {
+	float buffer[]{4.0f, 1.0f, 2.0f, 3.0f};
+
+	MatrixF32Ptr source = matrixf32CreateContainer({2, 2}, buffer, 4);
+	MatrixF32Ptr dest = matrixf32Create({2, 2});
+
+	matrixf32TraceReset();
+	EXPECT_EQ(MatrixStatusOK, matrixf32Inverse(dest, source));
+
+	const char* path = "matrix_f32_trace_test.json";
+	EXPECT_EQ(MatrixStatusOK, matrixf32TraceFlush(path));
+
+	std::string trace = readTraceFile(path);
+	EXPECT_EQ(0u, trace.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["));
+	EXPECT_EQ(1u, countOccurrence(trace, "\"name\":\"Inverse\""));
+	EXPECT_EQ(1u, countOccurrence(trace, "\"name\":\"Inverse/LU\""));
+	EXPECT_EQ(1u, countOccurrence(trace, "\"name\":\"Inverse/Forward\""));
+	EXPECT_EQ(1u, countOccurrence(trace, "\"name\":\"Inverse/Backward\""));
+	EXPECT_EQ(1u, countOccurrence(trace, "\"name\":\"OutPlaceLU\""));
+
+	std::remove(path);
+	matrixf32Destroy(&source);
+	matrixf32Destroy(&dest);
+}
+
+TEST(Trace, every_thread_records_into_its_own_buffer) {
+	static constexpr int CALLS_PER_THREAD = 100;
+
+	matrixf32TraceReset();
+
+	auto worker = []() {
+		MatrixF32Ptr mat = matrixf32Create({3, 3});
+
+		for (int i = 0; i < CALLS_PER_THREAD; ++i) {
+			matrixf32Add(mat, mat, mat);
+		}
+
+		matrixf32Destroy(&mat);
+	};
+
+	std::thread first(worker), second(worker);
+	first.join();
+	second.join();
+
+	const char* path = "matrix_f32_trace_thread_test.json";
+	EXPECT_EQ(MatrixStatusOK, matrixf32TraceFlush(path));
+	EXPECT_EQ(2u * CALLS_PER_THREAD, countOccurrence(readTraceFile(path), "\"name\":\"Add\""));
+
+	std::remove(path);
+}
+
+#endif
@@ -0,0 +1,124 @@
+#include "../include/matrix_f32_window.h"
+#include "gtest/gtest.h"
+
+TEST(Window, push_drops_oldest_row) {
+	MatrixF32WindowPtr window = matrixf32WindowCreate(3, 2);
+	ASSERT_NE(nullptr, window);
+	EXPECT_EQ(0u, matrixf32WindowGetRowNumber(window));
+	EXPECT_EQ(2u, matrixf32WindowGetColNumber(window));
+
+	for (int i = 0; i < 5; ++i) {
+		float row[]{static_cast<float>(i), static_cast<float>(10 * i)};
+		EXPECT_EQ(MatrixStatusOK, matrixf32WindowPush(window, row));
+	}
+
+	EXPECT_EQ(3u, matrixf32WindowGetRowNumber(window));
+	EXPECT_EQ(2.0f, matrixf32WindowGetRow(window, 0)[0]);
+	EXPECT_EQ(40.0f, matrixf32WindowGetRow(window, 2)[1]);
+	EXPECT_EQ(nullptr, matrixf32WindowGetRow(window, 3));
+
+	float buffer[]{2.0f, 20.0f, 3.0f, 30.0f, 4.0f, 40.0f};
+	MatrixF32Ptr expected = matrixf32CreateContainer({3, 2}, buffer, 6);
+	MatrixF32Ptr unrolled = matrixf32Create({3, 2});
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32WindowCopyTo(unrolled, window));
+	EXPECT_TRUE(matrixf32TwoMatEqual(expected, unrolled, 0.0f));
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32WindowClear(window));
+	EXPECT_EQ(0u, matrixf32WindowGetRowNumber(window));
+
+	matrixf32Destroy(&expected);
+	matrixf32Destroy(&unrolled);
+	EXPECT_EQ(MatrixStatusOK, matrixf32WindowDestroy(&window));
+	EXPECT_EQ(nullptr, window);
+}
+
+TEST(Window, wrapped_kernels_match_unrolled_matrix) {
+	const size_t capacity = 5, col = 3;
+	MatrixF32WindowPtr window = matrixf32WindowCreate(capacity, col);
+
+	// 8 pushes, the window wraps after storage row 2
+	for (int i = 0; i < 8; ++i) {
+		float row[]{static_cast<float>(i), static_cast<float>(i * i) * 0.5f, static_cast<float>(3 - 2 * i)};
+		matrixf32WindowPush(window, row);
+	}
+
+	MatrixF32Ptr unrolled = matrixf32Create({capacity, col});
+	EXPECT_EQ(MatrixStatusOK, matrixf32WindowCopyTo(unrolled, window));
+
+	// multiplication
+	float c_buffer[]{1.0f, -1.0f, 0.5f, 2.0f, 0.0f, 1.0f};
+	MatrixF32Ptr mat_c = matrixf32CreateContainer({col, 2}, c_buffer, 6);
+	MatrixF32Ptr expected = matrixf32Create({capacity, 2});
+	MatrixF32Ptr result = matrixf32Create({capacity, 2});
+
+	EXPECT_EQ(MatrixStatusOK, matrixf32Multiplication(expected, unrolled, mat_c));
+	EXPECT_EQ(MatrixStatusOK, matrixf32WindowMultiplication(result, window, mat_c));
+	EXPECT_TRUE(matrixf32TwoMatEqual(expected, result, 1e-5f));
+
+	// mean and covariance
+	MatrixF32Ptr mean = matrixf32Create({1, col});
+	MatrixF32Ptr cov = matrixf32Create({col, col});
+	EXPECT_EQ(MatrixStatusOK, matrixf32WindowMean(mean, window));
+	EXPECT_EQ(MatrixStatusOK, matrixf32WindowCovariance(cov, window));
+
+	for (size_t j = 0; j < col; ++j) {
+		float sum = 0.0f;
+		for (size_t i = 0; i < capacity; ++i) sum += matrixf32GetValueAt(unrolled, {i, j});
+		EXPECT_NEAR(sum / capacity, matrixf32GetValueAt(mean, {0, j}), 1e-5f);
+	}
+
+	for (size_t j = 0; j < col; ++j) {
+		for (size_t k = 0; k < col; ++k) {
+			float sum = 0.0f;
+
+			for (size_t i = 0; i < capacity; ++i) {
+				sum += (matrixf32GetValueAt(unrolled, {i, j}) - matrixf32GetValueAt(mean, {0, j})) *
+					   (matrixf32GetValueAt(unrolled, {i, k}) - matrixf32GetValueAt(mean, {0, k}));
+			}
+
+			EXPECT_NEAR(sum / (capacity - 1), matrixf32GetValueAt(cov, {j, k}), 1e-3f);
+		}
+	}
+
+	matrixf32Destroy(&unrolled);
+	matrixf32Destroy(&mat_c);
+	matrixf32Destroy(&expected);
+	matrixf32Destroy(&result);
+	matrixf32Destroy(&mean);
+	matrixf32Destroy(&cov);
+	matrixf32WindowDestroy(&window);
+}
+
+TEST(Window, invalid_input_will_return_error) {
+	MatrixF32WindowPtr window = matrixf32WindowCreate(4, 2);
+	MatrixF32Ptr mean = matrixf32Create({1, 2});
+	MatrixF32Ptr cov = matrixf32Create({2, 2});
+	MatrixF32Ptr mat_c = matrixf32Create({2, 2});
+	MatrixF32Ptr result = matrixf32Create({1, 2});
+	float row[]{1.0f, 2.0f};
+
+	EXPECT_EQ(nullptr, matrixf32WindowCreate(0, 2));
+	EXPECT_EQ(nullptr, matrixf32WindowCreate(2, 0));
+
+	// empty window
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32WindowMean(mean, window));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32WindowMultiplication(result, window, mat_c));
+
+	// a single row has no covariance
+	EXPECT_EQ(MatrixStatusOK, matrixf32WindowPush(window, row));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32WindowCovariance(cov, window));
+	EXPECT_EQ(MatrixStatusErrDimMismatch, matrixf32WindowMean(cov, window));
+
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32WindowPush(window, 0));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32WindowPush(0, row));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32WindowMean(0, window));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32WindowCovariance(cov, 0));
+	EXPECT_EQ(MatrixStatusErrNullPtr, matrixf32WindowDestroy(0));
+
+	matrixf32Destroy(&mean);
+	matrixf32Destroy(&cov);
+	matrixf32Destroy(&mat_c);
+	matrixf32Destroy(&result);
+	matrixf32WindowDestroy(&window);
+}
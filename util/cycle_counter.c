@@ -0,0 +1,66 @@
+/**
+ * @Date:   2026-10-19T09:12:40+08:00
+ * @Last modified time: 2026-10-19T09:12:40+08:00
+ */
+#include "cycle_counter.h"
+
+#include <stdbool.h>
+
+#if defined(__ARM_ARCH_7EM__) || defined(__ARM_ARCH_7M__)
+
+// Cortex-M3/M4 data watchpoint and trace unit, see ARMv7-M ARM C1.8
+#define DEMCR (*(volatile uint32_t *)0xE000EDFCu)
+#define DWT_CTRL (*(volatile uint32_t *)0xE0001000u)
+#define DWT_CYCCNT (*(volatile uint32_t *)0xE0001004u)
+
+#define DEMCR_TRCENA (1u << 24)
+#define DWT_CTRL_CYCCNTENA (1u << 0)
+
+static bool initialized = false;
+static uint32_t last_count = 0;
+static uint64_t wrapped = 0;
+
+void cycleCounterInit(void) {
+	DEMCR |= DEMCR_TRCENA;
+	DWT_CYCCNT = 0;
+	DWT_CTRL |= DWT_CTRL_CYCCNTENA;
+
+	last_count = 0;
+	wrapped = 0;
+	initialized = true;
+}
+
+uint64_t cycleCounterRead(void) {
+	if (!initialized) cycleCounterInit();
+
+	// CYCCNT is only 32 bit wide (~25 s at 168 MHz), extend it as long as it is read once per wrap
+	uint32_t count = DWT_CYCCNT;
+	if (count < last_count) wrapped += (uint64_t)1 << 32;
+	last_count = count;
+
+	return wrapped | count;
+}
+
+#elif defined(__x86_64__) || defined(__i386__)
+
+#include <x86intrin.h>
+
+void cycleCounterInit(void) {}
+
+uint64_t cycleCounterRead(void) { return __rdtsc(); }
+
+#else
+
+#include <time.h>
+
+void cycleCounterInit(void) {}
+
+// no cycle counter available, fall back to nanoseconds
+uint64_t cycleCounterRead(void) {
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+
+	return (uint64_t)now.tv_sec * 1000000000u + (uint64_t)now.tv_nsec;
+}
+
+#endif
@@ -0,0 +1,11 @@
+/**
+ * @Date:   2026-10-19T09:12:40+08:00
+ * @Last modified time: 2026-10-19T09:12:40+08:00
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+void cycleCounterInit(void);
+uint64_t cycleCounterRead(void);
@@ -1,31 +1,62 @@
 /**
  * @Date:   2019-11-12T14:52:29+08:00
- * @Last modified time: 2019-11-16T11:34:39+08:00
+ * @Last modified time: 2026-10-19T14:02:55+08:00
  */
 #include "runtime_error.h"
 
 #include <assert.h>
-#include <stdbool.h>
+#include <stddef.h>
 
-static char const *message = "No Error";
-static int parameter = -1;
-static char const *file = 0;
-static int line = -1;
+#define RUNTIME_ERROR_CONTEXT_INIT {"No Error", -1, 0, -1, true}
+
+// every thread starts with its own context, the caller may swap in one of its own
+static RUNTIME_ERROR_THREAD_LOCAL RuntimeErrorContextType thread_context = RUNTIME_ERROR_CONTEXT_INIT;
+static RUNTIME_ERROR_THREAD_LOCAL RuntimeErrorContextType *current = NULL;
+
+static inline RuntimeErrorContextType *m_runtimeErrorCurrent(void) {
+	return current != NULL ? current : &thread_context;
+}
+
+void runtimeErrorContextInit(RuntimeErrorContextType *context, bool abort_on_throw) {
+	*context = (RuntimeErrorContextType)RUNTIME_ERROR_CONTEXT_INIT;
+	context->m_abortOnThrow = abort_on_throw;
+}
+
+RuntimeErrorContextType *runtimeErrorSetContext(RuntimeErrorContextType *context) {
+	RuntimeErrorContextType *previous = m_runtimeErrorCurrent();
+	current = context;
+
+	return previous;
+}
+
+RuntimeErrorContextType *runtimeErrorGetContext(void) { return m_runtimeErrorCurrent(); }
+
+void runtimeErrorSetAbortOnThrow(bool abort_on_throw) { m_runtimeErrorCurrent()->m_abortOnThrow = abort_on_throw; }
 
 void runtimeErrorReset(void) {
-	message = "No Error";
-	parameter = -1;
+	RuntimeErrorContextType *context = m_runtimeErrorCurrent();
+
+	context->m_message = "No Error";
+	context->m_parameter = -1;
+	context->m_file = 0;
+	context->m_line = -1;
 }
 
-char const *runtimerErrorGetLastError(void) { return message; }
+char const *runtimerErrorGetLastError(void) { return m_runtimeErrorCurrent()->m_message; }
 
-int runtimeErrorGetLastParam(void) { return parameter; }
+int runtimeErrorGetLastParam(void) { return m_runtimeErrorCurrent()->m_parameter; }
+
+char const *runtimeErrorGetLastFile(void) { return m_runtimeErrorCurrent()->m_file; }
+
+int runtimeErrorGetLastLine(void) { return m_runtimeErrorCurrent()->m_line; }
 
 void runtimeErrorThrow(const char *msg, int param, const char *f, int l) {
-	message = msg;
-	parameter = param;
-	file = f;
-	line = l;
+	RuntimeErrorContextType *context = m_runtimeErrorCurrent();
+
+	context->m_message = msg;
+	context->m_parameter = param;
+	context->m_file = f;
+	context->m_line = l;
 
-	assert(false);
+	assert(!context->m_abortOnThrow);
 }
@@ -1,14 +1,51 @@
 /**
  * @Date:   2019-11-12T14:52:29+08:00
- * @Last modified time: 2019-11-16T11:34:34+08:00
+ * @Last modified time: 2026-10-19T14:02:55+08:00
  */
 
 #pragma once
 
+#include <stdbool.h>
+
+// bare metal targets usually have no TLS support, there the default context is shared by everyone
+#ifndef RUNTIME_ERROR_THREAD_LOCAL
+#if defined(__STDC_NO_THREADS__) || (defined(__arm__) && !defined(__linux__))
+#define RUNTIME_ERROR_THREAD_LOCAL
+#else
+#define RUNTIME_ERROR_THREAD_LOCAL _Thread_local
+#endif
+#endif
+
+typedef struct RuntimeErrorContext {
+	char const* m_message;
+	int m_parameter;
+	char const* m_file;
+	int m_line;
+
+	bool m_abortOnThrow;  // assert(false) on THROW, i.e. abort in debug build
+} RuntimeErrorContextType;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+void runtimeErrorContextInit(RuntimeErrorContextType* context, bool abort_on_throw);
+
+// NULL switches the calling thread back to its own context, the previous context is returned
+RuntimeErrorContextType* runtimeErrorSetContext(RuntimeErrorContextType* context);
+RuntimeErrorContextType* runtimeErrorGetContext(void);
+void runtimeErrorSetAbortOnThrow(bool abort_on_throw);
+
 void runtimeErrorReset(void);
 char const* runtimerErrorGetLastError(void);
 int runtimeErrorGetLastParam(void);
+char const* runtimeErrorGetLastFile(void);
+int runtimeErrorGetLastLine(void);
 
 void runtimeErrorThrow(const char* message, int param, const char* file, int line);
 
+#ifdef __cplusplus
+}
+#endif
+
 #define THROW(description, param) runtimeErrorThrow(description, param, __FILE__, __LINE__)